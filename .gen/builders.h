@@ -0,0 +1 @@
+/root/repo/builders.h
\ No newline at end of file
@@ -0,0 +1,102 @@
+/* This file was automatically generated.  Do not edit! */
+void cleanup_cells();
+int count_out_used(const cell_t *c);
+bool out_used(const cell_t *c,int ix);
+cell_t *unique(cell_t **cp);
+cell_t *take(cell_t **cp);
+bool assert_ref(cell_t ***roots,size_t n);
+size_t count_root(const cell_t *c,cell_t ***roots,size_t n);
+void print_list(cell_t *c);
+bool leak_test();
+bool check_free_lists();
+void alloc_to(size_t n);
+bool check_bit(uint8_t *m,unsigned int x);
+void clear_bit(uint8_t *m,unsigned int x);
+void set_bit(uint8_t *m,unsigned int x);
+TEST(alt_sets);
+TEST(cells_grow);
+TEST(coalesce);
+TEST(alloc);
+unsigned int as_get(alt_set_t a,unsigned int k);
+alt_set_t as_select(alt_set_t mask,uintmax_t j);
+unsigned int as_count(alt_set_t mask);
+alt_set_t as_differ(alt_set_t a,alt_set_t b);
+alt_set_t as_mask(alt_set_t a);
+alt_set_t as_conflict(alt_set_t a);
+alt_set_t as_union(alt_set_t a,alt_set_t b);
+alt_set_t as_intersect(alt_set_t a,alt_set_t b);
+alt_set_t as_from_mask(alt_set_t mask,alt_set_t x);
+alt_set_t as_multi(unsigned int k,unsigned n,unsigned int v);
+alt_set_t as_single(unsigned int k,unsigned int v);
+void as_reset();
+void fake_undrop(cell_t *c);
+void fake_drop(cell_t *c);
+void _dropn(cell_t *c,refcount_t n,location_t loc);
+#define drop(c) _dropn(c, 1, LOCATION())
+void drop_flush();
+extern THREAD_LOCAL bool defer_free;
+STATIC_ALLOC(drop_stack,cell_t *,1<<12);
+STATIC_ALLOC(free_batch,pair_t,1<<10);
+location_t cell_location(cell_t const *c);
+bool is_any(cell_t const *c);
+bool is_fail(cell_t const *c);
+bool has_type(cell_t const *c,int t);
+#define dropn(c, n) _dropn(c, n, LOCATION())
+cell_t *refmove(cell_t *src,cell_t *dst,refcount_t n);
+cell_t *refn(cell_t *c,refcount_t n);
+cell_t *ref(cell_t *c);
+cell_t *copy_expand(cell_t const *c,csize_t s);
+cell_t *copy(cell_t const *c);
+cell_t *const *closure_next_user_arg_const(const cell_t *c);
+cell_t *const *closure_next_arg_const(const cell_t *c);
+cell_t **closure_next_user_arg(cell_t *c);
+cell_t **closure_next_arg(cell_t *c);
+csize_t closure_next_user_child(cell_t const *c);
+csize_t closure_next_child(cell_t const *c);
+cell_t **_get_closure_deps(cell_t *c);
+#define get_closure_deps(c) _get_closure_deps(GET_CELL(c))
+csize_t _closure_out(cell_t const *c);
+#define closure_out(c) _closure_out(GET_CELL(c))
+csize_t _closure_in(cell_t const *c);
+#define closure_in(c) _closure_in(GET_CELL(c))
+csize_t _closure_args(cell_t const *c);
+csize_t _list_size(cell_t const *c);
+#define list_size(c) _list_size(GET_CELL(c))
+bool is_offset(cell_t const *c);
+void closure_free(cell_t *c);
+void closure_shrink_list(cell_t *c,csize_t n);
+void closure_shrink(cell_t *c,csize_t s);
+void cell_free(cell_t *c);
+#define closure_args(c) _closure_args(GET_CELL(c))
+csize_t closure_cells(cell_t const *c);
+csize_t calculate_map_size(csize_t n);
+csize_t calculate_list_size(csize_t n);
+csize_t calculate_args_from_cells(csize_t n);
+bool free_dead_cells();
+csize_t calculate_cells(csize_t n);
+cell_t *closure_alloc_cells(csize_t size);
+size_t max_strlen(const cell_t *c);
+size_t string_size(const cell_t *c);
+size_t set_string_size(cell_t *c,size_t n);
+cell_t *alloc_string(size_t n);
+cell_t *alloc_list(csize_t n);
+cell_t *closure_alloc(csize_t args);
+cell_t *alloc_value();
+int free_block_count();
+void drop_reset();
+void cells_init();
+void closure_set_ready(cell_t *c,bool r);
+bool closure_is_ready(cell_t const *c);
+cell_t *persistent(cell_t *c);
+bool _is_persistent(cell_t const *c);
+#define is_persistent(c) _is_persistent(GET_CELL(c))
+#define INTERFACE 0
+bool is_closure(void const *p);
+bool is_cell(void const *p);
+bool is_data(void const *p);
+extern THREAD_LOCAL stats_t stats,saved_stats;
+extern THREAD_LOCAL int current_alloc_cnt;
+extern CONSTANT cell_t fail_cell;
+extern THREAD_LOCAL size_t cells_max;
+extern THREAD_LOCAL size_t cells_size;
+extern THREAD_LOCAL cell_t *cells;
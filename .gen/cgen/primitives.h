@@ -0,0 +1,100 @@
+/* This file was automatically generated.  Do not edit! */
+seg_t __primitive_strtrim_ss(seg_t str);
+typedef int symbol_t;
+symbol_t __primitive_unread_yyoso(symbol_t io,void *fi,seg_t str,void **fo);
+symbol_t __primitive_write_yyoso(symbol_t io,void *fi,seg_t str,void **fo);
+symbol_t __primitive_close_yyo(symbol_t io,void *fi);
+seg_t __primitive_to_string_si(int x);
+typedef struct array array;
+struct array {
+  unsigned int capacity,
+               offset,
+               size;
+  int *elem;
+};
+array __primitive_compose30(array arrL,int in0,int in1,array arrR);
+array __primitive_compose20(array arrL,int in0,array arrR);
+bool __primitive_mod_iii(int x,int y,int *res);
+bool __primitive_div_iii(int x,int y,int *res);
+seg_t __primitive_strcat_sss(seg_t a,seg_t b);
+#define __primitive_strcat_sSs __primitive_strcat_sss
+symbol_t __primitive_open_yyso(symbol_t io,seg_t name,void **fo);
+#define __primitive_open_yySo __primitive_open_yyso
+bool __primitive_strsplit_ssss(seg_t in,seg_t delim,seg_t *pre,seg_t *post);
+#define __primitive_strsplit_sSsS __primitive_strsplit_ssss
+symbol_t __primitive_read_yyoos(symbol_t io,void *fi,void **fo,seg_t *str);
+#define __primitive_read_yyooS __primitive_read_yyoos
+symbol_t __primitive_eq_str_yss(seg_t a,seg_t b);
+#define __primitive_eq_str_ySs __primitive_eq_str_yss
+#define __primitive_eq_str_ySS __primitive_eq_str_yss
+bool __primitive_from_string_is(seg_t str,int *x);
+#define __primitive_from_string_iS __primitive_from_string_is
+array __primitive_pushr2(array arr,int in1,int in0);
+#define __primitive_pushr2_lLaa __primitive_pushr2
+#define __primitive_pushr2_llaa __primitive_pushr2
+array __primitive_pushr1(array arr,int in0);
+#define __primitive_pushr1_lLa __primitive_pushr1
+#define __primitive_pushr1_lla __primitive_pushr1
+bool __primitive_ap02_lli0(array arr,array *ret,int *out1);
+#define __primitive_ap02_lla0(i0, r, o0, o1)  __primitive_ap02_lli0(i0, r, o0)
+bool __primitive_ap02(array arr,array *ret,int *out1,int *out0);
+#define __primitive_ap02_llaa __primitive_ap02
+#define __primitive_ap02_lLaa __primitive_ap02
+bool __primitive_ap01(array arr,array *ret,int *out0);
+#define __primitive_ap01_lla __primitive_ap01
+#define __primitive_ap01_lLa __primitive_ap01
+#define __primitive_pushr2_lLii __primitive_pushr2
+#define __primitive_pushr2_llii __primitive_pushr2
+#define __primitive_pushr1_lLi __primitive_pushr1
+#define __primitive_pushr1_lli __primitive_pushr1
+#define __primitive_ap02_llii __primitive_ap02
+#define __primitive_ap02_lLii __primitive_ap02
+#define __primitive_ap01_lli __primitive_ap01
+#define __primitive_ap01_lLi __primitive_ap01
+#define __primitive_complement_ii(x) ~x
+#define __primitive_shiftr_iii(x, y) x >> y
+#define __primitive_shiftl_iii(x, y) x << y
+#define __primitive_bitxor_iii(x, y) x ^ y
+#define __primitive_bitor_iii(x, y) x | y
+#define __primitive_bitand_iii(x, y) x & y
+#define __primitive_not_yy(x) !x
+#define __primitive_lte_yii(x, y) x <= y
+#define __primitive_lt_yii(x, y) x < y
+#define __primitive_gte_yii(x, y) x >= y
+#define __primitive_gt_yii(x, y) x > y
+#define __primitive_neq_s_yyy(x, y) x != y;
+#define __primitive_neq_yii(x, y) x != y;
+#define __primitive_eq_s_yyy(x, y) x == y;
+#define __primitive_eq_yii(x, y) x == y;
+#define __primitive_mul_iii(x, y) x * y
+#define __primitive_sub_iii(x, y) x - y
+#define __primitive_add_iii(x, y) x + y
+extern const array nil;
+array __primitive_ap10(int in0,array arr);
+array arr_new();
+void print_array(array *arr);
+bool arr_shift(array *arr,int l,int r);
+unsigned int array_remaining(array *arr);
+int *arr_elem(array *arr,unsigned int i);
+array __primitive_quote0_li(int in0);
+seg_t seg_alloc(char *s,unsigned int n);
+typedef struct {
+  int *mem;
+  char *strings;
+}mem_mark_t;
+void mem_release(mem_mark_t mark,seg_t **strs,unsigned int strs_n,array **arrs,unsigned int arrs_n);
+TEST(mem_release);
+TEST(prim_to_string);
+TEST(arr_cow);
+TEST(arr_shift);
+mem_mark_t mem_mark();
+char *string_alloc(unsigned int n);
+array arr_alloc(unsigned int n);
+array arr_alloc_at(unsigned int n,unsigned int offset);
+typedef struct {
+  unsigned int lo, hi;
+}arr_extent_t;
+void init_primitives();
+typedef void *opaque_t;
+typedef int any_t;
+#define INTERFACE 0
@@ -0,0 +1,6 @@
+/* This file was automatically generated.  Do not edit! */
+void set_static_size(int *ptr,int val);
+bool run_command(seg_t name,cell_t *rest);
+COMMAND(help,"list available commands");
+COMMAND(size_param,"set a size parameter");
+COMMAND(param,"set a parameter");
@@ -0,0 +1,42 @@
+COMMAND__ITEM(eval, 1402, analyze, "analyze a function")
+COMMAND__ITEM(eval, 604, arity, "print arity of the given function")
+COMMAND__ITEM(debug_print, 738, base, "set numeric base for display")
+COMMAND__ITEM(ir_compile, 1222, bc, "print bytecode for a word, or all")
+COMMAND__ITEM(eval, 1024, bc_in, "print bytecode for each line")
+COMMAND__ITEM(eval, 969, bits, "number of bits in a pointer")
+COMMAND__ITEM(rt, 1307, bound, "set default_bound")
+COMMAND__ITEM(ir_cache, 336, cache, "cache compiled words in the given file")
+COMMAND__ITEM(gen_cgen, 689, cc, "print C code for given function")
+COMMAND__ITEM(eval, 1135, cl, "clear log")
+COMMAND__ITEM(gen_vlgen, 1002, cv, "print Verilog code for given function")
+COMMAND__ITEM(eval, 613, define, "define a function")
+COMMAND__ITEM(rt, 751, errors, "list errors")
+COMMAND__ITEM(eval, 176, eval, "evaluate the argument")
+COMMAND__ITEM(eval, 104, git, "git commit for this build")
+COMMAND__ITEM(command, 58, help, "list available commands")
+COMMAND__ITEM(gen_cgen, 753, ident, "convert symbol to C identifier")
+COMMAND__ITEM(module, 503, import, "import given module(s), or all")
+COMMAND__ITEM(irc, 75, irc, "IRC bot mode")
+COMMAND__ITEM(irc, 69, ircpass, "IRC password")
+COMMAND__ITEM(eval, 1206, jobs, "set the number of worker processes for analyze")
+COMMAND__ITEM(eval, 596, ld, "load given dir(s)")
+COMMAND__ITEM(eval, 996, lex, "lex and print the arguments")
+COMMAND__ITEM(eval, 588, load, "load given file(s)")
+COMMAND__ITEM(eval, 1076, log, "print the log")
+COMMAND__ITEM(eval, 584, modules, "print all modules")
+COMMAND__ITEM(eval, 1112, op, "set a watched op")
+COMMAND__ITEM(command, 194, param, "set a parameter")
+COMMAND__ITEM(eval, 1011, parse, "parse and print input lines")
+COMMAND__ITEM(eval, 625, quit, "quit interpreter")
+COMMAND__ITEM(eval, 236, rc, "load an rc script")
+COMMAND__ITEM(eval, 1450, reinit, "reinitialize the compiler")
+COMMAND__ITEM(eval, 172, single, "eval one line and exit")
+COMMAND__ITEM(command, 210, size_param, "set a size parameter")
+COMMAND__ITEM(eval, 1446, ssizes, "list static sizes")
+COMMAND__ITEM(eval, 160, stats, "print statistics")
+COMMAND__ITEM(eval, 164, symbols, "print symbol table")
+COMMAND__ITEM(eval, 1147, tag, "convert tag <-> hex")
+COMMAND__ITEM(eval, 1071, test, "run tests matching the argument")
+COMMAND__ITEM(ir_compile, 1245, trace, "trace an instruction")
+COMMAND__ITEM(eval, 1080, tweak, "tweak a value")
+COMMAND__ITEM(eval, 1033, watch, "set a watched cell")
@@ -0,0 +1,5 @@
+COUNTER__ITEM(startle_support, 227, find_last, 1)
+COUNTER__ITEM(startle_map, 154, merge, n)
+COUNTER__ITEM(startle_map, 228, merge_depth, 1)
+COUNTER_MAX__ITEM(startle_map, 232, merge_depth_max, GET_COUNTER(merge_depth))
+COUNTER__ITEM(startle_map, 70, swap, n)
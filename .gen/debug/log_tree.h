@@ -0,0 +1,4 @@
+/* This file was automatically generated.  Do not edit! */
+void log_trees();
+void print_tree(cell_t *c);
+STATIC_ALLOC(log_tree_map,pair_t,256);
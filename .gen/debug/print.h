@@ -0,0 +1,38 @@
+/* This file was automatically generated.  Do not edit! */
+#include <stdio.h>
+COMMAND(base,"set numeric base for display");
+const char *show_file_id(file_id_t id);
+extern const char *file_names[FILE_ID_COUNT];
+char *show_type_all(const cell_t *c);
+char *show_type(type_t t);
+void show_alts(const char *prefix,cell_t const *c);
+char type_char(type_t t);
+void show_var(cell_t const *c);
+void show_func(cell_t const *c);
+bool is_printable(cell_t const *c);
+void show_list(cell_t const *c);
+void show_one(cell_t const *c);
+bool list_is_printable(cell_t const *l);
+bool show_list_elements(cell_t const *c);
+csize_t any_conflicts(cell_t const *const *p,csize_t size);
+bool any_alt_overlap(cell_t const *const *p,csize_t size);
+void show_string(cell_t const *c);
+void show_float(cell_t const *c);
+void show_int(cell_t const *c);
+char *show_type_all_short(const cell_t *c);
+void print_cell_pointer(FILE *f,const char *pre,cell_t *p);
+void make_graph_all(char const *path);
+void graph_cell(FILE *f,cell_t const *c);
+void make_graph(char const *path,cell_t const *c);
+char const *function_token(const cell_t *c);
+void get_name(const cell_t *c,const char **module_name,const char **word_name);
+char const *op_name(op op);
+char const *entry_function_name(cell_t *e);
+FORMAT(alt_set,'S');
+FORMAT(location,'L');
+FORMAT(type,'t');
+FORMAT(function,'O');
+FORMAT(cell,'C');
+char const *show_alt_set(alt_set_t as);
+void mark_cell(cell_t *c);
+#define INTERFACE 0
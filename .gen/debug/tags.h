@@ -0,0 +1,12 @@
+/* This file was automatically generated.  Do not edit! */
+void clear_ptr_tags();
+const char *get_ptr_tag(const void *ptr);
+void set_ptr_tag(const void *ptr,const char *str);
+#define TAG_PTR(ptr, str)                       \
+  ({                                            \
+    __typeof__(ptr) __ptr = ptr;                \
+    set_ptr_tag(__ptr, str);                    \
+    __ptr;                                      \
+  })
+#define INTERFACE 0
+STATIC_ALLOC(tags_map,pair_t,256);
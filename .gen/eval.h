@@ -0,0 +1,92 @@
+/* This file was automatically generated.  Do not edit! */
+TEST(thread_eval);
+void inputs_from_number(int n,range_t *bounds,int bounds_n,val_t *input);
+bool call(tcell_t *e,val_t *in_args,val_t *out_args);
+void breakpoint_hook();
+bool match_log_tag(const cell_t *p);
+void for_each_line(void(*f)(cell_t *,unsigned int));
+uintptr_t loaded_files_hash();
+const char *loaded_file_ptr(uintptr_t pos);
+uintptr_t loaded_file_pos(const char *p);
+extern const char extension[4];
+extern THREAD_LOCAL size_t files_cnt;
+void highlight_errors(seg_t src);
+size_t get_flattened_error_ranges(seg_t src,pair_t *res);
+void reduce_root(cell_t **cp,int depth,int limit,int max);
+#if defined(EMSCRIPTEN)
+int emscripten_eval(char *str,int len);
+#endif
+cell_t *eval_module();
+bool get_arity(const cell_t *p,csize_t *in,csize_t *out,cell_t *module);
+bool load_dir(const char *path);
+bool load_file(int dirfd,const char *path);
+#if defined(USE_LINENOISE)
+void run_eval_linenoise(bool echo);
+#endif
+#if defined(USE_READLINE)
+void run_eval_readline(bool echo);
+#endif
+void run_eval(bool echo);
+bool eval_command(cell_t *p);
+bool eval_command_string(char *start,char *end);
+bool unload_files();
+#if !defined(EMSCRIPTEN)
+int main(int argc,char **argv);
+#endif
+#if !(!defined(EMSCRIPTEN))
+int main(int argc,char **argv);
+#endif
+seg_t glue(const cell_t *t);
+void run_eval_minimal(FILE *f,bool echo,bool tty);
+void load_rc(char *path);
+void eval_init();
+const char *strip_dir(const char *path);
+void show_eval(const char *prefix,seg_t src,const cell_t *c);
+seg_t src_text(const cell_t *p);
+cell_t *eval(const cell_t *p,cell_t **previous);
+PARAMETER(echo,bool,false,"whether the input line is echoed");
+PARAMETER(max_results,int,0,"maximum number of results, or 0 for all");
+PARAMETER(reduction_limit,int,5,"reduction limit");
+PARAMETER(allow_io,bool,true,"allow IO");
+PARAMETER(run_leak_test,bool,true,"whether leak test is performed");
+void stats_display();
+void stats_stop();
+void stats_start();
+extern bool quit;
+COMMAND(git,"git commit for this build");
+COMMAND(reinit,"reinitialize the compiler");
+COMMAND(ssizes,"list static sizes");
+COMMAND(analyze,"analyze a function");
+COMMAND(jobs,"set the number of worker processes for analyze");
+COMMAND(tag,"convert tag <-> hex");
+COMMAND(cl,"clear log");
+COMMAND(op,"set a watched op");
+COMMAND(tweak,"tweak a value");
+COMMAND(log,"print the log");
+COMMAND(test,"run tests matching the argument");
+COMMAND(watch,"set a watched cell");
+COMMAND(bc_in,"print bytecode for each line");
+COMMAND(parse,"parse and print input lines");
+COMMAND(lex,"lex and print the arguments");
+COMMAND(bits,"number of bits in a pointer");
+COMMAND(quit,"quit interpreter");
+COMMAND(define,"define a function");
+COMMAND(arity,"print arity of the given function");
+COMMAND(ld,"load given dir(s)");
+COMMAND(load,"load given file(s)");
+COMMAND(modules,"print all modules");
+COMMAND(rc,"load an rc script");
+COMMAND(eval,"evaluate the argument");
+COMMAND(single,"eval one line and exit");
+COMMAND(symbols,"print symbol table");
+COMMAND(stats,"print statistics");
+STATIC_ALLOC(line_buffer,char,1024);
+STATIC_ALLOC(files,struct mmfile,16);
+STATIC_ALLOC(path_buffer,char,64);
+extern cell_t *previous_result;
+extern const char *history_path;
+extern bool quiet;
+extern bool reinited_on_start;
+extern bool reinit_requested;
+extern bool exit_on_error;
+extern bool command_line;
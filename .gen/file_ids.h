@@ -0,0 +1,39 @@
+FILE_ID(cells,"cells.c")
+FILE_ID(cgen_primitives,"cgen/primitives.c")
+FILE_ID(command,"command.c")
+FILE_ID(debug_log_tree,"debug/log_tree.c")
+FILE_ID(debug_print,"debug/print.c")
+FILE_ID(debug_tags,"debug/tags.c")
+FILE_ID(eval,"eval.c")
+FILE_ID(gen_cgen,"gen/cgen.c")
+FILE_ID(gen_vlgen,"gen/vlgen.c")
+FILE_ID(io,"io.c")
+FILE_ID(ir_analysis,"ir/analysis.c")
+FILE_ID(ir_cache,"ir/cache.c")
+FILE_ID(ir_compile,"ir/compile.c")
+FILE_ID(ir_deps,"ir/deps.c")
+FILE_ID(ir_trace,"ir/trace.c")
+FILE_ID(ir_vm,"ir/vm.c")
+FILE_ID(irc,"irc.c")
+FILE_ID(list,"list.c")
+FILE_ID(module,"module.c")
+FILE_ID(mutate,"mutate.c")
+FILE_ID(parse_lex,"parse/lex.c")
+FILE_ID(parse_parse,"parse/parse.c")
+FILE_ID(parse_tok,"parse/tok.c")
+FILE_ID(primitive_arithmetic,"primitive/arithmetic.c")
+FILE_ID(primitive_core,"primitive/core.c")
+FILE_ID(primitive_io,"primitive/io.c")
+FILE_ID(primitive_other,"primitive/other.c")
+FILE_ID(primitive_string,"primitive/string.c")
+FILE_ID(rt,"rt.c")
+FILE_ID(special,"special.c")
+FILE_ID(startle_error,"startle/error.c")
+FILE_ID(startle_log,"startle/log.c")
+FILE_ID(startle_map,"startle/map.c")
+FILE_ID(startle_static_alloc,"startle/static_alloc.c")
+FILE_ID(startle_stats,"startle/stats.c")
+FILE_ID(startle_support,"startle/support.c")
+FILE_ID(startle_test,"startle/test.c")
+FILE_ID(user_func,"user_func.c")
+FILE_ID(var,"var.c")
@@ -0,0 +1,10 @@
+FORMAT__ITEM(debug_print, 101, alt_set, 'S')
+FORMAT__ITEM(debug_print, 695, cell, 'C')
+FORMAT__ITEM(ir_trace, 1645, entry, 'E')
+FORMAT__ITEM(ir_trace, 1657, entry_short, 'e')
+FORMAT__ITEM(debug_print, 707, function, 'O')
+FORMAT__ITEM(debug_print, 726, location, 'L')
+FORMAT__ITEM(parse_parse, 695, symbol, 'Y')
+FORMAT__ITEM(ir_analysis, 204, tag, 'H')
+FORMAT__ITEM(ir_trace, 1668, trace_cell, 'T')
+FORMAT__ITEM(debug_print, 711, type, 't')
@@ -0,0 +1,39 @@
+/* This file was automatically generated.  Do not edit! */
+size_t expand_sym(char *buf,size_t n,seg_t src);
+TEST(expand_sym);
+const char *sym_to_ident(unsigned char c);
+COMMAND(cc,"print C code for given function");
+COMMAND(ident,"convert symbol to C identifier");
+void clear_ops(tcell_t *e);
+void gen_function(tcell_t *e);
+bool external_includes(const tcell_t *e);
+void gen_noskip(const tcell_t *e,const tcell_t *c,int depth);
+void print_function_name_with_suffix(const tcell_t *e,const tcell_t *tc);
+void print_cname(const tcell_t *tc);
+void print_function_name(const tcell_t *e,const tcell_t *tc);
+bool _is_external(const cell_t *c);
+#define INTERFACE 0
+void gen_indent(int depth);
+int find_next_possible_block(const tcell_t *e,const tcell_t *c);
+bool arg_in_range(const tcell_t *e,const tcell_t *c,int low,int high);
+int find_next_block(const tcell_t *e,const tcell_t *c);
+#define is_external(c) _is_external(GET_CELL(c))
+bool gen_is_aliased(const tcell_t *c);
+bool print_external_header(const char *str);
+const char *external_name(const char *str);
+void gen_tail_call(const tcell_t *e,const tcell_t *c);
+void gen_assert(const tcell_t *e,const tcell_t *c,int depth);
+bool last_call(const tcell_t *e,const tcell_t *c);
+bool gen_skip(const tcell_t *c);
+int cgen_lookup(const tcell_t *e,const tcell_t *c);
+void gen_call(const tcell_t *e,const tcell_t *c,int depth);
+bool gen_instruction(const tcell_t *e,const tcell_t *c,int depth);
+void gen_next_block(const tcell_t *e,const tcell_t *c);
+void gen_function_signatures(const tcell_t *e);
+void print_entry_cname(const tcell_t *e);
+void gen_function_signature(const tcell_t *e);
+int cgen_index(const tcell_t *e,const cell_t *a);
+void print_type_suffix(const tcell_t *entry,const tcell_t *tc);
+const char *cname(type_t t);
+STATIC_ALLOC(assert_set,uintptr_t,67);
+STATIC_ALLOC(expand_sym_buf,char,128);
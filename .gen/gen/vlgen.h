@@ -0,0 +1,5 @@
+/* This file was automatically generated.  Do not edit! */
+COMMAND(cv,"print Verilog code for given function");
+STATIC_ALLOC_DEPENDENT(vl_set_final,uintptr_t,vl_set_size);
+STATIC_ALLOC(vl_set,uintptr_t,31);
+STATIC_ALLOC(vl_outputs,uintptr_t,16);
@@ -0,0 +1 @@
+#define GIT_LOG "85618b8 [user-021] fix: let the entry being traced grow past one block [DIRTY]"
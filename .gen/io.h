@@ -0,0 +1,33 @@
+/* This file was automatically generated.  Do not edit! */
+void io_munmap(void *addr,size_t length);
+typedef struct file file;
+struct file {
+  seg_t name;
+  struct ring_buffer *buffer;
+  int descriptor;
+  uint8_t flags;
+};
+typedef struct file file_t;
+void *io_mmap(file_t *file,size_t length,int offset);
+void io_close(file_t *file);
+int io_seek(file_t *file,int offset);
+file_t *io_open(seg_t name);
+void io_write(file_t *file,seg_t s);
+seg_t io_read(file_t *file);
+void io_unread(file_t *file,seg_t s);
+uint8_t parse_file_prefix(seg_t *name);
+TEST(parse_file_prefix);
+ring_buffer_t *alloc_ring_buffer(int size);
+void io_init();
+extern file_t stream_stdout;
+extern file_t stream_stdin;
+STATIC_ALLOC(stdin_ring_buffer,char,sizeof(ring_buffer_t)+1024);
+STATIC_ALLOC(input_buf,char,1024);
+#define INPUT_BUFFER_SIZE 1024
+#define WORD_SIZE 4
+#define FILE_STREAM 0x80
+#define FILE_BINARY 0x04
+#define FILE_OUT    0x02
+#define FILE_IN     0x01
+#define FLAG_file (file, ->, FILE)
+#define INTERFACE 0
@@ -0,0 +1,21 @@
+/* This file was automatically generated.  Do not edit! */
+void calculate_bit_width(tcell_t *entry);
+void array_bits(tcell_t *entry,tcell_t *tc,int aw,int bw);
+int bit_width(tcell_t *entry,tcell_t *tc);
+int stream_bits(tcell_t *entry,tcell_t *tc,int offset);
+int bits_needed(range_t r,bool is_constant);
+void build_backrefs(const tcell_t *entry,uintptr_t **table,size_t size);
+size_t get_outputs(const tcell_t *entry,const tcell_t *c,uintptr_t const *const *backrefs,uintptr_t const **outputs);
+bool set_nonzero(uintptr_t *arr,size_t n,uintptr_t x);
+size_t backrefs_size(const tcell_t *entry);
+void no_skip_analysis(tcell_t *entry);
+void mark_jumps(tcell_t *entry);
+void loop_invariant_analysis(tcell_t *entry);
+bool is_pure_op(op op);
+void last_use_analysis(tcell_t *entry);
+bool is_tail_call(const tcell_t *entry,const tcell_t *c);
+FORMAT(tag,'H');
+uint32_t hash_entry(tcell_t *entry);
+uint32_t hash_trace_cell(tcell_t *entry,tcell_t *tc);
+void hw_analysis(tcell_t *e);
+bool trace_recursive_changes(tcell_t *entry);
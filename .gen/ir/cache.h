@@ -0,0 +1,4 @@
+/* This file was automatically generated.  Do not edit! */
+COMMAND(cache,"cache compiled words in the given file");
+bool trace_cache_save();
+int trace_cache_restore();
@@ -0,0 +1,36 @@
+/* This file was automatically generated.  Do not edit! */
+COMMAND(bc,"print bytecode for a word, or all");
+COMMAND(trace,"trace an instruction");
+bool _is_expr(cell_t *c);
+bool _is_return(const cell_t *c);
+#define INTERFACE 0
+void set_prev_cells(tcell_t *entry);
+tcell_t *entry_from_token(cell_t *tok);
+void get_trace_info_for_output(trace_t *tr,const tcell_t *e,int n);
+const tcell_t *tref(const tcell_t *entry,const cell_t *c);
+int compile_quote(tcell_t *parent_entry,cell_t *l);
+cell_t *flat_quote(tcell_t *new_entry,tcell_t *parent_entry);
+void mark_quote_barriers(tcell_t *entry,cell_t *c);
+void move_changing_values(tcell_t *entry,cell_t *c);
+void mark_barriers(tcell_t *entry,cell_t *c);
+void dedup_subentries(tcell_t *e);
+cell_t *parse_eval_def(seg_t name,cell_t *rest);
+cell_t *compile_def(cell_t *p,seg_t path,cell_t **context);
+cell_t *module_lookup_compiled(seg_t path,cell_t **context);
+void compile_module(cell_t *module);
+bool compile_word(cell_t **entry,seg_t name,cell_t *module,csize_t in,csize_t out);
+bool pre_compile_word(cell_t *l,cell_t *module,csize_t *in,csize_t *out);
+void store_entries(tcell_t *entry,cell_t *module);
+void trace_final_pass(tcell_t *entry);
+PARAMETER(inline_budget,int,16,"cells a word may add to a caller when inlined");
+PARAMETER(break_on_trace,bool,false,"break on trace");
+STATIC_ALLOC(cse_map,pair_t,1<<10);
+#define is_expr(c) _is_expr(GET_CELL(c))
+void trace_drop_return(tcell_t *entry,int out,uintptr_t dep_mask);
+#define is_return(c) _is_return(GET_CELL(c))
+void drop_trace(tcell_t *entry,tcell_t *tc);
+void print_bytecode_from_entry_number(int n);
+const char *inline_blocker(const tcell_t *entry,const tcell_t *tc);
+void trace_get_name(const tcell_t *tc,const char **module_name,const char **word_name);
+void print_bytecode(tcell_t *entry,bool tags);
+void print_bound(tcell_t *tc);
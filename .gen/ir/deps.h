@@ -0,0 +1,10 @@
+/* This file was automatically generated.  Do not edit! */
+int reload_module(cell_t *old,cell_t *m);
+TEST(reload_module);
+void free_entry_defs();
+void deps_add_restored_entry(tcell_t *e,cell_t *def);
+void deps_add_entry(tcell_t *e,cell_t *def);
+void deps_add_use(cell_t *c);
+void deps_init();
+STATIC_ALLOC(entry_defs,pair_t,1<<12);
+STATIC_ALLOC(entry_callers,pair_t,1<<14);
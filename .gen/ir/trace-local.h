@@ -0,0 +1,187 @@
+/* This file was automatically generated.  Do not edit! */
+bool is_array(const tcell_t *tc);
+csize_t dep_arg_index(const tcell_t *entry,const tcell_t *tc);
+const tcell_t *closure_next_const(const tcell_t *c);
+tcell_t *closure_next(tcell_t *c);
+csize_t closure_tcells(tcell_t const *c);
+val_t trace_opaque_symbol(const tcell_t *c);
+cell_t *trace_extension(cell_t *l,int in,int out);
+void delay_branch(context_t *ctx,priority_t priority);
+tcell_t *tcell_entry(cell_t *e);
+void trace_truncate(tcell_t *p);
+tcell_t *trace_append(const tcell_t *src,size_t n);
+int trace_count();
+void trace_compact(tcell_t *entry);
+FORMAT(entry,'E');
+FORMAT(trace_cell,'T');
+FORMAT(entry_short,'e');
+tcell_t *tc_get(tcell_t *entry,int x);
+void print_active_entries(const char *msg);
+bool valid_pos(uint8_t pos);
+unsigned int trace_reduce_one(tcell_t *entry,cell_t *c);
+unsigned int trace_reduce(tcell_t *entry,cell_t **cp);
+static int trace_return(tcell_t *entry,cell_t *c_);
+bool is_compose_arg(const cell_t *c);
+int inline_quote(tcell_t *entry,cell_t *l);
+bool reduced_list(cell_t *l);
+bool has_computation(const cell_t *c);
+void trace_clear(tcell_t *e);
+void trace_update_2(tcell_t *v,cell_t *c);
+void trace_update_1(cell_t *c);
+void trace_set_type(tcell_t *tc,type_t t);
+void trace_reduction(cell_t *c,cell_t *r);
+#define trace_update(...) DISPATCH(trace_update, __VA_ARGS__)
+void trace_drop(cell_t *r);
+void trace_reclaim(tcell_t *e,tcell_t *tc);
+void trace_dep(cell_t *c);
+void trace_clear_alt(tcell_t *entry);
+void trace_reset_active();
+void trace_reset(tcell_t *entry);
+tcell_t *trace_current_entry();
+void trace_end_entry(tcell_t *e);
+static bool has_mutual_recursion(const tcell_t *entry);
+bool is_self_recursive(const tcell_t *e);
+tcell_t *trace_start_entry(tcell_t *parent,csize_t out);
+static bool trace_add_blocks(size_t n);
+tcell_t *get_trace_ptr(size_t size);
+int trace_store_something(tcell_t *entry,tcell_t **v);
+tcell_t *trace_partial(op op,int n,cell_t *p);
+bool trace_cell_eq(const tcell_t *entry,const tcell_t *a,const tcell_t *b);
+void dedup_trace_cell(tcell_t *entry,cell_t *r);
+void trace_extend(tcell_t *entry,tcell_t *tc);
+static void trace_store_expr(tcell_t *entry,cell_t *c,cell_t *r);
+int trace_store_value(tcell_t *entry,cell_t *c);
+static int trace_value(tcell_t *entry,cell_t *v);
+void trace_arg(tcell_t *tc,int n,cell_t *a);
+scratch_t *get_scratch(tcell_t *tc);
+int trace_copy_cell(tcell_t *entry,const cell_t *c);
+void trace_shrink(tcell_t *t,csize_t args);
+static void trace_zero(tcell_t *p,size_t n);
+bool entry_fits(tcell_t *e,int len);
+int trace_alloc(tcell_t *entry,csize_t args);
+int trace_build_quote(tcell_t *entry,cell_t *l);
+static int trace_get_value(tcell_t *entry,cell_t *r);
+void mark_pos(cell_t *c,int pos);
+void print_switch_maps();
+type_t trace_type(const tcell_t *tc);
+tcell_t *switch_entry_var(tcell_t *entry,tcell_t *v,bool always_allocate);
+void switch_entry(tcell_t *entry,cell_t *r);
+static int trace_lookup_value(tcell_t *entry,const cell_t *c);
+static void value_index_remove(tcell_t *entry,tcell_t *p);
+static void value_index_add(tcell_t *entry,int x);
+static void value_index_rebuild();
+static int value_index_find(tcell_t *entry,const cell_t *c,uintptr_t hash,pair_t **slot);
+static uintptr_t entry_gen(const tcell_t *entry);
+tcell_t *pos_entry(uint8_t pos);
+static bool entry_is_active(const tcell_t *entry);
+static bool is_indexed_value(const tcell_t *p);
+static uintptr_t value_hash(const cell_t *c);
+TEST(trace_encode);
+TEST(large_entry);
+const tcell_t *get_arg_const(const tcell_t *entry,const cell_t *a);
+tcell_t *get_arg(tcell_t *entry,const cell_t *a);
+void tr_set_index(cell_t *const *cp,int index);
+bool tr_flags(const cell_t *c,uint8_t flags);
+void tr_set_flags(cell_t *const *cp,uint8_t flags);
+int tr_index(const cell_t *c);
+cell_t *index_tr(int index);
+int var_index_nofail(tcell_t *entry,tcell_t *v);
+int var_index(tcell_t *entry,tcell_t *v);
+#define FOR_SWITCH_MAP(tc, v, p, it)                                    \
+  for(tcell_t *__tc = is_var(v) && v->value.var ? v->value.var : v,     \
+        *tc = ((p = NULL,                                               \
+                it = map_iterator_begin(switch_map, (uintptr_t)__tc)), __tc); \
+      tc;                                                               \
+      p = map_next(&it, p),                                             \
+        tc = p ? (tcell_t *)p->second : NULL)
+tcell_t *var_for_entry(tcell_t *entry,tcell_t *v);
+tcell_t *get_var(tcell_t *entry,cell_t *c);
+int entry_pos(tcell_t *e);
+tcell_t *var_entry(tcell_t *v);
+void trace_add_shared_entries(tcell_t *start);
+static void add_shared_entries(tcell_t *e);
+void trace_share_entries(tcell_t *top);
+static void share_entry_calls(tcell_t *top,tcell_t *e);
+static tcell_t *find_shared_entry(tcell_t *e,tcell_t *before);
+static void replace_calls(tcell_t *e,tcell_t *from,tcell_t *to);
+static bool entry_headers_match(const tcell_t *a,const tcell_t *b);
+static uint32_t shared_entry_key(tcell_t *e);
+void dedup_entry(tcell_t **e);
+tcell_t *trace_matching_entry(tcell_t *x);
+tcell_t *top_parent(tcell_t *e);
+tcell_t *block_first_entry(tcell_t *v);
+bool entries_match(tcell_t *entry_a,tcell_t *entry_b);
+bool equal_value(const cell_t *a,const cell_t *b);
+bool closure_match(cell_t *a,cell_t *b);
+static size_t entry_block_cells(const tcell_t *e);
+int trace_entry_size(const tcell_t *e);
+bool entry_has(tcell_t *entry,tcell_t *v);
+tcell_t *trace_entry_next(tcell_t *e);
+static void trace_update_block_map(tcell_t *entry);
+tcell_t *entry_from_number(int n);
+tcell_t *trace_cell_at(uintptr_t n);
+int entry_number(tcell_t const *e);
+cell_t *entry_tr(tcell_t *entry);
+void set_entry(tcell_t *c,tcell_t *e);
+tcell_t *tr_entry(const cell_t *c);
+tcell_t *_get_entry(cell_t const *c);
+#define get_entry(c) _get_entry(GET_CELL(c))
+static void reset_scratch();
+void trace_init();
+static void trace_touch(tcell_t *end);
+static void trace_reserve();
+void trace_reinit();
+bool is_trace_cell(void const *p);
+#define FOR_TRACE_CONST_REV(...) DISPATCH(FOR_TRACE_CONST_REV, __VA_ARGS__)
+#define FOR_TRACE_CONST_REV_3(_c, e, n)         \
+  for(const tcell_t                             \
+        *_entry = (e),                          \
+        *_c = _entry + (n);                     \
+      _c > _entry && _c->trace.prev_cells;      \
+      _c -= _c->trace.prev_cells)
+#define FOR_TRACE_CONST_REV_2(_c, e) FOR_TRACE_CONST_REV_3(_c, e, (e)->entry.len - ((e) + 1)->trace.prev_cells + 1)
+#define FOR_TRACE_CONST(...) DISPATCH(FOR_TRACE_CONST, __VA_ARGS__)
+csize_t calculate_tcells(csize_t n);
+#define FOR_TRACE_CONST_3(_c, e, n)             \
+  for(const tcell_t                             \
+        *_entry = (e),                          \
+        *_c = _entry + (n);                     \
+      _c - _entry - 1 < _entry->entry.len;      \
+      _c += calculate_tcells(_c->size))
+#define FOR_TRACE_CONST_2(_c, e) FOR_TRACE_CONST_3(_c, e, 1)
+#define FOR_TRACE_REV(...) DISPATCH(FOR_TRACE_REV, __VA_ARGS__)
+#define FOR_TRACE_REV_3(_c, e, n)               \
+  for(tcell_t                                   \
+        *_entry = (e),                          \
+        *_c = _entry + (n);                     \
+      _c > _entry && _c->trace.prev_cells;      \
+      _c -= _c->trace.prev_cells)
+#define FOR_TRACE_REV_2(_c, e) FOR_TRACE_REV_3(_c, e, (e)->entry.len - ((e) + 1)->trace.prev_cells + 1)
+#define FOR_TRACE(...) DISPATCH(FOR_TRACE, __VA_ARGS__)
+#define FOR_TRACE_3(_c, e, n)                   \
+  for(tcell_t                                   \
+        *_entry = (e),                          \
+        *_c = _entry + (n);                     \
+      _c - _entry - 1 < _entry->entry.len;      \
+      _c += calculate_tcells(_c->size))
+#define FOR_TRACE_2(_c, e) FOR_TRACE_3(_c, e, 1)
+typedef intptr_t trace_index_t;
+#define INTERFACE 0
+extern THREAD_LOCAL size_t trace_block_map_size;
+extern THREAD_LOCAL tcell_t **trace_block_map;
+extern THREAD_LOCAL uintptr_t value_index_gen;
+extern THREAD_LOCAL size_t value_index_used;
+extern THREAD_LOCAL size_t value_index_size;
+extern THREAD_LOCAL pair_t *value_index;
+extern THREAD_LOCAL unsigned int prev_entry_pos;
+STATIC_ALLOC_DEPENDENT(active_entry_gen,uintptr_t,active_entries_size);
+STATIC_ALLOC(active_entries,tcell_t *,1<<4);
+STATIC_ALLOC(shared_entries,pair_t,1<<12);
+STATIC_ALLOC(switch_rev_map,pair_t,64);
+STATIC_ALLOC(switch_map,pair_t,64);
+extern THREAD_LOCAL scratch_t *scratch_ptr;
+extern THREAD_LOCAL scratch_t *scratch_top;
+extern THREAD_LOCAL tcell_t *trace_hwm;
+extern THREAD_LOCAL tcell_t *trace_ptr;
+extern THREAD_LOCAL size_t trace_cells_size;
+extern THREAD_LOCAL tcell_t *trace_cells;
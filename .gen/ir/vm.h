@@ -0,0 +1,12 @@
+/* This file was automatically generated.  Do not edit! */
+TEST(vm);
+enum vm_result {
+  VM_FAIL = 0,
+  VM_SUCCESS,
+  VM_ABORT // can't be run by the interpreter, use reduction instead
+};
+typedef enum vm_result vm_result;
+vm_result vm_call(const tcell_t *e,const val_t *in_args,val_t *out_args);
+bool vm_supported(const tcell_t *e);
+PARAMETER(use_vm,bool,true,"run compiled words with the direct interpreter");
+#define INTERFACE 0
@@ -0,0 +1,26 @@
+/* This file was automatically generated.  Do not edit! */
+void irc_io_munmap(UNUSED void *addr,UNUSED size_t length);
+void *irc_io_mmap(UNUSED file_t *file,UNUSED size_t length,UNUSED int offset);
+int irc_io_seek(UNUSED file_t *file,UNUSED int offset);
+int match_channel(char **pline);
+seg_t irc_io_read_with_prompt(file_t *file);
+void irc_io_close(UNUSED file_t *file);
+file_t *irc_io_open(UNUSED seg_t name);
+seg_t irc_io_read(file_t *file);
+void irc_io_write(UNUSED file_t *file,seg_t s);
+void irc_highlight_errors(file_t *file,seg_t src);
+void irc_action(const char *msg);
+char *irc_prefix();
+char *irc_prefix_no_wait();
+void irc_pong(const char *msg);
+bool irc_message_sent();
+bool irc_should_wait();
+void run_eval_irc();
+void irc_join();
+void irc_connect();
+extern const io_t irc_io;
+COMMAND(ircpass,"IRC password");
+COMMAND(irc,"IRC bot mode");
+void irc_init();
+extern file_t stream_irc;
+extern int last_read_channel;
@@ -0,0 +1,50 @@
+/* This file was automatically generated.  Do not edit! */
+cell_t *id_list(cell_t *c);
+void unwrap_id_lists(cell_t **lp);
+cell_t *get_list_function_var(cell_t *c);
+bool is_nil(cell_t *l);
+qsize_t quote_size(cell_t *c,bool row);
+csize_t function_in(cell_t *l);
+csize_t args_required(const cell_t *c);
+cell_t **needs_arg(cell_t *l);
+#define leftmost(...) DISPATCH(leftmost, __VA_ARGS__)
+cell_t **leftmost_1(cell_t **lp);
+cell_t **leftmost_2(cell_t **lp,bool row);
+cell_t **leftmost_row(cell_t **lp);
+cell_t **left_elem(cell_t *l);
+cell_t **left_list(cell_t **l);
+bool is_empty_list(const cell_t *l);
+cell_t *flattened_list_copy(cell_t *l);
+cell_t **flattened_list_copy_(cell_t *l,cell_t **dst);
+csize_t flattened_list_size(cell_t *l);
+csize_t function_out(const cell_t *l,bool include_row_var);
+cell_t *flat_copy(cell_t *l);
+void collapse_row(cell_t **cp);
+cell_t *list_rest(list_iterator_t it);
+csize_t list_remaining_size(list_iterator_t it,bool count_last_row);
+cell_t **list_next(list_iterator_t *it,bool include_row);
+TEST(list_next);
+TEST(function_in);
+TEST(flattened_list_copy);
+TEST(flat_copy_list);
+TEST(list_remaining_size);
+response reduce_row(const list_iterator_t *it,csize_t remaining,context_t *ctx);
+bool is_row_arg(const list_iterator_t *it);
+list_iterator_t list_begin(cell_t *l);
+void reduce_list(cell_t **cp,int depth,int max);
+void log_ptrs(cell_t *c);
+response func_list(cell_t **cp,context_t *ctx);
+PARAMETER(unroll_limit,int,20,"limit for unrolling lists");
+bool _is_function(cell_t const *c);
+#define is_function(c) _is_function(GET_CELL(c))
+bool _is_id_list(cell_t const *c);
+#define is_id_list(c) _is_id_list(GET_CELL(c))
+bool _is_row_list(cell_t const *c);
+#define is_row_list(c) _is_row_list(GET_CELL(c))
+bool _is_list(cell_t const *c);
+#define is_list(c) _is_list(GET_CELL(c))
+#define INTERFACE 0
+cell_t *row_quote(cell_t *x);
+cell_t *quote(cell_t *x);
+cell_t *make_list(csize_t n);
+cell_t *empty_list();
@@ -0,0 +1 @@
+/root/repo/macros.h
\ No newline at end of file
@@ -0,0 +1,32 @@
+/* This file was automatically generated.  Do not edit! */
+void print_all_bytecode();
+void print_module_bytecode(cell_t *m);
+COMMAND(import,"import given module(s), or all");
+const char *entry_name(cell_t *module,cell_t *entry);
+cell_t *module_lookup(seg_t path,cell_t **context);
+seg_t path_name(seg_t path);
+seg_t parse_split(char c,const char **start,const char *end);
+cell_t *implicit_lookup(seg_t w,cell_t *m);
+cell_t *get_submodule(cell_t *m,seg_t s);
+void merge_into_module(cell_t *ma,cell_t *mb);
+cell_t *build_module(cell_t *c);
+cell_t *get_module(seg_t s);
+cell_t *expand_map(cell_t *c,csize_t n);
+TEST(expand_map);
+TEST(module_lookup);
+void free_modules();
+void print_modules();
+void free_defs(cell_t *m);
+void print_defs(const cell_t *m);
+void free_def(cell_t *l);
+void print_def(const cell_t *l);
+cell_t *module_get_or_create(cell_t *m,seg_t key);
+cell_t *module_get(cell_t *m,seg_t key);
+cell_t *module_set(cell_t *m,seg_t key,cell_t *val);
+void module_init();
+cell_t **module_ref(cell_t *m);
+bool is_module(const cell_t *c);
+cell_t *make_module();
+extern THREAD_LOCAL cell_t *modules;
+extern pair_t primitive_module[];
+const char *module_name(cell_t *module);
@@ -0,0 +1,10 @@
+/* This file was automatically generated.  Do not edit! */
+void mutate_finish(cell_t *l);
+bool _check_deps(cell_t *c,int depth);
+bool check_deps(cell_t *c);
+cell_t *mutate_list(cell_t *l,cell_t **rp);
+cell_t *mutate(cell_t **cp,cell_t **rp);
+cell_t *get_mutable(cell_t *c);
+bool deps_are_unique(cell_t *c);
+cell_t *add_to_mutate_list(cell_t *c,cell_t **l);
+bool check_tmp_loop(cell_t *c);
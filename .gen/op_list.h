@@ -0,0 +1,80 @@
+OP__ITEM(primitive_arithmetic, 355, add)
+OP__ITEM(primitive_arithmetic, 492, add_float)
+OP__ITEM(primitive_core, 73, alt)
+OP__ITEM(primitive_other, 124, annotate_inline)
+OP__ITEM(primitive_core, 524, ap)
+OP__ITEM(primitive_core, 89, assert)
+OP__ITEM(primitive_arithmetic, 540, atan2)
+OP__ITEM(primitive_arithmetic, 566, bitand)
+OP__ITEM(primitive_arithmetic, 572, bitor)
+OP__ITEM(primitive_arithmetic, 578, bitxor)
+OP__ITEM(primitive_io, 103, close)
+OP__ITEM(primitive_arithmetic, 596, complement)
+OP__ITEM(primitive_core, 533, compose)
+OP__ITEM(primitive_arithmetic, 525, cos)
+OP__ITEM(primitive_core, 328, delay)
+OP__ITEM(special, 430, dep)
+OP__ITEM(primitive_arithmetic, 454, div)
+OP__ITEM(primitive_arithmetic, 510, div_float)
+OP__ITEM(primitive_core, 306, drop)
+OP__ITEM(primitive_core, 346, dup)
+OP__ITEM(primitive_io, 501, dup_array)
+OP__ITEM(primitive_arithmetic, 647, eq)
+OP__ITEM(primitive_arithmetic, 652, eq_s)
+OP__ITEM(primitive_string, 62, eq_str)
+OP__ITEM(user_func, 1116, exec)
+OP__ITEM(primitive_arithmetic, 520, exp)
+OP__ITEM(primitive_other, 72, external)
+OP__ITEM(special, 532, fail)
+OP__ITEM(primitive_other, 62, float_t)
+OP__ITEM(special, 539, forked)
+OP__ITEM(primitive_string, 149, from_string)
+OP__ITEM(primitive_string, 177, from_string_bin)
+OP__ITEM(primitive_arithmetic, 623, gt)
+OP__ITEM(primitive_arithmetic, 629, gte)
+OP__ITEM(primitive_core, 281, id)
+OP__ITEM(primitive_other, 52, int_t)
+OP__ITEM(primitive_other, 67, list_t)
+OP__ITEM(primitive_arithmetic, 515, log)
+OP__ITEM(primitive_arithmetic, 635, lt)
+OP__ITEM(primitive_arithmetic, 641, lte)
+OP__ITEM(primitive_io, 563, mmap)
+OP__ITEM(primitive_arithmetic, 480, mod)
+OP__ITEM(primitive_arithmetic, 396, mul)
+OP__ITEM(primitive_arithmetic, 498, mul_float)
+OP__ITEM(primitive_arithmetic, 486, negate)
+OP__ITEM(primitive_arithmetic, 658, neq)
+OP__ITEM(primitive_arithmetic, 663, neq_s)
+OP__ITEM(primitive_arithmetic, 602, not)
+OP__ITEM(primitive_io, 70, open)
+OP__ITEM(primitive_core, 271, otherwise)
+OP__ITEM(primitive_other, 115, partial)
+OP__ITEM(special, 467, placeholder)
+OP__ITEM(primitive_core, 555, pushr)
+OP__ITEM(primitive_core, 548, quote)
+OP__ITEM(primitive_io, 177, read)
+OP__ITEM(primitive_io, 430, read_array)
+OP__ITEM(primitive_other, 140, row_id)
+OP__ITEM(primitive_io, 529, seek)
+OP__ITEM(primitive_core, 141, seq)
+OP__ITEM(primitive_arithmetic, 584, shiftl)
+OP__ITEM(primitive_arithmetic, 590, shiftr)
+OP__ITEM(primitive_arithmetic, 530, sin)
+OP__ITEM(primitive_arithmetic, 545, sqrt)
+OP__ITEM(primitive_string, 36, strcat)
+OP__ITEM(primitive_string, 204, strsplit)
+OP__ITEM(primitive_string, 239, strtrim)
+OP__ITEM(primitive_arithmetic, 424, sub)
+OP__ITEM(primitive_arithmetic, 504, sub_float)
+OP__ITEM(primitive_core, 316, swap)
+OP__ITEM(primitive_other, 57, symbol_t)
+OP__ITEM(primitive_arithmetic, 535, tan)
+OP__ITEM(primitive_arithmetic, 668, to_float)
+OP__ITEM(primitive_string, 96, to_string)
+OP__ITEM(primitive_string, 124, to_string_bin)
+OP__ITEM(primitive_arithmetic, 692, trunc)
+OP__ITEM(primitive_core, 219, unless)
+OP__ITEM(primitive_io, 172, unread)
+OP__ITEM(special, 75, value)
+OP__ITEM(primitive_io, 167, write)
+OP__ITEM(primitive_io, 467, write_array)
@@ -0,0 +1,10 @@
+PARAMETER__ITEM(eval, 1108, allow_io, bool, true, "allow IO")
+PARAMETER__ITEM(rt, 309, alt_jobs, int, 1, "worker processes for exploring alternatives (`|`)")
+PARAMETER__ITEM(ir_compile, 1278, break_on_trace, bool, false, "break on trace")
+PARAMETER__ITEM(eval, 156, echo, bool, false, "whether the input line is echoed")
+PARAMETER__ITEM(ir_compile, 483, inline_budget, int, 16, "cells a word may add to a caller when inlined")
+PARAMETER__ITEM(eval, 1143, max_results, int, 0, "maximum number of results, or 0 for all")
+PARAMETER__ITEM(eval, 1139, reduction_limit, int, 5, "reduction limit")
+PARAMETER__ITEM(eval, 168, run_leak_test, bool, true, "whether leak test is performed")
+PARAMETER__ITEM(list, 91, unroll_limit, int, 20, "limit for unrolling lists")
+PARAMETER__ITEM(ir_vm, 73, use_vm, bool, true, "run compiled words with the direct interpreter")
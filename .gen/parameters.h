@@ -0,0 +1 @@
+/root/repo/parameters.h
\ No newline at end of file
@@ -0,0 +1,9 @@
+/* This file was automatically generated.  Do not edit! */
+size_t read_to_ws(cell_t **rest,char *buf,size_t size);
+uintptr_t tok_indent(const cell_t *c);
+cell_t *lex(const char *s,const char *e);
+TEST(lex);
+void print_toks(cell_t *p);
+void free_toks(cell_t *t);
+void tok_set_seg(cell_t *c,const seg_t s);
+seg_t tok_seg(const cell_t *c);
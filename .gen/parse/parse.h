@@ -0,0 +1,47 @@
+/* This file was automatically generated.  Do not edit! */
+#include <stdarg.h>
+void attribute_parser(const char *s,const char *e,bool after_newline,attr_t *attr_before,attr_t *attr_after);
+bool parse_numeric_args(cell_t *l,int *arg,int n);
+cell_t *parse_expr_string(const char *expr);
+FORMAT(symbol,'Y');
+const char *symbol_string(val_t x);
+bool symbols_match(const char *s,const char *end,size_t n);
+uintptr_t intern(seg_t sym);
+cell_t *string_symbol(seg_t sym);
+cell_t *push_arg(cell_t **stack,unsigned int *n,seg_t seg,cell_t *c);
+cell_t *parse_subexpr(const cell_t **l,cell_t *module,tcell_t *entry,int depth);
+cell_t *parse_expr(const cell_t **l,cell_t *module,tcell_t *entry);
+cell_t *array_to_list(cell_t **a,csize_t n);
+bool is_uppercase(char c);
+bool parse_module(cell_t **c,seg_t *name,cell_t **err);
+attr_t scan_attributes(const cell_t *l);
+cell_t *parse_defs(cell_t **c,const char *module_name,cell_t **err);
+cell_t *check_def(cell_t *l);
+bool has_IO(const cell_t *p);
+cell_t *check_reserved(cell_t *p);
+bool parse_def(cell_t **c,cell_t **name,cell_t **l);
+bool parse_rhs_expr(cell_t **c,cell_t **res);
+cell_t *list_insert(cell_t *c,cell_t *x);
+bool is_reserved(seg_t s);
+long int parse_num(const cell_t *c);
+bool match_class(const cell_t *c,char_class_t cc,uint min_length,uint max_length);
+bool match(const cell_t *c,const char *str);
+extern const char *reserved_words[];
+val_t fill_args(tcell_t *entry,cell_t *l);
+cell_t *parse_word(seg_t w,cell_t *module,unsigned int n,tcell_t *entry);
+bool match_param_word(const char *pre,seg_t seg,csize_t *in,csize_t *out);
+cell_t *lookup_word(seg_t w);
+bool is_num(char const *str);
+void parse_init();
+TEST(strings);
+TEST(parse_module);
+TEST(parse_def);
+void strings_drop();
+const char *string_printf(const char *format,...);
+const char *string_vprintf(const char *format,va_list ap);
+const char *seg_string(seg_t s);
+void print_symbols();
+STATIC_ALLOC(symbols,pair_t,64);
+STATIC_ALLOC(strings,char,1<<14);
+STATIC_ALLOC_DEPENDENT(symbol_index,const char *,symbols_size);
+#define INTERFACE 0
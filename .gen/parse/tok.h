@@ -0,0 +1,10 @@
+/* This file was automatically generated.  Do not edit! */
+void update_line(const char *start,const char *end,const char **line);
+seg_t tok(const char *s,const char *e,char_class_t *class,attr_t *attr_before,attr_t *attr_after);
+const char *string_literal_end(const char *s,const char *e);
+TEST(comments);
+TEST(string_literal);
+void mark_comments(char c,char *str);
+const char *skip_comment(const char *s,const char *e);
+char_class_t char_class(char c);
+void attribute_parser(const char *s,const char *e,bool after_newline,attr_t *attr_before,attr_t *attr_after);
@@ -0,0 +1,82 @@
+/* This file was automatically generated.  Do not edit! */
+WORD("!=",neq,2,1)val_t neq_op(val_t x,val_t y);
+val_t eq_op(val_t x,val_t y);
+WORD("<=",lte,2,1)val_t lte_op(val_t x,val_t y);
+WORD("<",lt,2,1)val_t lt_op(val_t x,val_t y);
+WORD(">=",gte,2,1)val_t gte_op(val_t x,val_t y);
+WORD(">",gt,2,1)val_t gt_op(val_t x,val_t y);
+cell_t *neq_identity(cell_t *p,cell_t *q);
+cell_t *eq_identity(cell_t *p,cell_t *q);
+range_t bool_range_op(UNUSED range_t a,UNUSED range_t b);
+WORD("not",not,1,1)val_t not_op(val_t x);
+WORD("~b",complement,1,1)val_t complement_op(val_t x);
+WORD(">>b",shiftr,2,1)val_t shiftr_op(val_t x,val_t y);
+WORD("<<b",shiftl,2,1)val_t shiftl_op(val_t x,val_t y);
+WORD("^b",bitxor,2,1)val_t bitxor_op(val_t x,val_t y);
+WORD("|b",bitor,2,1)val_t bitor_op(val_t x,val_t y);
+range_t bitand_range_op(range_t a,range_t b);
+WORD("&b",bitand,2,1)val_t bitand_op(val_t x,val_t y);
+WORD("/f",div_float,2,1)double div_float_op(double x,double y);
+WORD("-f",sub_float,2,1)double sub_float_op(double x,double y);
+WORD("*f",mul_float,2,1)double mul_float_op(double x,double y);
+WORD("+f",add_float,2,1)double add_float_op(double x,double y);
+WORD("neg",negate,1,1)val_t negate_op(val_t x);
+range_t mod_range_op(range_t n,range_t d);
+WORD("%",mod,2,1)val_t mod_op(val_t x,val_t y);
+cell_t *div_identity(cell_t *p,cell_t *q);
+range_t div_range_op(range_t n,range_t d);
+WORD("/",div,2,1)val_t div_op(val_t x,val_t y);
+cell_t *sub_identity(cell_t *p,cell_t *q);
+range_t sub_range_op(range_t a,range_t b);
+WORD("-",sub,2,1)val_t sub_op(val_t x,val_t y);
+cell_t *mul_identity(cell_t *p,cell_t *q);
+range_t mul_range_op(range_t x,range_t y);
+WORD("*",mul,2,1)val_t mul_op(val_t x,val_t y);
+OP(add);
+WORD("trunc",trunc,1,1)OP(trunc);
+WORD("->f",to_float,1,1)OP(to_float);
+WORD("!:=",neq_s,2,1)OP(neq_s);
+OP(neq);
+WORD("=:=",eq_s,2,1)OP(eq_s);
+WORD("==",eq,2,1)OP(eq);
+OP(lte);
+OP(lt);
+OP(gte);
+OP(gt);
+OP(not);
+OP(complement);
+OP(shiftr);
+OP(shiftl);
+OP(bitxor);
+OP(bitor);
+OP(bitand);
+WORD("sqrt",sqrt,1,1)OP(sqrt);
+WORD("atan2",atan2,2,1)OP(atan2);
+WORD("tan",tan,1,1)OP(tan);
+WORD("sin",sin,1,1)OP(sin);
+WORD("cos",cos,1,1)OP(cos);
+WORD("exp",exp,1,1)OP(exp);
+WORD("log",log,1,1)OP(log);
+OP(div_float);
+OP(sub_float);
+OP(mul_float);
+OP(add_float);
+OP(negate);
+OP(mod);
+OP(div);
+OP(sub);
+OP(mul);
+cell_t *add_identity(cell_t *p,cell_t *q);
+range_t add_range_op(range_t a,range_t b);
+WORD("+",add,2,1)val_t add_op(val_t x,val_t y);
+response func_op1_float(cell_t **cp,context_t *ctx,double(*op)(double));
+response func_op2_float(cell_t **cp,context_t *ctx,double(*op)(double,double),bool nonzero);
+cell_t *_op1_float(double(*op)(double),cell_t *x);
+cell_t *_op2_float(double(*op)(double,double),cell_t *x,cell_t *y);
+response func_op1(cell_t **cp,context_t *ctx,int arg_type,int res_type,val_t(*op)(val_t),val_t(*inv_op)(val_t));
+response func_op2(cell_t **cp,context_t *ctx,type_t arg_type,type_t res_type,val_t(*op)(val_t,val_t),range_t(*range_op)(range_t,range_t),bool nonzero,bool(*bound_contexts)(cell_t *,context_t *,context_t *),cell_t *(*identity)(cell_t *,cell_t *));
+cell_t *no_identity(UNUSED cell_t *p,UNUSED cell_t *q);
+range_t no_range_op(UNUSED range_t a,UNUSED range_t b);
+cell_t *_op1(cell_t *c,type_t arg_type,type_t res_type,val_t(*op)(val_t),cell_t *x,cell_t *imm);
+cell_t *_op2(cell_t *c,type_t arg_type,type_t res_type,val_t(*op)(val_t,val_t),range_t(*range_op)(range_t,range_t),cell_t *x,cell_t *y,cell_t *imm);
+range_t infer_bound(range_t(*range_op)(range_t,range_t),cell_t *x,cell_t *y);
@@ -0,0 +1,18 @@
+/* This file was automatically generated.  Do not edit! */
+cell_t *id(cell_t *c,alt_set_t as);
+bool rule_merge_unless(context_t *ctx);
+WORD("|",alt,2,1)OP(alt);
+WORD("pushr",pushr,2,1,SYNC)OP(pushr);
+WORD("quote",quote,1,1,SYNC)OP(quote);
+WORD(".",compose,2,1,SYNC)OP(compose);
+WORD_ALIAS("pushl",ap,2,1,pushl,SYNC)WORD_ALIAS("popr",ap,1,2,popr,SYNC)OP(ap);
+WORD("dup",dup,1,2)OP(dup);
+WORD("delay",delay,1,1)OP(delay);
+WORD("swap",swap,2,2)OP(swap);
+WORD("drop",drop,2,1)OP(drop);
+WORD("id",id,1,1)OP(id);
+WORD("otherwise",otherwise,2,1)OP(otherwise);
+WORD("unless",unless,2,1)OP(unless);
+WORD("seq",seq,2,1)OP(seq);
+WORD("!",assert,2,1)OP(assert);
+cell_t *set_alt(cell_t *c,alt_set_t as,cell_t *alt);
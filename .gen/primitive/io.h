@@ -0,0 +1,32 @@
+/* This file was automatically generated.  Do not edit! */
+TEST(array);
+TEST(bench_array);
+bool array_write(uintptr_t arr,uintptr_t addr,val_t in);
+bool array_read(uintptr_t arr,uintptr_t addr,val_t *out);
+void array_init();
+STATIC_ALLOC(mmap_array,mmap_array_t,8);
+extern THREAD_LOCAL val_t next_array_id;
+response write_op(cell_t **cp,context_t *ctx,void(*op)(file_t *,seg_t));
+WORD("open",open,2,2)OP(open);
+WORD("mmap",mmap,5,2)OP(mmap);
+WORD("seek",seek,3,2)OP(seek);
+WORD("dup_array",dup_array,1,2)OP(dup_array);
+WORD("write_array",write_array,3,1)OP(write_array);
+WORD("read_array",read_array,2,2)OP(read_array);
+WORD("read",read,2,3)OP(read);
+WORD("unread",unread,3,2)OP(unread);
+WORD("write",write,3,2)OP(write);
+WORD("close",close,2,1)OP(close);
+typedef struct {
+  file_t *(*open)   (seg_t);
+  seg_t   (*read)   (file_t *);
+  void    (*write)  (file_t *, seg_t);
+  void    (*unread) (file_t *, seg_t);
+  int     (*seek)   (file_t *, int);
+  void   *(*mmap)   (file_t *, size_t, int);
+  void    (*munmap) (void *, size_t);
+  void    (*close)  (file_t *);
+}io_t;
+extern const io_t *io;
+extern const io_t default_io;
+#define INTERFACE 0
@@ -0,0 +1,10 @@
+/* This file was automatically generated.  Do not edit! */
+WORD("int_t",int_t,1,1)OP(int_t);
+WORD("#row",row_id,1,1)OP(row_id);
+WORD("--inline",annotate_inline,1,1)OP(annotate_inline);
+WORD("--partial",partial,1,1)OP(partial);
+OP(external);
+WORD("list_t",list_t,1,1)OP(list_t);
+WORD("float_t",float_t,1,1)OP(float_t);
+WORD("symbol_t",symbol_t,1,1)OP(symbol_t);
+response func_type(cell_t **cp,context_t *ctx,type_t type);
@@ -0,0 +1,10 @@
+/* This file was automatically generated.  Do not edit! */
+seg_t int_to_string(uintptr_t x);
+WORD("++",strcat,2,1)OP(strcat);
+WORD("strtrim",strtrim,1,1)OP(strtrim);
+WORD("strsplit",strsplit,2,2)OP(strsplit);
+WORD("<-bin",from_string_bin,1,1)OP(from_string_bin);
+WORD("<-str",from_string,1,1)OP(from_string);
+WORD("->bin",to_string_bin,1,1)OP(to_string_bin);
+WORD("->str",to_string,1,1)OP(to_string);
+WORD("=s",eq_str,2,1)OP(eq_str);
@@ -0,0 +1,136 @@
+/* This file was automatically generated.  Do not edit! */
+bool _is_passthrough(const cell_t *c);
+#define is_passthrough(c) _is_passthrough(GET_CELL(c))
+extern context_t *const ctx;
+alt_set_t ctx_alt_set_range(context_t *ctx);
+alt_set_t ctx_alt_set(context_t *ctx);
+bool convert_to_opaque(cell_t *c);
+qsize_t csub_size(qsize_t a,qsize_t b);
+TEST(compose_size);
+TEST(traverse_args);
+qsize_t compose_size_b(csize_t n,qsize_t a,qsize_t c);
+qsize_t compose_size_a(csize_t n,qsize_t b,qsize_t c);
+qsize_t compose_size_c(csize_t n,qsize_t a,qsize_t b);
+bool should_delay(context_t *ctx,priority_t priority);
+bool is_linear(context_t *ctx);
+cell_t *build23(op op,cell_t *i0,cell_t *i1,cell_t **o1,cell_t **o2);
+cell_t *build52(op op,cell_t *i0,cell_t *i1,cell_t *i2,cell_t *i3,cell_t *i4,cell_t **o1);
+cell_t *build42(op op,cell_t *i0,cell_t *i1,cell_t *i2,cell_t *i3,cell_t **o1);
+cell_t *build32(op op,cell_t *i0,cell_t *i1,cell_t *i2,cell_t **o1);
+cell_t *build22(op op,cell_t *i0,cell_t *i1,cell_t **o1);
+cell_t *build12(op op,cell_t *i0,cell_t **o1);
+cell_t *build31(op op,cell_t *i0,cell_t *i1,cell_t *i2);
+cell_t *build21(op op,cell_t *i0,cell_t *i1);
+cell_t *build02(op op,cell_t **o1);
+cell_t *build01(op op);
+bool check_type(type_t requested,type_t expected);
+#define CTX_INHERIT                             \
+  .priority = ctx->priority,                    \
+  .up = ctx,                                    \
+  .inv = ctx->inv,                              \
+  .depth = ctx->depth + 1
+#define CTX_INHERIT_EXP                         \
+  CTX_INHERIT,                                  \
+  .bound = ctx->bound
+#define CTX_UP ((context_t) { .t = ctx->t, .s = { .in = ctx->s.in, .out = ctx->s.out }, CTX_INHERIT_EXP})
+#define CTX_INV(invert) range_singleton(ctx->bound), invert(ctx->bound.min)
+#define CTX_return() ((context_t) { .t = T_RETURN })
+#define CTX_t(...) DISPATCH2(CTX_t, __VA_ARGS__)
+#define CTX_opaque(...) CTX_t(T_OPAQUE, ##__VA_ARGS__)
+#define CTX_string(...) CTX_t(T_STRING, ##__VA_ARGS__)
+#define CTX_symbol(...) CTX_t(T_SYMBOL, ##__VA_ARGS__)
+#define CTX_float(...) CTX_t(T_FLOAT, ##__VA_ARGS__)
+#define CTX_int(...) CTX_t(T_INT, ##__VA_ARGS__)
+#define CTX_any() CTX_t(T_ANY)
+extern range_t default_bound;
+#define CTX_t_3(_t, _expected, _expected_val)                            \
+  ((context_t) { .t = (_t), CTX_INHERIT, .bound = (_expected) ? RANGE(_expected_val) : default_bound })
+#define CTX_t_2(_t, _expected_val)                                          \
+  ((context_t) { .t = (_t), CTX_INHERIT, .bound = { .min = (_expected_val), .max = (_expected_val) } })
+#define CTX_t_1(_t)                                                     \
+  ((context_t) { .t = (_t), CTX_INHERIT, .bound = default_bound })
+#define CTX_list(_in, _out) \
+  ((context_t) { .t = T_LIST, .s = { .in = (_in), .out = (_out) }, CTX_INHERIT})
+bool expected_symbol(context_t *ctx,val_t sym);
+unsigned int new_alt_id(unsigned int n);
+void store_lazy_dep(cell_t *d,cell_t *r,alt_set_t alt_set);
+void use_tmp(location_t use_location);
+cell_t *conc_alt(cell_t *a,cell_t *b);
+void store_reduced(cell_t **cp,context_t *ctx,cell_t *r);
+void store_lazy(cell_t **cp,cell_t *r,alt_set_t alt_set);
+void replace_cell(cell_t **cp,context_t *ctx,cell_t *r);
+void store_dep_var(cell_t *c,cell_t *res,csize_t i,type_t t,range_t r,alt_set_t alt_set);
+void store_dep(cell_t *c,tcell_t *tc,csize_t i,type_t t,range_t r,alt_set_t alt_set);
+void store_fail(cell_t *c,cell_t *alt,context_t *ctx);
+void clean_tmp(cell_t *l);
+#define USE_TMP() use_tmp(LOCATION())
+void update_ready(cell_t *c,cell_t *a);
+cell_t *ready_func(op op,csize_t in,csize_t out);
+cell_t *compose(list_iterator_t it,cell_t *b);
+cell_t *func(op op,csize_t in,csize_t out);
+cell_t *compose_placeholder(cell_t *v,cell_t *ph);
+cell_t *expand_arg_left(cell_t *c,csize_t s);
+cell_t *expand_deps(cell_t *c,csize_t s);
+refcount_t direct_refs(const cell_t *c);
+csize_t count_deps(const cell_t *c);
+cell_t *expand(cell_t *c,csize_t s);
+response abort_op(response rsp,cell_t **cp,context_t *ctx);
+response reduce_one(cell_t **cp,context_t *ctx);
+response simplify_2(cell_t **cp,context_t *ctx);
+#define CTX(type, ...) CONCAT(CTX_, type)(__VA_ARGS__)
+#define simplify_1(cp) simplify_2((cp), &CTX(any))
+#define simplify(...) DISPATCH(simplify, __VA_ARGS__)
+response reduce(cell_t **cp,context_t *ctx);
+#define force_2(cp, ctx) reduce(cp, ctx)
+#define force_1(cp) reduce(cp, &CTX(any))
+#define force(...) DISPATCH(force, __VA_ARGS__)
+COMMAND(errors,"list errors");
+COMMAND(bound,"set default_bound");
+void print_fail_log();
+bool empty_fail_log();
+void log_fail(seg_t src);
+cell_t *arg_nd(cell_t *c,cell_t *a,cell_t *r);
+cell_t *fill_incomplete(cell_t *c);
+response reduce_ptr(cell_t *c,csize_t n,context_t *ctx);
+response reduce_arg(cell_t *c,csize_t n,context_t *ctx);
+void drop_failed(cell_t **p);
+unsigned int update_deps(cell_t *c);
+cell_t *idify(cell_t *c);
+cell_t *forward(cell_t *c,cell_t *a,cell_t *alt);
+bool alt_fork_print();
+bool alt_fork_retry();
+void alt_fork_collect();
+bool alt_fork_take(cell_t *c);
+cell_t *build11(op op,cell_t *i0);
+void alt_fork(cell_t *c,context_t *ctx);
+void alt_fork_stop();
+void alt_fork_start();
+#define ALT_WORKER_RETRY 2 // exit status
+extern bool alt_worker_failed;
+extern bool alt_worker;
+extern THREAD_LOCAL int alt_fork_results;
+void arg(cell_t *c,cell_t *a);
+PARAMETER(alt_jobs,int,1,"worker processes for exploring alternatives (`|`)");
+void alt_fork_kill();
+void done_with_tmp();
+void clear_fail_log();
+void rt_init();
+void stack_free();
+bool stack_available(context_t *ctx);
+void stack_init(void *base);
+int get_watch(const cell_t *c);
+void set_watched_op(op op);
+int set_watch(cell_t *c);
+bool remove_root(cell_t **r);
+bool is_root(const cell_t *c);
+bool insert_root(cell_t **r);
+#define ASSERT_REF() if(ctx->priority > PRIORITY_SIMPLIFY) assert_error(assert_ref(rt_roots, rt_roots_size))
+extern THREAD_LOCAL size_t fail_location_n;
+extern THREAD_LOCAL bool watch_enabled;
+STATIC_ALLOC(rt_roots,cell_t **,257);
+STATIC_ALLOC(fail_location,seg_t,64);
+STATIC_ALLOC(watched_cells,cell_t *,4);
+extern THREAD_LOCAL unsigned int alt_cnt;
+#define MAX_CALL_DEPTH 255 // used if the stack size is unknown
+#define MAX_ALTS 256
+#define INTERFACE 0
@@ -0,0 +1 @@
+/root/repo/rt_types.h
\ No newline at end of file
@@ -0,0 +1,34 @@
+/* This file was automatically generated.  Do not edit! */
+bool is_dep_of(cell_t *d,cell_t *c);
+bool is_string(cell_t const *c);
+seg_t value_seg(const cell_t *c);
+cell_t *make_strcat(seg_t s1,seg_t s2);
+cell_t *make_string(seg_t s);
+cell_t *make_unescaped_string(seg_t s);
+bool is_map(cell_t const *c);
+cell_t *make_map(csize_t s);
+bool _is_dep(cell_t const *c);
+#define is_dep(c) _is_dep(GET_CELL(c))
+#define INTERFACE 0
+cell_t *dep(cell_t *c);
+bool is_placeholder(cell_t const *c);
+bool _is_value(cell_t const *c);
+cell_t *opaque(val_t sym,void *p);
+cell_t *int_val(val_t x);
+cell_t *interned(cell_t const *c);
+cell_t *interned_val(type_t t,val_t x);
+cell_t *imm_val(cell_t *c,type_t t,val_t x);
+cell_t *val(type_t t,val_t x);
+cell_t *set_val(cell_t *c,type_t t,val_t x);
+cell_t *make_val(type_t t);
+#define is_value(c) _is_value(GET_CELL(c))
+void placeholder_extend(cell_t **lp,qsize_t s,bool wrap_var);
+cell_t *symbol(val_t sym);
+cell_t *float_val(double x);
+OP(value);
+OP(forked);
+OP(fail);
+WORD("??",placeholder,0,1)OP(placeholder);
+OP(dep);
+bool ctx_split(cell_t *c,context_t *ctx);
+bool ctx_has_pos(context_t *ctx);
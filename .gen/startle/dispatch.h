@@ -0,0 +1 @@
+/root/repo/startle/dispatch.h
\ No newline at end of file
@@ -0,0 +1,131 @@
+/* This file was automatically generated.  Do not edit! */
+#include <setjmp.h>
+void reset_counters();
+STATIC_ALLOC(counters,unsigned int,8);
+void breakpoint_hook();
+void __attribute__((weak))breakpoint_hook();
+TEST(error);
+enum error_type_e {
+  ERROR_TYPE_NONE = 0,
+  ERROR_TYPE_UNEXPECTED = 1, /**< An assumption was violated, indicating incorrect operation. */
+  ERROR_TYPE_LIMITATION = 2  /**< A known limitation has been reached. */
+};
+typedef enum error_type_e error_type_e;
+typedef enum error_type_e error_type_t;
+void return_error(error_type_t type);
+typedef struct {
+  jmp_buf env;
+  error_type_t type;
+  bool quiet;
+}error_t;
+extern THREAD_LOCAL error_t *current_error;
+#define catch_error(...) DISPATCH(catch_error, __VA_ARGS__)
+#define CATCH(...) SHADOW(current_error) if(catch_error(__VA_ARGS__))
+#define catch_error_2(e, q) (current_error = (e), current_error->quiet = (q), !!setjmp((e)->env))
+#define catch_error_1(e) catch_error_2(e, false)
+void breakpoint();
+#define throw_error(type, fmt, ...)                                     \
+  do {                                                                  \
+    LOG_NO_POS(MARK("!!!") " " __FILE__ ":" STRINGIFY(__LINE__)         \
+                  ": %s: " fmt, __func__ DROP(__VA_ARGS__));            \
+    breakpoint();                                                       \
+    return_error(type);                                                 \
+  } while(0)
+#if defined(NDEBUG)
+#define assert_op(op, x, y) ((void)0)
+#endif
+#if !(defined(NDEBUG))
+#define assert_op(op, x, y)                                     \
+  do {                                                          \
+    __typeof__(x) _x = (x);                                     \
+    __typeof__(y) _y = (y);                                     \
+    if(!(_x op _y)) {                                           \
+      throw_error(ERROR_TYPE_UNEXPECTED,                        \
+                  "Assertion `" #x "' [%d] " #op " `" #y        \
+                  "' [%d] failed.", X, (int)_x, (int)_y);       \
+    }                                                           \
+  } while(0)
+#endif
+#define assert_ge(x, y)  assert_op(>=, x, y)
+#define assert_gt(x, y)  assert_op(>,  x, y)
+#define assert_le(x, y)  assert_op(<=, x, y)
+#define assert_lt(x, y)  assert_op(<,  x, y)
+#define assert_neq(x, y) assert_op(!=, x, y)
+#define assert_eq(x, y)  assert_op(==, x, y)
+unsigned int *alloc_counter();
+#define _assert_counter(n)                                               \
+  do {                                                                   \
+    static THREAD_LOCAL unsigned int *counter = NULL;                    \
+    if(!counter) counter = alloc_counter();                              \
+    if(*counter > (n)) {                                                 \
+      throw_error(ERROR_TYPE_UNEXPECTED,                                 \
+                  "Assertion counter exhausted: %d > " #n, X, *counter); \
+    }                                                                    \
+    (*counter)++;                                                        \
+  } while(0)
+#if defined(NDEBUG)
+#define assert_counter(n) ((void)0)
+#endif
+#if !(defined(NDEBUG))
+#define assert_counter(n) _assert_counter(n)
+#endif
+#define assert_msg(...) DISPATCH(assert_msg, ##__VA_ARGS__)
+#define _assert_warn(cond, ...)                 \
+  do {                                          \
+    if(!(cond)) {                               \
+      LOG(MARK("WARN") " "                      \
+          assert_msg(cond_str, ##__VA_ARGS__)   \
+          DROP(__VA_ARGS__));                   \
+      breakpoint();                             \
+    }                                           \
+  } while(0)
+#if defined(NDEBUG)
+#define assert_warn(...) ((void)0)
+#endif
+#if !(defined(NDEBUG))
+#define assert_warn(cond, ...) _assert_warn(cond, #cond, __VA_ARGS__)
+#endif
+#define _on_assert_error(cond, cond_str, ...)                   \
+  for(;!(cond);                                                 \
+      ({throw_error(ERROR_TYPE_UNEXPECTED,                      \
+                    assert_msg(cond_str, ##__VA_ARGS__),        \
+                    ##__VA_ARGS__);}))
+#if defined(NDEBUG)
+#define on_assert_error(...) if(0)
+#endif
+#if !(defined(NDEBUG))
+#define on_assert_error(cond, ...) _on_assert_error(cond, #cond, __VA_ARGS__)
+#endif
+#define _assert_error(cond, cond_str, ...)              \
+  do {                                                  \
+    if(!(cond)) {                                       \
+      throw_error(ERROR_TYPE_UNEXPECTED,                \
+                  assert_msg(cond_str, ##__VA_ARGS__),  \
+                  ##__VA_ARGS__);                       \
+    }                                                   \
+  } while(0)
+#if defined(NDEBUG)
+#define assert_error(...) ((void)0)
+#endif
+#if !(defined(NDEBUG))
+#define assert_error(cond, ...) _assert_error(cond, #cond, __VA_ARGS__)
+#endif
+#define assert_throw(cond, ...)                         \
+  do {                                                  \
+    if(!(cond)) {                                       \
+      throw_error(ERROR_TYPE_LIMITATION,                \
+                  assert_msg(#cond, ##__VA_ARGS__),     \
+                  ##__VA_ARGS__);                       \
+    }                                                   \
+  } while(0)
+#define assert_msg_2(cond, fmt, ...) "Assertion `" cond "' failed: " fmt
+#define assert_msg_10(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_9(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_8(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_7(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_6(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_5(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_4(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_3(cond, fmt, ...) assert_msg_2(cond, fmt)
+#define assert_msg_1(cond, ...) "Assertion `" cond "' failed."
+#define INTERFACE 0
@@ -0,0 +1,118 @@
+/* This file was automatically generated.  Do not edit! */
+void log_unset_tweak();
+typedef char tag_t[5];
+void log_set_tweak(const tag_t tag,intptr_t value,bool after);
+bool log_do_tweak(intptr_t *x,char *fmt);
+#define LOG_NO_POS(...) FORARG(LOG, __VA_ARGS__)
+#define LOG(fmt, ...) LOG_NO_POS(__FILE__ ":" STRINGIFY(__LINE__) ": " fmt, ##__VA_ARGS__)
+#define TWEAK(default_value, fmt, ...)                          \
+  ({                                                            \
+    const char *__c;                                            \
+    intptr_t __x;                                               \
+    bool __t;                                                   \
+    if unlikely(__t = log_do_tweak(&__x, fmt)) {                \
+      __c = COLOR_blue;                                         \
+    } else {                                                    \
+      __x = (default_value);                                    \
+      __c = COLOR_normal;                                       \
+    }                                                           \
+    LOG(COLORs("TWEAK(%d)") " " fmt, __c, __x, ##__VA_ARGS__);  \
+    if(__t) breakpoint();                                       \
+    __x;                                                        \
+  })
+void get_tag(tag_t tag);
+extern const unsigned int tag_mask;
+extern const unsigned int tag_factor_inverse;
+extern const unsigned int tag_factor;
+int gather_bits(int y);
+int spread_bits(int x);
+int from_tag_char(char c);
+char to_tag_char(int x);
+#define CONTEXT_LOG(fmt, ...) FORARG(CONTEXT_LOG, __FILE__ ":" STRINGIFY(__LINE__) ": " fmt, ##__VA_ARGS__)
+#define CONTEXT_LOG_args ("\xff\x40", "\xff\x41", "\xff\x42", "\xff\x43", "\xff\x44", "\xff\x45", "\xff\x46", "\xff\x47", "\xff\x48")
+#define CONTEXT_LOG_post                        \
+  } while(0)
+bool log_add_only(intptr_t x);
+#define CONTEXT_LOG_only(s, fmt)                                \
+  __context = s fmt;                                            \
+  if(log_add_only((intptr_t)(__context + 1))) breakpoint();
+bool log_add_last(intptr_t x);
+#define CONTEXT_LOG_last(x)                     \
+  if(log_add_last((intptr_t)(x))) breakpoint();
+void log_add(intptr_t x);
+#define CONTEXT_LOG_middle(x)                   \
+  log_add((intptr_t)(x));
+void log_add_first(intptr_t x);
+#define CONTEXT_LOG_first(s, fmt)               \
+  __context = s fmt;                            \
+  log_add_first((intptr_t)(__context + 1));
+void log_cleanup_context_log(const char **fmt);
+void log_add_context();
+#define CONTEXT_LOG_pre                                                 \
+  const char *__context __attribute__((cleanup(log_cleanup_context_log))); \
+  do {                                                                  \
+    log_add_context();
+#define CONTEXT(fmt, ...) FORARG(CONTEXT, __FILE__ ":" STRINGIFY(__LINE__) ": " fmt, ##__VA_ARGS__)
+#define CONTEXT_args ("\xff\xc0", "\xff\xc1", "\xff\xc2", "\xff\xc3", "\xff\xc4", "\xff\xc5", "\xff\xc6", "\xff\xc7", "\xff\xc8")
+typedef struct log_context log_context;
+struct log_context {
+  struct log_context *next;
+  char const *fmt;
+  intptr_t arg[0];
+};
+typedef struct log_context log_context_t;
+extern THREAD_LOCAL log_context_t *__log_context;
+#define CONTEXT_post                            \
+  __log_context = (log_context_t *)__context;
+#define CONTEXT_only(s, fmt) (intptr_t)(s fmt) + 1};
+#define CONTEXT_last(x) (intptr_t)(x)};
+#define CONTEXT_middle(x) (intptr_t)(x),
+#define CONTEXT_first(s, fmt) (intptr_t)(s fmt) + 1,
+void log_cleanup_context(void *p);
+#define CONTEXT_pre                             \
+  __attribute__((cleanup(log_cleanup_context))) \
+  intptr_t __context[] = {                      \
+    (intptr_t)__log_context,
+TEST(log);
+TEST(tag);
+TEST(spread_gather_bits);
+TEST(log_context);
+#define LOG_NOBREAK(fmt, ...) FORARG(LOG_NOBREAK, __FILE__ ":" STRINGIFY(__LINE__) ": " fmt, ##__VA_ARGS__)
+#define LOG_args ("\x00", "\x01", "\x02", "\x03", "\x04", "\x05", "\x06", "\x07", "\x08")
+#define LOG_NOBREAK_args LOG_args
+#define LOG_NOBREAK_post                        \
+  } while(0)
+#define LOG_NOBREAK_only(s, fmt) log_add_only((intptr_t)(s fmt));
+#define LOG_NOBREAK_last(x) log_add_last((intptr_t)(x));
+#define LOG_NOBREAK_middle(x) log_add((intptr_t)(x));
+#define LOG_NOBREAK_first(s, fmt) log_add_first((intptr_t)(s fmt));
+#define LOG_NOBREAK_pre                         \
+  do {                                          \
+    log_add_context();
+#define LOG_UNLESS(test, fmt, ...) ((test) || (({ LOG(fmt, ##__VA_ARGS__); }), false))
+#define LOG_WHEN(test, fmt, ...) ((test) && (({ LOG(fmt, ##__VA_ARGS__); }), true))
+#define LOG_post                                \
+  } while(0)
+#define LOG_only(s, fmt) if(log_add_only((intptr_t)(s fmt))) breakpoint();
+#define LOG_last(x) if(log_add_last((intptr_t)(x))) breakpoint();
+#define LOG_middle(x) log_add((intptr_t)(x));
+#define LOG_first(s, fmt) log_add_first((intptr_t)(s fmt));
+#define LOG_pre                                 \
+  do {                                          \
+    log_add_context();
+#define INTERFACE 0
+void log_scan_tags();
+void log_print_all();
+void print_last_log_msg();
+void print_context(size_t s);
+unsigned int log_find_context(unsigned int *ca,unsigned int size);
+unsigned int log_depth();
+#define FORMAT_TAG "%.5s"
+void write_tag(tag_t tag,unsigned int val);
+void log_soft_init();
+void set_log_watch_range(const tag_t tag_from,const char *tag_to);
+int read_tag(const tag_t tag);
+void set_log_watch(const tag_t tag,bool after);
+void log_init();
+STATIC_ALLOC(log_data,intptr_t,1<<12);
+STATIC_ALLOC(hash_tag_set,uintptr_t,63);
@@ -0,0 +1 @@
+/root/repo/startle/macros.h
\ No newline at end of file
@@ -0,0 +1,84 @@
+/* This file was automatically generated.  Do not edit! */
+typedef pair_t *map_t;
+map_t init_map(pair_t *mem,size_t n);
+pair_t *_find_test(map_t map,char *name,uintptr_t key);
+map_t alloc_map(uintptr_t size);
+typedef bool(cmp_t)(uintptr_t,uintptr_t);
+bool hmap_remove(map_t map,uintptr_t key);
+bool hmap_insert(map_t map,pair_t x);
+bool hmap_replace_insert(map_t map,pair_t x);
+pair_t *hmap_find(map_t map,uintptr_t key);
+void hmap_clear(map_t map);
+#define MAP(name, size) pair_t name[(size) + 1] = {{(size), 0}}
+#define HMAP(name, size) MAP(name, size)
+void _print_string_map(char *name,map_t map);
+#define print_string_map(map) _print_string_map(#map, map)
+void _print_map(char *name,map_t map);
+pair_t *map_find_value(map_t map,uintptr_t value);
+pair_t *seg_map_find(map_t map,seg_t key);
+pair_t *string_map_find(map_t map,const char *key);
+uintptr_t map_get(map_t map,uintptr_t key);
+pair_t *map_find_sorted(map_t map,uintptr_t key);
+pair_t *map_find_recent(map_t map,uintptr_t key);
+typedef struct {
+  pair_t *elems;
+  uintptr_t key, x, bit, a;
+  size_t est;
+}map_iterator;
+pair_t *map_next(map_iterator *it,pair_t *prev);
+pair_t *map_find_iter(map_iterator *it);
+map_iterator map_iterator_begin(map_t map,uintptr_t key);
+bool string_map_replace_insert(map_t map,pair_t x);
+bool map_replace_insert(map_t map,pair_t x);
+pair_t *map_find(map_t map,uintptr_t key);
+bool string_map_union(map_t a,map_t b);
+bool map_union(map_t a,map_t b);
+bool _map_union(map_t a,map_t b,cmp_t cmp);
+bool string_map_merge(map_t map,pair_t *x,size_t n);
+bool map_merge(map_t map,pair_t *x,size_t n);
+bool check_order(pair_t *elems,size_t size,cmp_t cmp);
+bool check_map(map_t map,cmp_t cmp);
+bool string_map_insert(map_t map,pair_t x);
+bool map_insert(map_t map,pair_t x);
+#define print_map(map) _print_map(#map, map)
+void string_map_sort_full(map_t map);
+void map_sort_full(map_t map);
+pair_t *map_elems(map_t map);
+void map_clear(map_t map);
+size_t *map_cnt(map_t map);
+size_t map_size(map_t map);
+void merge_huang88(pair_t *arr,pair_t *b,size_t n,cmp_t cmp);
+void bubble_sort(pair_t *arr,size_t n,cmp_t cmp);
+void merge_with_buffer_fast(pair_t *a,pair_t *b,size_t n,cmp_t cmp,pair_t *buf);
+void test_pairs(pair_t *arr,size_t n,size_t a,unsigned int s);
+size_t merge_into_buffer(pair_t **pbuffer,pair_t **pa,pair_t *b,size_t n,cmp_t cmp);
+void merge_with_buffer(pair_t *a,pair_t *b,size_t n,cmp_t cmp,pair_t *buf);
+void merge_right_short(pair_t *a,pair_t *b,size_t n,cmp_t cmp);
+void merge_left_short(pair_t *a,pair_t *b,size_t n,cmp_t cmp);
+void rotate(pair_t *a,pair_t *b,size_t n);
+void merge(pair_t *arr,pair_t *b,size_t n,cmp_t cmp);
+TEST(merge_left_short);
+TEST(string_map);
+TEST(rotate);
+TEST(map_stack_behavior);
+TEST(map);
+TEST(bench_hmap);
+TEST(hmap);
+TEST(map_iterate);
+TEST(map_merge);
+TEST(map_union);
+TEST(map_sort_full);
+TEST(merge);
+TEST(merge_huang88b);
+TEST(merge_huang88);
+TEST(merge_with_buffer_fast);
+TEST(merge_into_buffer);
+TEST(merge_with_buffer2);
+TEST(merge_with_buffer);
+TEST(merge_right_short);
+bool key_cmp(uintptr_t a,uintptr_t b);
+bool is_ordered(pair_t *arr,size_t n,cmp_t cmp);
+size_t isqrt(size_t x);
+void reverse(pair_t *a,size_t n);
+void swap_block(pair_t *a,pair_t *b,size_t n);
+#define INTERFACE 0
@@ -0,0 +1,12 @@
+/* This file was automatically generated.  Do not edit! */
+char *list_static_addresses();
+STATIC_ALLOC(static_address_buffer,char,4096);
+void print_static_alloc(const void *_p);
+void list_static_sizes();
+size_t get_mem_size();
+void static_alloc_init();
+void static_alloc_reinit();
+size_t align_offset(size_t n,int a);
+TEST(align_offset);
+#define static_sizeof(name) (sizeof(*name) * name##_size)
+#define INTERFACE 0
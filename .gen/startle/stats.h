@@ -0,0 +1,33 @@
+/* This file was automatically generated.  Do not edit! */
+void stats_reset_counters();
+#if STATS
+extern THREAD_LOCAL stats_counter __stats_counter;
+#define TAKE(name)                              \
+  ({                                            \
+    long long int tmp = __stats_counter.name;   \
+    __stats_counter.name = 0;                   \
+    tmp;                                        \
+  })
+#endif
+#if !(STATS)
+#define TAKE(name) (0)
+#endif
+#if STATS
+#define GET_COUNTER(name) (__stats_counter.name)
+#endif
+#if !(STATS)
+#define GET_COUNTER(name) (0)
+#endif
+#if STATS
+#define COUNTER_MAX(name, n) (__stats_counter.name = max(__stats_counter.name, (n)))
+#endif
+#if !(STATS)
+#define COUNTER_MAX(name, n)
+#endif
+#if STATS
+#define COUNTER(name, n) (__stats_counter.name += (n))
+#endif
+#if !(STATS)
+#define COUNTER(name, n)
+#endif
+#define INTERFACE 0
@@ -0,0 +1 @@
+/root/repo/startle/stats_types.h
\ No newline at end of file
@@ -0,0 +1,148 @@
+/* This file was automatically generated.  Do not edit! */
+#include <stdio.h>
+int count_char(const char *str,char c);
+const char *suffix(const char *str,char c);
+seg_t pair_seg(pair_t p);
+pair_t seg_pair(seg_t seg);
+size_t flatten_ranges(uintptr_t *l,uintptr_t *r,pair_t *res,size_t n);
+seg_t seg_range(seg_t a,seg_t b);
+intptr_t sat_muli(intptr_t x,intptr_t y);
+intptr_t sat_mul(intptr_t x,intptr_t y);
+intptr_t sat_addi(intptr_t x,intptr_t y);
+intptr_t sat_negi(intptr_t x);
+intptr_t sat_neg(intptr_t x);
+intptr_t sat_abs(intptr_t x);
+intptr_t div_i(intptr_t n,intptr_t d);
+intptr_t div_maxi(intptr_t n,intptr_t d);
+intptr_t sat_add(intptr_t x,intptr_t y);
+intptr_t div_max(intptr_t n,intptr_t d);
+intptr_t div_mini(intptr_t n,intptr_t d);
+intptr_t sat_sub(intptr_t x,intptr_t y);
+intptr_t div_min(intptr_t n,intptr_t d);
+intptr_t sign(intptr_t x);
+bool range_partially_bounded(range_t a);
+range_t range_bits(int b);
+bool range_bounded(range_t a);
+bool range_has_upper_bound(range_t a);
+bool range_has_lower_bound(range_t a);
+intptr_t sat_subi(intptr_t x,intptr_t y);
+intptr_t range_span(range_t a);
+bool range_eq(range_t a,range_t b);
+#define RANGE(...) DISPATCH(RANGE, __VA_ARGS__)
+#define RANGE_2(lo, hi) ((range_t) { .min = (lo), .max = (hi) })
+#define RANGE_1(x)                              \
+  ({                                            \
+    __typeof__(x) __x = (x);                    \
+    (range_t) { .min = __x, .max = __x };       \
+  })
+bool range_singleton(range_t a);
+range_t range_union(range_t a,range_t b);
+bool range_empty(range_t a);
+range_t range_intersect(range_t a,range_t b);
+char capitalize(char c);
+const char *seg_find_char(seg_t haystack,char needle);
+const char *seg_find(seg_t haystack,seg_t needle);
+typedef struct ring_buffer ring_buffer;
+struct ring_buffer {
+  size_t head, tail, size;
+  char data[0];
+};
+typedef struct ring_buffer ring_buffer_t;
+size_t rb_read(ring_buffer_t *rb,char *dst,size_t size);
+size_t rb_write(ring_buffer_t *rb,const char *src,size_t size);
+void rb_clear(ring_buffer_t *rb);
+size_t rb_capacity(const ring_buffer_t *rb);
+size_t rb_available(const ring_buffer_t *rb);
+ring_buffer_t *rb_init(char *mem,size_t n);
+#define APPEND_DATA_TO(_type, _size)            \
+  struct {                                      \
+    _type hdr;                                  \
+    char data[_size];                           \
+  }
+#define RING_BUFFER(_size)                      \
+  ((ring_buffer_t *)                            \
+   &(APPEND_DATA_TO(ring_buffer_t, _size))      \
+  {{ .size = _size }, {0}})
+bool eq_seg(seg_t a,seg_t b);
+void print_escaped_string(seg_t str,bool xml);
+void fprintf_escaped_string(FILE *f,seg_t str,bool xml);
+size_t escape_string(char *dst,size_t n,seg_t str,bool xml);
+size_t unescape_string(char *dst,size_t n,seg_t str);
+int strnum(const char *s,size_t n,int base);
+char digit(int n);
+int digit_value(char c);
+seg_t seg_trim(seg_t s);
+bool is_whitespace(char c);
+char *replace_all_char(char *s,char c_old,char c_new);
+char *replace_char(char *s,char c_old,char c_new);
+int next_bit(uintptr_t *mask);
+int ctz(uintptr_t x);
+uintptr_t nonzero_hash(const char *str,size_t len);
+bool is_letter(char c);
+char *arguments(int argc,char **argv);
+void reverse_ptrs(void **a,size_t n);
+void swap_ptrs(void **x,void **y);
+bool set_remove(uintptr_t x,uintptr_t *set,size_t size);
+bool set_member(uintptr_t x,uintptr_t *set,size_t size);
+size_t squeeze(uintptr_t *set,size_t size);
+bool set_insert(uintptr_t x,uintptr_t *set,size_t size);
+unsigned int int_log2l(long unsigned int x);
+unsigned int int_log2(unsigned int x);
+bool find_line(const char *x,const char **s,size_t *size);
+size_t line_number(const char *s,const char *e);
+typedef struct mmfile mmfile;
+bool munmap_file(struct mmfile *f);
+bool mmap_file(struct mmfile *f);
+struct mmfile {
+  int dirfd; /**< Directory file descriptor */
+  const char *path; /**< File path */
+  int fd; /**< File descriptor */
+  size_t size; /**< Size in bytes, set by mmap_file */
+  char *data; /**< Pointer to char data, set by mmap_file */
+  bool read_only; /**< True if read-only */
+};
+void *lookup_linear(void *table,size_t width,size_t rows,seg_t key_seg);
+void *lookup(void *table,size_t width,size_t rows,seg_t key_seg);
+seg_t string_seg(const char *str);
+bool seg_adjacent(seg_t a,seg_t b);
+seg_t seg_after(seg_t s,char c);
+size_t seg_read(seg_t seg,char *str,size_t size);
+const char *seg_end(seg_t seg);
+pair_t *find_last_seg(pair_t *array,size_t size,seg_t key);
+char seg_char(seg_t seg);
+int segcmp(const char *str,seg_t seg);
+pair_t *find_last_string(pair_t *array,size_t size,const char *key);
+pair_t *find_last(pair_t *array,size_t size,uintptr_t key,size_t *est);
+pair_t *find(pair_t *array,size_t size,uintptr_t key);
+void quicksort(void *array,size_t width,size_t size);
+TEST(sort);
+TEST(count_char);
+TEST(suffix);
+TEST(flatten_ranges);
+TEST(seg_range);
+TEST(sat_arith);
+TEST(div_min_max);
+TEST(seg_find_char);
+TEST(seg_find);
+TEST(ring_buffer);
+TEST(append_data_to);
+TEST(print_escaped_string);
+TEST(escape_string);
+TEST(unescape_string);
+TEST(strnum);
+TEST(seg_trim);
+TEST(replace_char);
+TEST(set);
+TEST(mmap_file);
+TEST(lookup);
+void print_string_pairs(pair_t *array,size_t len);
+void print_pairs(pair_t *array,size_t len);
+void swap(pair_t *x,pair_t *y);
+unsigned int median3(void *array,size_t width,size_t lo,size_t hi);
+#define RANGE_POS_INIT { .min = 0, .max = INTPTR_MAX }
+#define RANGE_POS ((range_t)RANGE_POS_INIT)
+#define RANGE_NONE_INIT { .min = INTPTR_MAX, .max = INTPTR_MIN }
+#define RANGE_NONE ((range_t)RANGE_NONE_INIT)
+#define RANGE_ALL_INIT { .min = INTPTR_MIN, .max = INTPTR_MAX }
+#define RANGE_ALL ((range_t)RANGE_ALL_INIT)
+#define INTERFACE 0
@@ -0,0 +1,11 @@
+/* This file was automatically generated.  Do not edit! */
+TEST(loops);
+TEST(for_mask);
+TEST(macro_math);
+TEST(shadow);
+TEST(oneof);
+TEST(inrange);
+TEST(macro_dispatch);
+TEST(next_bit);
+TEST(formask);
+int run_test(seg_t name);
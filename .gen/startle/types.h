@@ -0,0 +1 @@
+/root/repo/startle/types.h
\ No newline at end of file
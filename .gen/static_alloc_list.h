@@ -0,0 +1,33 @@
+STATIC_ALLOC__ITEM(ir_trace, 69, active_entries, tcell_t *, 1 << 4)
+STATIC_ALLOC_DEPENDENT__ITEM(ir_trace, 70, active_entry_gen, uintptr_t, active_entries_size)
+STATIC_ALLOC__ITEM(gen_cgen, 43, assert_set, uintptr_t, 67)
+STATIC_ALLOC__ITEM(startle_error, 258, counters, unsigned int, 8)
+STATIC_ALLOC__ITEM(ir_compile, 429, cse_map, pair_t, 1 << 10)
+STATIC_ALLOC__ITEM(cells, 591, drop_stack, cell_t *, 1 << 12)
+STATIC_ALLOC__ITEM(ir_deps, 47, entry_callers, pair_t, 1 << 14)
+STATIC_ALLOC__ITEM(ir_deps, 46, entry_defs, pair_t, 1 << 12)
+STATIC_ALLOC__ITEM(gen_cgen, 770, expand_sym_buf, char, 128)
+STATIC_ALLOC__ITEM(rt, 78, fail_location, seg_t, 64)
+STATIC_ALLOC__ITEM(eval, 862, files, struct mmfile, 16)
+STATIC_ALLOC__ITEM(cells, 597, free_batch, pair_t, 1 << 10)
+STATIC_ALLOC__ITEM(startle_log, 65, hash_tag_set, uintptr_t, 63)
+STATIC_ALLOC__ITEM(io, 124, input_buf, char, 1024)
+STATIC_ALLOC__ITEM(eval, 102, line_buffer, char, 1024)
+STATIC_ALLOC__ITEM(startle_log, 48, log_data, intptr_t, 1 << 12)
+STATIC_ALLOC__ITEM(debug_log_tree, 33, log_tree_map, pair_t, 256)
+STATIC_ALLOC__ITEM(primitive_io, 219, mmap_array, mmap_array_t, 8)
+STATIC_ALLOC__ITEM(eval, 235, path_buffer, char, 64)
+STATIC_ALLOC__ITEM(rt, 72, rt_roots, cell_t **, 257)
+STATIC_ALLOC__ITEM(ir_trace, 90, shared_entries, pair_t, 1 << 12)
+STATIC_ALLOC__ITEM(startle_static_alloc, 216, static_address_buffer, char, 4096)
+STATIC_ALLOC__ITEM(io, 53, stdin_ring_buffer, char, sizeof(ring_buffer_t) + 1024)
+STATIC_ALLOC__ITEM(parse_parse, 76, strings, char, 1 << 14)
+STATIC_ALLOC__ITEM(ir_trace, 86, switch_map, pair_t, 64)
+STATIC_ALLOC__ITEM(ir_trace, 87, switch_rev_map, pair_t, 64)
+STATIC_ALLOC_DEPENDENT__ITEM(parse_parse, 48, symbol_index, const char *, symbols_size)
+STATIC_ALLOC__ITEM(parse_parse, 62, symbols, pair_t, 64)
+STATIC_ALLOC__ITEM(debug_tags, 25, tags_map, pair_t, 256)
+STATIC_ALLOC__ITEM(gen_vlgen, 49, vl_outputs, uintptr_t, 16)
+STATIC_ALLOC__ITEM(gen_vlgen, 47, vl_set, uintptr_t, 31)
+STATIC_ALLOC_DEPENDENT__ITEM(gen_vlgen, 48, vl_set_final, uintptr_t, vl_set_size)
+STATIC_ALLOC__ITEM(rt, 74, watched_cells, cell_t *, 4)
@@ -0,0 +1,87 @@
+TEST__ITEM(startle_static_alloc, 86, align_offset)
+TEST__ITEM(cells, 1048, alloc)
+TEST__ITEM(cells, 971, alt_sets)
+TEST__ITEM(startle_support, 986, append_data_to)
+TEST__ITEM(cgen_primitives, 302, arr_cow)
+TEST__ITEM(cgen_primitives, 287, arr_shift)
+TEST__ITEM(primitive_io, 367, array)
+TEST__ITEM(primitive_io, 397, bench_array)
+TEST__ITEM(startle_map, 1282, bench_hmap)
+TEST__ITEM(cells, 1077, cells_grow)
+TEST__ITEM(cells, 1061, coalesce)
+TEST__ITEM(parse_tok, 122, comments)
+TEST__ITEM(rt, 1521, compose_size)
+TEST__ITEM(startle_support, 1465, count_char)
+TEST__ITEM(startle_support, 1251, div_min_max)
+TEST__ITEM(startle_error, 225, error)
+TEST__ITEM(startle_support, 932, escape_string)
+TEST__ITEM(module, 279, expand_map)
+TEST__ITEM(gen_cgen, 745, expand_sym)
+TEST__ITEM(list, 389, flat_copy_list)
+TEST__ITEM(startle_support, 1414, flatten_ranges)
+TEST__ITEM(list, 425, flattened_list_copy)
+TEST__ITEM(startle_test, 188, for_mask)
+TEST__ITEM(startle_test, 111, formask)
+TEST__ITEM(list, 534, function_in)
+TEST__ITEM(startle_map, 1247, hmap)
+TEST__ITEM(startle_test, 148, inrange)
+TEST__ITEM(ir_trace, 1776, large_entry)
+TEST__ITEM(parse_lex, 95, lex)
+TEST__ITEM(list, 284, list_next)
+TEST__ITEM(list, 319, list_remaining_size)
+TEST__ITEM(startle_log, 477, log)
+TEST__ITEM(startle_log, 609, log_context)
+TEST__ITEM(startle_support, 371, lookup)
+TEST__ITEM(startle_test, 75, loops)
+TEST__ITEM(startle_test, 139, macro_dispatch)
+TEST__ITEM(startle_test, 176, macro_math)
+TEST__ITEM(startle_map, 1329, map)
+TEST__ITEM(startle_map, 997, map_iterate)
+TEST__ITEM(startle_map, 912, map_merge)
+TEST__ITEM(startle_map, 765, map_sort_full)
+TEST__ITEM(startle_map, 1370, map_stack_behavior)
+TEST__ITEM(startle_map, 884, map_union)
+TEST__ITEM(cgen_primitives, 181, mem_release)
+TEST__ITEM(startle_map, 663, merge)
+TEST__ITEM(startle_map, 631, merge_huang88)
+TEST__ITEM(startle_map, 640, merge_huang88b)
+TEST__ITEM(startle_map, 427, merge_into_buffer)
+TEST__ITEM(startle_map, 285, merge_left_short)
+TEST__ITEM(startle_map, 310, merge_right_short)
+TEST__ITEM(startle_map, 380, merge_with_buffer)
+TEST__ITEM(startle_map, 392, merge_with_buffer2)
+TEST__ITEM(startle_map, 491, merge_with_buffer_fast)
+TEST__ITEM(startle_support, 475, mmap_file)
+TEST__ITEM(module, 449, module_lookup)
+TEST__ITEM(startle_test, 122, next_bit)
+TEST__ITEM(startle_test, 155, oneof)
+TEST__ITEM(parse_parse, 407, parse_def)
+TEST__ITEM(io, 111, parse_file_prefix)
+TEST__ITEM(parse_parse, 451, parse_module)
+TEST__ITEM(cgen_primitives, 480, prim_to_string)
+TEST__ITEM(startle_support, 957, print_escaped_string)
+TEST__ITEM(ir_deps, 286, reload_module)
+TEST__ITEM(startle_support, 741, replace_char)
+TEST__ITEM(startle_support, 1049, ring_buffer)
+TEST__ITEM(startle_map, 1391, rotate)
+TEST__ITEM(startle_support, 1290, sat_arith)
+TEST__ITEM(startle_support, 1073, seg_find)
+TEST__ITEM(startle_support, 1093, seg_find_char)
+TEST__ITEM(startle_support, 1364, seg_range)
+TEST__ITEM(startle_support, 769, seg_trim)
+TEST__ITEM(startle_support, 631, set)
+TEST__ITEM(startle_test, 163, shadow)
+TEST__ITEM(startle_support, 118, sort)
+TEST__ITEM(startle_log, 677, spread_gather_bits)
+TEST__ITEM(parse_tok, 148, string_literal)
+TEST__ITEM(startle_map, 1417, string_map)
+TEST__ITEM(parse_parse, 119, strings)
+TEST__ITEM(startle_support, 806, strnum)
+TEST__ITEM(startle_support, 1449, suffix)
+TEST__ITEM(startle_log, 719, tag)
+TEST__ITEM(eval, 1373, thread_eval)
+TEST__ITEM(ir_trace, 558, trace_encode)
+TEST__ITEM(rt, 1546, traverse_args)
+TEST__ITEM(startle_support, 855, unescape_string)
+TEST__ITEM(var, 368, var_count)
+TEST__ITEM(ir_vm, 354, vm)
@@ -0,0 +1,23 @@
+/* This file was automatically generated.  Do not edit! */
+bool is_self_call(const tcell_t *e,const tcell_t *c);
+void reduce_quote(cell_t **cp);
+OP(exec);
+bool is_specialized_to(tcell_t *entry,cell_t *c);
+bool is_input(cell_t *v);
+cell_t *wrap_vars(cell_t **res,cell_t *p,uintptr_t dep_mask,csize_t out);
+cell_t *flat_call(cell_t *c,tcell_t *entry);
+void reassign_input_order(tcell_t *entry);
+void vars_in_entry(cell_t **p,tcell_t *entry);
+cell_t **input_var_list(cell_t *c,cell_t **tail);
+void reassign_deps(cell_t *c,cell_t *r);
+response unify_exec(cell_t **cp,context_t *ctx);
+cell_t **bind_pattern(tcell_t *entry,cell_t **cp,cell_t *pattern,cell_t **tail);
+void print_word_pattern(cell_t *word);
+void print_bindings(cell_t *vl);
+void print_pattern(cell_t *pattern);
+cell_t *apply_list(cell_t *l,csize_t in,csize_t out);
+const tcell_t *closure_entry_const(const cell_t *c);
+tcell_t *closure_entry(cell_t *c);
+bool _is_user_func(const cell_t *c);
+#define is_user_func(c) _is_user_func(GET_CELL(c))
+#define INTERFACE 0
@@ -0,0 +1,36 @@
+/* This file was automatically generated.  Do not edit! */
+cell_t *param(int t,tcell_t *entry);
+tcell_t *trace_alloc_var(tcell_t *entry,type_t t);
+TEST(var_count);
+size_t tmp_list_length(cell_t *c);
+cell_t **trace_var_list(cell_t *c,cell_t **tail);
+cell_t *trace_quote_var(tcell_t *entry,cell_t *l);
+#define add_conditions_var(...) DISPATCH(add_conditions_var, __VA_ARGS__)
+#define add_conditions(...) DISPATCH(add_conditions, __VA_ARGS__)
+void add_conditions_var_3(cell_t *res,tcell_t *t,cell_t *a0);
+void add_conditions_var_2(cell_t *res,tcell_t *t);
+void add_conditions_from_array(cell_t *res,cell_t **a,unsigned int n);
+void add_conditions_6(cell_t *res,cell_t *a0,cell_t *a1,cell_t *a2,cell_t *a3,cell_t *a4);
+void add_conditions_5(cell_t *res,cell_t *a0,cell_t *a1,cell_t *a2,cell_t *a3);
+void add_conditions_4(cell_t *res,cell_t *a0,cell_t *a1,cell_t *a2);
+void add_conditions_3(cell_t *res,cell_t *a0,cell_t *a1);
+void add_conditions_2(cell_t *res,cell_t *a0);
+tcell_t *value_condition(cell_t *a);
+void reserve_condition(tcell_t **p);
+int copy_conditions(tcell_t *entry,int i,int v);
+bool has_asserted(tcell_t *entry,int x,int y);
+bool depends_on(tcell_t *entry,int x,int y);
+tcell_t *concatenate_conditions(tcell_t *a,tcell_t *b);
+void apply_condition(cell_t *c,int *x);
+bool _is_var(cell_t const *c);
+#define INTERFACE 0
+cell_t *opaque_var(cell_t *c,val_t sym);
+tcell_t *infer_entry(cell_t *c);
+cell_t *var_create_with_entry(type_t t,tcell_t *entry,csize_t size);
+cell_t *var(type_t t,cell_t *c);
+range_t get_range(cell_t *c);
+#define is_var(c) _is_var(GET_CELL(c))
+cell_t *var_create_bound(cell_t *v,tcell_t *tc,const context_t *ctx);
+cell_t *var_create_list(cell_t *f,int in,int out,int shift,bool row);
+cell_t *var_create_nonlist(type_t t,tcell_t *tc);
+cell_t *var_create(type_t t,tcell_t *tc,int in,int out);
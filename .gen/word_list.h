@@ -0,0 +1,75 @@
+WORD__ITEM(primitive_core, 88, "!", assert, 2, 1)
+WORD__ITEM(primitive_arithmetic, 662, "!:=", neq_s, 2, 1)
+WORD__ITEM(primitive_arithmetic, 656, "!=", neq, 2, 1)
+WORD__ITEM(primitive_other, 139, "#row", row_id, 1, 1)
+WORD__ITEM(primitive_arithmetic, 458, "%", mod, 2, 1)
+WORD__ITEM(primitive_arithmetic, 549, "&b", bitand, 2, 1)
+WORD__ITEM(primitive_arithmetic, 359, "*", mul, 2, 1)
+WORD__ITEM(primitive_arithmetic, 496, "*f", mul_float, 2, 1)
+WORD__ITEM(primitive_arithmetic, 342, "+", add, 2, 1)
+WORD__ITEM(primitive_string, 35, "++", strcat, 2, 1)
+WORD__ITEM(primitive_arithmetic, 490, "+f", add_float, 2, 1)
+WORD__ITEM(primitive_arithmetic, 410, "-", sub, 2, 1)
+WORD__ITEM(primitive_other, 123, "--inline", annotate_inline, 1, 1)
+WORD__ITEM(primitive_other, 114, "--partial", partial, 1, 1)
+WORD__ITEM(primitive_string, 123, "->bin", to_string_bin, 1, 1)
+WORD__ITEM(primitive_arithmetic, 667, "->f", to_float, 1, 1)
+WORD__ITEM(primitive_string, 95, "->str", to_string, 1, 1)
+WORD__ITEM(primitive_arithmetic, 502, "-f", sub_float, 2, 1)
+WORD__ITEM(primitive_core, 532, ".", compose, 2, 1, SYNC)
+WORD__ITEM(primitive_arithmetic, 428, "/", div, 2, 1)
+WORD__ITEM(primitive_arithmetic, 508, "/f", div_float, 2, 1)
+WORD__ITEM(primitive_arithmetic, 633, "<", lt, 2, 1)
+WORD__ITEM(primitive_string, 176, "<-bin", from_string_bin, 1, 1)
+WORD__ITEM(primitive_string, 148, "<-str", from_string, 1, 1)
+WORD__ITEM(primitive_arithmetic, 582, "<<b", shiftl, 2, 1)
+WORD__ITEM(primitive_arithmetic, 639, "<=", lte, 2, 1)
+WORD__ITEM(primitive_arithmetic, 651, "=:=", eq_s, 2, 1)
+WORD__ITEM(primitive_arithmetic, 646, "==", eq, 2, 1)
+WORD__ITEM(primitive_string, 61, "=s", eq_str, 2, 1)
+WORD__ITEM(primitive_arithmetic, 621, ">", gt, 2, 1)
+WORD__ITEM(primitive_arithmetic, 627, ">=", gte, 2, 1)
+WORD__ITEM(primitive_arithmetic, 588, ">>b", shiftr, 2, 1)
+WORD__ITEM(special, 466, "??", placeholder, 0, 1)
+WORD__ITEM(primitive_arithmetic, 576, "^b", bitxor, 2, 1)
+WORD__ITEM(primitive_arithmetic, 539, "atan2", atan2, 2, 1)
+WORD__ITEM(primitive_io, 102, "close", close, 2, 1)
+WORD__ITEM(primitive_arithmetic, 524, "cos", cos, 1, 1)
+WORD__ITEM(primitive_core, 327, "delay", delay, 1, 1)
+WORD__ITEM(primitive_core, 305, "drop", drop, 2, 1)
+WORD__ITEM(primitive_core, 345, "dup", dup, 1, 2)
+WORD__ITEM(primitive_io, 500, "dup_array", dup_array, 1, 2)
+WORD__ITEM(primitive_arithmetic, 519, "exp", exp, 1, 1)
+WORD__ITEM(primitive_other, 61, "float_t", float_t, 1, 1)
+WORD__ITEM(primitive_core, 280, "id", id, 1, 1)
+WORD__ITEM(primitive_other, 51, "int_t", int_t, 1, 1)
+WORD__ITEM(primitive_other, 66, "list_t", list_t, 1, 1)
+WORD__ITEM(primitive_arithmetic, 514, "log", log, 1, 1)
+WORD__ITEM(primitive_io, 562, "mmap", mmap, 5, 2)
+WORD__ITEM(primitive_arithmetic, 484, "neg", negate, 1, 1)
+WORD__ITEM(primitive_arithmetic, 600, "not", not, 1, 1)
+WORD__ITEM(primitive_io, 69, "open", open, 2, 2)
+WORD__ITEM(primitive_core, 270, "otherwise", otherwise, 2, 1)
+WORD_ALIAS__ITEM(primitive_core, 523, "popr", ap, 1, 2, popr, SYNC)
+WORD_ALIAS__ITEM(primitive_core, 522, "pushl", ap, 2, 1, pushl, SYNC)
+WORD__ITEM(primitive_core, 554, "pushr", pushr, 2, 1, SYNC)
+WORD__ITEM(primitive_core, 547, "quote", quote, 1, 1, SYNC)
+WORD__ITEM(primitive_io, 176, "read", read, 2, 3)
+WORD__ITEM(primitive_io, 429, "read_array", read_array, 2, 2)
+WORD__ITEM(primitive_io, 528, "seek", seek, 3, 2)
+WORD__ITEM(primitive_core, 140, "seq", seq, 2, 1)
+WORD__ITEM(primitive_arithmetic, 529, "sin", sin, 1, 1)
+WORD__ITEM(primitive_arithmetic, 544, "sqrt", sqrt, 1, 1)
+WORD__ITEM(primitive_string, 203, "strsplit", strsplit, 2, 2)
+WORD__ITEM(primitive_string, 238, "strtrim", strtrim, 1, 1)
+WORD__ITEM(primitive_core, 315, "swap", swap, 2, 2)
+WORD__ITEM(primitive_other, 56, "symbol_t", symbol_t, 1, 1)
+WORD__ITEM(primitive_arithmetic, 534, "tan", tan, 1, 1)
+WORD__ITEM(primitive_arithmetic, 691, "trunc", trunc, 1, 1)
+WORD__ITEM(primitive_core, 218, "unless", unless, 2, 1)
+WORD__ITEM(primitive_io, 171, "unread", unread, 3, 2)
+WORD__ITEM(primitive_io, 166, "write", write, 3, 2)
+WORD__ITEM(primitive_io, 466, "write_array", write_array, 3, 1)
+WORD__ITEM(primitive_core, 72, "|", alt, 2, 1)
+WORD__ITEM(primitive_arithmetic, 570, "|b", bitor, 2, 1)
+WORD__ITEM(primitive_arithmetic, 594, "~b", complement, 1, 1)
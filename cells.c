@@ -16,8 +16,13 @@
 */
 
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <inttypes.h>
+#include <sys/mman.h>
+#if defined(__BMI2__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
 #include "rt_types.h"
 
@@ -41,13 +46,32 @@
 #pragma clang diagnostic ignored "-Wgnu-empty-initializer"
 #endif
 
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
 // Cell storage array
 // NOTE: make sure &cells > 255
-
-STATIC_ALLOC(cells, cell_t, 10000);
-cell_t *cells_ptr;
-static cell_t *uninitialized_cells;
-static cell_t *uninitialized_cells_end;
+// Address space for `cells_max` cells is reserved once, and the first `cells_size` cells
+// are in use. The array grows by CELLS_CHUNK cells when the free lists run dry,
+// but never moves, so `is_cell` is still a range check.
+// Fresh pages are zero-filled by the kernel when first touched.
+#define CELLS_CHUNK (1 << 16)
+#define CELLS_MAX (sizeof(void *) > 4 ? (size_t)1 << 26 : (size_t)1 << 20)
+THREAD_LOCAL cell_t *cells = NULL;
+THREAD_LOCAL size_t cells_size = 0;
+THREAD_LOCAL size_t cells_max = 0;
+static THREAD_LOCAL cell_t *uninitialized_cells;
+static THREAD_LOCAL cell_t *uninitialized_cells_end;
+
+// Segregated free lists
+// Free blocks of up to FREE_LIST_EXACT cells are kept in a list per size,
+// larger blocks are binned by powers of two, and the last list holds the rest.
+// Every cell in a free block has op == 0, and the first and last cells
+// record the size of the block, so that neighbors can be coalesced.
+#define FREE_LIST_EXACT 8
+#define FREE_LIST_CLASSES 16
+static THREAD_LOCAL cell_t *free_list[FREE_LIST_CLASSES];
 
 // Predefined failure cell
 CONSTANT cell_t fail_cell = {
@@ -60,8 +84,8 @@ CONSTANT cell_t fail_cell = {
 };
 
 // Structs for storing statistics
-int current_alloc_cnt = 0;
-stats_t stats, saved_stats;
+THREAD_LOCAL int current_alloc_cnt = 0;
+THREAD_LOCAL stats_t stats, saved_stats;
 
 // Is `p` a pointer?
 bool is_data(void const *p) {
@@ -103,42 +127,204 @@ void closure_set_ready(cell_t *c, bool r) {
   FLAG_SET_TO(*c, expr, NEEDS_ARG, !r);
 }
 
-cell_t *cells_next() {
-  cell_t *p = cells_ptr;
-  assert_error(is_cell(p) && !is_closure(p) && is_cell(cells_ptr->mem.next));
-  cells_ptr = cells_ptr->mem.next;
-  return p;
+// reserve address space for the cell storage array
+static
+void cells_reserve() {
+  // settle for less if the address space is limited
+  for(size_t n = CELLS_MAX; n >= CELLS_CHUNK; n /= 2) {
+    void *p = mmap(NULL, n * sizeof(cell_t),
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                   -1, 0);
+    if(p != MAP_FAILED) {
+      cells = p;
+      cells_max = n;
+      cells_size = CELLS_CHUNK;
+      return;
+    }
+  }
+  assert_throw(false, "could not reserve space for `cells`");
 }
 
 void cells_init() {
-  assert_throw(cells_size >= 3);
+  if(!cells) cells_reserve();
 
-  // zero the cells
+  // zero the first cells
   memset(cells, 0, sizeof(cell_t) * 2);
 
-  // set up doubly-linked pointer ring
-  cells[0].mem.prev = &cells[1];
-  cells[0].mem.next = &cells[1];
-  cells[1].mem.prev = &cells[0];
-  cells[1].mem.next = &cells[0];
-
-  cells_ptr = &cells[0];
+  zero(free_list);
   uninitialized_cells = &cells[2];
   uninitialized_cells_end = &cells[cells_size];
   current_alloc_cnt = 0;
+  drop_reset();
+}
+
+// size class of a free block of n cells
+static
+unsigned int free_list_class(size_t n) {
+  return n <= FREE_LIST_EXACT ?
+    n - 1 :
+    min(FREE_LIST_CLASSES - 1, FREE_LIST_EXACT - 4 + int_log2l(n));
+}
+
+// Is `c` the first cell of a block in the free lists?
+static
+bool is_free_block(cell_t const *c) {
+  return !c->op &&
+    c->mem.block_size &&
+    c->mem.prev &&
+    c->mem.prev->mem.next == c;
+}
+
+// add to the end of the circular list, so that freed blocks are reused last
+static
+void free_list_insert(cell_t *c, size_t n) {
+  cell_t **head = &free_list[free_list_class(n)];
+  c->mem.block_size = n;
+  c[n-1].mem.block_size = n;
+  if(*head) {
+    c->mem.next = *head;
+    c->mem.prev = (*head)->mem.prev;
+    c->mem.prev->mem.next = c;
+    (*head)->mem.prev = c;
+  } else {
+    c->mem.prev = c->mem.next = c;
+    *head = c;
+  }
+}
+
+static
+void free_list_remove(cell_t *c) {
+  cell_t **head = &free_list[free_list_class(c->mem.block_size)];
+  if(c->mem.next == c) {
+    *head = NULL;
+  } else {
+    c->mem.prev->mem.next = c->mem.next;
+    c->mem.next->mem.prev = c->mem.prev;
+    if(*head == c) *head = c->mem.next;
+  }
+  c->mem.prev = NULL;
+  c->mem.next = NULL;
+  c->mem.block_size = 0;
+}
+
+// the free block ending just before c, if any
+static
+cell_t *free_block_before(cell_t *c) {
+  if(c > cells && !c[-1].op) {
+    size_t n = c[-1].mem.block_size;
+    if(n && n <= (size_t)(c - cells)) {
+      cell_t *prev = c - n;
+      if(prev->mem.block_size == n && is_free_block(prev)) return prev;
+    }
+  }
+  return NULL;
+}
+
+// return n cells starting at c to the free lists, merging with free neighbors
+static
+void free_block(cell_t *c, size_t n) {
+  COUNTUP(i, n) c[i].op = 0;
+
+  // merge with the following block
+  cell_t *next = c + n;
+  if(next < (uninitialized_cells ? uninitialized_cells : uninitialized_cells_end) &&
+     is_free_block(next)) {
+    n += next->mem.block_size;
+    free_list_remove(next);
+  }
+
+  // merge with the preceding block
+  cell_t *prev = free_block_before(c);
+  if(prev) {
+    n += c - prev;
+    free_list_remove(prev);
+    c = prev;
+  }
+
+  free_list_insert(c, n);
+}
+
+// first block in list k that can hold n cells
+static
+cell_t *free_list_fit(unsigned int k, size_t n) {
+  cell_t *head = free_list[k], *c = head;
+  if(c) {
+    do {
+      if(c->mem.block_size >= n) return c;
+      c = c->mem.next;
+    } while(c != head);
+  }
+  return NULL;
+}
+
+// take the first block from the free lists that can hold n cells
+static
+cell_t *free_list_take(size_t n) {
+  unsigned int k = free_list_class(n);
+
+  // blocks in the binned classes might not be big enough
+  cell_t *c = free_list_fit(k, n);
+
+  // otherwise split a block from a larger class
+  while(!c && ++k < FREE_LIST_CLASSES) {
+    c = k < FREE_LIST_CLASSES - 1 ? free_list[k] : free_list_fit(k, n);
+  }
+  if(!c) return NULL;
+
+  size_t size = c->mem.block_size;
+  free_list_remove(c);
+  if(size > n) free_list_insert(c + n, size - n);
+  return c;
 }
 
+// move the remaining uninitialized cells to the free lists
 static
-void cell_alloc(cell_t *c) {
-  assert_error(is_cell(c) && !is_closure(c));
-  cell_t *prev = c->mem.prev;
-  assert_error(is_cell(prev) && !is_closure(prev));
-  cell_t *next = c->mem.next;
-  assert_error(is_cell(next) && !is_closure(next));
-  if(cells_ptr == c) cells_next();
-  assert_throw(c != prev && c != next, "can't alloc the last cell, `cells` too small?");
-  prev->mem.next = next;
-  next->mem.prev = prev;
+void retire_uninitialized_cells() {
+  if(uninitialized_cells &&
+     uninitialized_cells < uninitialized_cells_end) {
+    cell_t *c = uninitialized_cells;
+    uninitialized_cells = NULL;
+    free_block(c, uninitialized_cells_end - c);
+  }
+  uninitialized_cells = NULL;
+}
+
+// extend `cells` by enough chunks to hold n more cells
+static
+bool cells_grow(size_t n) {
+  size_t grow = DIV_UP(n, CELLS_CHUNK) * CELLS_CHUNK;
+  if(cells_size + grow > cells_max) return false;
+  retire_uninitialized_cells();
+  cell_t *end = &cells[cells_size];
+
+  // reclaim a free block at the end
+  cell_t *c = free_block_before(end);
+  if(c) {
+    free_list_remove(c);
+  } else {
+    c = end;
+  }
+
+  cells_size += grow;
+  uninitialized_cells = c;
+  uninitialized_cells_end = &cells[cells_size];
+  return true;
+}
+
+// number of blocks in the free lists, a measure of fragmentation
+int free_block_count() {
+  int cnt = 0;
+  FOREACH(i, free_list) {
+    cell_t *head = free_list[i], *c = head;
+    if(c) {
+      do {
+        cnt++;
+        c = c->mem.next;
+      } while(c != head);
+    }
+  }
+  return cnt;
 }
 
 cell_t *alloc_value() {
@@ -193,8 +379,8 @@ cell_t *closure_alloc(csize_t args) {
 // NOTE: set .size properly afterwards, or closure_free may not free all cells
 cell_t *closure_alloc_cells(csize_t size) {
   assert_throw(size <= MAX_ALLOC_SIZE);
-  assert_throw((size_t)(current_alloc_cnt + size) <= cells_size, "%d bytes allocated, `cells` too small", current_alloc_cnt);
-  cell_t *c;
+  assert_throw((size_t)(current_alloc_cnt + size) <= cells_max, "%d bytes allocated, `cells` too small", current_alloc_cnt);
+  cell_t *c = NULL;
 
   if(uninitialized_cells &&
      uninitialized_cells + size <= uninitialized_cells_end) {
@@ -202,31 +388,18 @@ cell_t *closure_alloc_cells(csize_t size) {
     c = uninitialized_cells;
     uninitialized_cells += size;
   } else {
-    if(size == 1) uninitialized_cells = NULL;
-
-    // otherwise allocate from the chain
-    cell_t *ptr = cells_next();
-    cell_t *mark = ptr;
-    csize_t cnt = 0;
-    (void)mark;
-
-    c = ptr;
-
-    // search for contiguous chunk
-    while(cnt < size) {
-      if(is_cell(ptr) && !is_closure(ptr)) {
-        cnt++;
-        ptr++;
-      } else {
-        cnt = 0;
-        c = ptr = cells_next();
-        assert_throw(c != mark, "could not find cells to allocate");
-      }
+    // otherwise allocate from the free lists
+    retire_uninitialized_cells();
+    c = free_list_take(size);
+    if(!c && free_dead_cells()) {
+      // reclaimed deferred frees
+      c = free_list_take(size);
     }
-
-    // remove the found chunk
-    COUNTUP(i, size) {
-      cell_alloc(&c[i]);
+    if(!c) {
+      // or grow `cells` to get more uninitialized cells
+      assert_throw(cells_grow(size), "could not find cells to allocate, `cells` is full");
+      c = uninitialized_cells;
+      uninitialized_cells += size;
     }
   }
 
@@ -266,11 +439,8 @@ csize_t closure_cells(cell_t const *c) {
 }
 
 void cell_free(cell_t *c) {
-  c->op = 0;
-  c->mem.next = cells_ptr;
-  c->mem.prev = cells_ptr->mem.prev;
-  cells_ptr->mem.prev = c;
-  c->mem.prev->mem.next = c;
+  free_block(c, 1);
+  current_alloc_cnt--;
 }
 
 void closure_shrink(cell_t *c, csize_t s) {
@@ -280,15 +450,7 @@ void closure_shrink(cell_t *c, csize_t s) {
   csize_t size = closure_cells(c);
   if(size > s) {
     assert_error(is_closure(c));
-    cell_t *prev = cells_ptr->mem.prev;
-    RANGEUP(i, s, size) {
-      c[i].op = 0;
-      c[i].mem.prev = prev;
-      prev->mem.next = &c[i];
-      prev = &c[i];
-    }
-    cells_ptr->mem.prev = prev;
-    prev->mem.next = cells_ptr;
+    free_block(&c[s], size - s);
     current_alloc_cnt -= size - s;
   }
 }
@@ -425,6 +587,75 @@ location_t cell_location(cell_t const *c) {
   return is_cell(c) && !c->op ? c->mem.loc : ((location_t) {});
 }
 
+// cells whose count reached zero, waiting for their references to be dropped
+STATIC_ALLOC(drop_stack, cell_t *, 1 << 12);
+static THREAD_LOCAL size_t drop_stack_n = 0;
+static THREAD_LOCAL bool dropping = false;
+
+// dead cells (and where they were dropped), freed together in address order
+// so that neighbors coalesce
+STATIC_ALLOC(free_batch, pair_t, 1 << 10);
+static THREAD_LOCAL size_t free_batch_n = 0;
+
+// hold dead cells in `free_batch` until `drop_flush`
+THREAD_LOCAL bool defer_free = false;
+
+// free all cells in `free_batch`, return true if any were freed
+bool free_dead_cells() {
+  if(!free_batch_n) return false;
+  quicksort(free_batch, WIDTH(free_batch), free_batch_n);
+  COUNTUP(i, free_batch_n) {
+    cell_t *c = (cell_t *)free_batch[i].first;
+    closure_free(c);
+    c->mem.loc.raw = free_batch[i].second;
+  }
+  free_batch_n = 0;
+  return true;
+}
+
+// end `defer_free` mode
+void drop_flush() {
+  defer_free = false;
+  free_dead_cells();
+}
+
+// discard drops interrupted by an error, the cells are reclaimed anyway
+void drop_reset() {
+  drop_stack_n = 0;
+  dropping = false;
+  free_batch_n = 0;
+  defer_free = false;
+}
+
+// release references held by dead cell `c` and queue it to be freed
+static
+void drop_dead(cell_t *c, location_t loc) {
+  cell_t *p;
+  LOG_WHEN(c->alt &&
+           !c->alt->n &&
+           c->alt->op != OP_value,
+           MARK("WARN") " unreduced alt %C -> %C", c, c->alt);
+  TRAVERSE(c, alt, in, ptrs) {
+    _dropn(*p, 1, loc);
+  }
+  if(is_dep(c) && !is_value(p = c->expr.arg[0]) && is_closure(p)) {
+    /* mark dep arg as gone */
+    // TODO improve this using stored pos
+    csize_t n = closure_args(p);
+    while(n--) {
+      if(p->expr.arg[n] == c) {
+        p->expr.arg[n] = 0;
+        break;
+      }
+    }
+  }
+  if(is_value(c) && !is_list(c)) {
+    trace_drop(c);
+  }
+  if(free_batch_n >= free_batch_size) free_dead_cells();
+  free_batch[free_batch_n++] = (pair_t) { (uintptr_t)c, loc.raw };
+}
+
 #if INTERFACE
 #define dropn(c, n) _dropn(c, n, LOCATION())
 #define drop(c) _dropn(c, 1, LOCATION())
@@ -432,33 +663,22 @@ location_t cell_location(cell_t const *c) {
 void _dropn(cell_t *c, refcount_t n, location_t loc) {
   if(!is_cell(c) || is_persistent(c)) return;
   assert_error(is_closure(c), "%C (last dropped at %L)", c, cell_location(c).raw);
-  if(n > c->n) {
-    cell_t *p;
-    LOG_WHEN(c->alt &&
-             !c->alt->n &&
-             c->alt->op != OP_value,
-             MARK("WARN") " unreduced alt %C -> %C", c, c->alt);
-    TRAVERSE(c, alt, in, ptrs) {
-      _dropn(*p, 1, loc);
-    }
-    if(is_dep(c) && !is_value(p = c->expr.arg[0]) && is_closure(p)) {
-      /* mark dep arg as gone */
-      // TODO improve this using stored pos
-      csize_t n = closure_args(p);
-      while(n--) {
-        if(p->expr.arg[n] == c) {
-          p->expr.arg[n] = 0;
-          break;
-        }
-      }
-    }
-    if(is_value(c) && !is_list(c)) {
-      trace_drop(c);
+  if(n <= c->n) {
+    c->n -= n;
+  } else if(dropping) {
+    // nested in another drop, so queue it, or recurse if the stack is full
+    if(drop_stack_n < drop_stack_size) {
+      c->n = PERSISTENT; // dead, so ignore further drops until it's popped
+      drop_stack[drop_stack_n++] = c;
+    } else {
+      drop_dead(c, loc);
     }
-    closure_free(c);
-    c->mem.loc = loc;
   } else {
-    c->n -= n;
+    dropping = true;
+    drop_dead(c, loc);
+    while(drop_stack_n) drop_dead(drop_stack[--drop_stack_n], loc);
+    dropping = false;
+    if(!defer_free) free_dead_cells();
   }
 }
 
@@ -483,45 +703,263 @@ void fake_undrop(cell_t *c) {
   }
 }
 
+#ifdef ALT_SET_BITS
+// Wide alt sets
+// Sets wider than a word are interned in `wide_alt_sets`, and an alt_set_t
+// is an index into it, so a cell still holds a set in one word.
+// Index 0 is the empty set. The vector type lets the compiler use SIMD
+// for the bit operations.
+typedef uint64_t wide_as_t __attribute__((vector_size(ALT_SET_BITS / 8)));
+#define WIDE_AS_WORDS (ALT_SET_BITS / 64)
+#define WIDE_AS_MASK 0x5555555555555555ull
+
+static THREAD_LOCAL wide_as_t *wide_alt_sets = NULL;
+static THREAD_LOCAL uint32_t *wide_as_index = NULL; // open addressing, twice the capacity
+static THREAD_LOCAL size_t wide_as_cnt = 0, wide_as_capacity = 0;
+static const wide_as_t wide_as_empty = {0};
+
+static
+bool wide_as_eq(const wide_as_t *a, const wide_as_t *b) {
+  COUNTUP(i, WIDE_AS_WORDS) {
+    if((*a)[i] != (*b)[i]) return false;
+  }
+  return true;
+}
+
+static
+size_t wide_as_slot(const wide_as_t *x) {
+  uint64_t h = 0;
+  COUNTUP(i, WIDE_AS_WORDS) h = (h ^ (*x)[i]) * 0x9e3779b97f4a7c15ull;
+  return (h >> 32) & (2 * wide_as_capacity - 1);
+}
+
+static
+void wide_as_grow() {
+  size_t n = max(256, 2 * wide_as_capacity);
+  void *sets = NULL;
+  uint32_t *index = calloc(2 * n, sizeof(uint32_t));
+  if(posix_memalign(&sets, sizeof(wide_as_t), n * sizeof(wide_as_t)) || !index) {
+    free(index);
+    assert_throw(false, "could not grow `wide_alt_sets`");
+  }
+  if(wide_as_cnt) {
+    memcpy(sets, wide_alt_sets, wide_as_cnt * sizeof(wide_as_t));
+  } else {
+    memset(sets, 0, sizeof(wide_as_t));
+    wide_as_cnt = 1;
+  }
+  free(wide_alt_sets);
+  free(wide_as_index);
+  wide_alt_sets = sets;
+  wide_as_index = index;
+  wide_as_capacity = n;
+  RANGEUP(k, 1, wide_as_cnt) {
+    size_t i = wide_as_slot(&wide_alt_sets[k]);
+    while(index[i]) i = (i + 1) & (2 * n - 1);
+    index[i] = k;
+  }
+}
+
+static
+alt_set_t wide_as_intern(const wide_as_t *x) {
+  if(wide_as_eq(x, &wide_as_empty)) return 0;
+  if(wide_as_cnt >= wide_as_capacity) wide_as_grow();
+  for(size_t i = wide_as_slot(x);; i = (i + 1) & (2 * wide_as_capacity - 1)) {
+    uint32_t k = wide_as_index[i];
+    if(!k) {
+      wide_alt_sets[wide_as_cnt] = *x;
+      wide_as_index[i] = wide_as_cnt;
+      return wide_as_cnt++;
+    }
+    if(wide_as_eq(&wide_alt_sets[k], x)) return k;
+  }
+}
+
+static
+const wide_as_t *wide_as(alt_set_t a) {
+  if(!a) return &wide_as_empty;
+  assert_error(a < wide_as_cnt);
+  return &wide_alt_sets[a];
+}
+#endif
+
+// forget all alt sets, with the alt ids
+void as_reset() {
+#ifdef ALT_SET_BITS
+  if(wide_as_cnt > 1) {
+    memset(wide_as_index, 0, 2 * wide_as_capacity * sizeof(uint32_t));
+    wide_as_cnt = 1;
+  }
+#endif
+}
+
 alt_set_t as_single(unsigned int k, unsigned int v) {
-  assert_throw(k < AS_SIZE);
+  assert_throw(k < AS_SIZE, "out of alt ids");
+#ifdef ALT_SET_BITS
+  unsigned int b = (k << 1) + (v & 1);
+  wide_as_t x = {0};
+  x[b >> 6] = (uint64_t)1 << (b & 63);
+  return wide_as_intern(&x);
+#else
   return (alt_set_t)1 << ((k << 1) + (v & 1));
+#endif
 }
 
+#ifndef ALT_SET_BITS
+// spread the low AS_SIZE bits of x to the even bits (AS_MASK)
+static
+alt_set_t as_spread(alt_set_t x) {
+#if defined(__BMI2__) && defined(__x86_64__)
+  return _pdep_u64(x, AS_MASK);
+#else
+  if(sizeof(alt_set_t) > 4) {
+    x = (x | x << 16) & (alt_set_t)0x0000ffff0000ffff;
+  } else {
+    x &= 0xffff;
+  }
+  x = (x | x << 8) & (alt_set_t)0x00ff00ff00ff00ff;
+  x = (x | x << 4) & (alt_set_t)0x0f0f0f0f0f0f0f0f;
+  x = (x | x << 2) & (alt_set_t)0x3333333333333333;
+  x = (x | x << 1) & AS_MASK;
+  return x;
+#endif
+}
+#endif
+
+// alt set for ids k...k+n-1, using the bits of v for each id's branch
 alt_set_t as_multi(unsigned int k, unsigned n, unsigned int v) {
   if(n == 0) return 0;
-  alt_set_t alt_set = 0;
-  while(n--) {
-    alt_set |= as_single(k, v);
-    k++;
-    v >>= 1;
+  assert_throw(k + n <= AS_SIZE, "out of alt ids");
+#ifdef ALT_SET_BITS
+  wide_as_t x = {0};
+  COUNTUP(i, n) {
+    unsigned int b = ((k + i) << 1) + ((v >> i) & 1);
+    x[b >> 6] |= (uint64_t)1 << (b & 63);
   }
-  return alt_set;
+  return wide_as_intern(&x);
+#else
+  alt_set_t
+    bits = ((alt_set_t)1 << n) - 1, // n <= AS_SIZE, which is half the width
+    mask = as_spread(bits),
+    x = as_spread(v & bits);
+  return as_from_mask(mask, x) << (k << 1);
+#endif
 }
 
 alt_set_t as_intersect(alt_set_t a, alt_set_t b) {
+#ifdef ALT_SET_BITS
+  if(a == b) return a;
+  if(!a || !b) return 0;
+  wide_as_t x = *wide_as(a) & *wide_as(b);
+  return wide_as_intern(&x);
+#else
   return a & b;
+#endif
 }
 
 alt_set_t as_union(alt_set_t a, alt_set_t b) {
+#ifdef ALT_SET_BITS
+  if(!a || a == b) return b;
+  if(!b) return a;
+  wide_as_t x = *wide_as(a) | *wide_as(b);
+  return wide_as_intern(&x);
+#else
   return a | b;
+#endif
 }
 
+// ids with both branches
 alt_set_t as_conflict(alt_set_t a) {
+#ifdef ALT_SET_BITS
+  if(!a) return 0;
+  wide_as_t x = *wide_as(a);
+  x &= (x >> 1) & WIDE_AS_MASK;
+  return wide_as_intern(&x);
+#else
   return (a & (a >> 1)) & AS_MASK;
+#endif
 }
 
+// ids in the set
 alt_set_t as_mask(alt_set_t a) {
+#ifdef ALT_SET_BITS
+  if(!a) return 0;
+  wide_as_t x = *wide_as(a);
+  x = (x | (x >> 1)) & WIDE_AS_MASK;
+  return wide_as_intern(&x);
+#else
   return (a | (a >> 1)) & AS_MASK;
+#endif
 }
 
+// ids in `mask` on branch 1 where x is set, otherwise branch 0
 alt_set_t as_from_mask(alt_set_t mask, alt_set_t x) {
+#ifdef ALT_SET_BITS
+  wide_as_t m = *wide_as(mask), y = *wide_as(x);
+  y = (~y & m) | ((y & m) << 1);
+  return wide_as_intern(&y);
+#else
   assert_error((mask & ~AS_MASK) == 0 &&
                (x & ~AS_MASK) == 0);
   alt_set_t
     as0 = (~x) & mask,
     as1 = (x & mask) << 1;
   return as0 | as1;
+#endif
+}
+
+// ids on branch 0 in `a` but not `b`, or the reverse
+alt_set_t as_differ(alt_set_t a, alt_set_t b) {
+#ifdef ALT_SET_BITS
+  if(a == b) return 0;
+  wide_as_t x = (*wide_as(a) ^ *wide_as(b)) & WIDE_AS_MASK;
+  return wide_as_intern(&x);
+#else
+  return (a ^ b) & AS_MASK;
+#endif
+}
+
+// number of ids in `mask`
+unsigned int as_count(alt_set_t mask) {
+#ifdef ALT_SET_BITS
+  const wide_as_t *m = wide_as(mask);
+  unsigned int n = 0;
+  COUNTUP(i, WIDE_AS_WORDS) n += __builtin_popcountll((*m)[i]);
+  return n;
+#else
+  return __builtin_popcountl(mask);
+#endif
+}
+
+// the j-th combination of branches for the ids in `mask`,
+// bit i of j selects the branch of the i-th id
+alt_set_t as_select(alt_set_t mask, uintmax_t j) {
+#ifdef ALT_SET_BITS
+  wide_as_t m = *wide_as(mask), x = {0};
+  COUNTUP(i, WIDE_AS_WORDS) {
+    for(uint64_t r = m[i]; r; r &= r - 1, j >>= 1) {
+      if(j & 1) x[i] |= r & -r;
+    }
+  }
+  x = (~x & m) | (x << 1);
+  return wide_as_intern(&x);
+#else
+  alt_set_t x = 0;
+  for(alt_set_t r = mask; r; r &= r - 1, j >>= 1) {
+    if(j & 1) x |= r & -r;
+  }
+  return as_from_mask(mask, x);
+#endif
+}
+
+// branch bits of id k in `a`: 0 if absent, 1 or 2 for branch 0 or 1, 3 for both
+unsigned int as_get(alt_set_t a, unsigned int k) {
+  unsigned int b = k << 1;
+#ifdef ALT_SET_BITS
+  return ((*wide_as(a))[b >> 6] >> (b & 63)) & 3;
+#else
+  return (a >> b) & 3;
+#endif
 }
 
 /*
@@ -537,16 +975,27 @@ TEST(alt_sets) {
     a1 = as_single(0, 1),
     b0 = as_single(1, 0),
     b1 = as_single(1, 1),
-    c = a0 | b0,
-    m0 = as_mask(a0 | b1),
-    m1 = as_mask(a1 | b0),
+    c = as_union(a0, b0),
+    m0 = as_mask(as_union(a0, b1)),
+    m1 = as_mask(as_union(a1, b0)),
     d = as_single(2, 1),
     e = as_multi(0, 3, 5);
-  ok &= !as_conflict(a0 | b1);
-  ok &= !!as_conflict(a1 | c);
+  ok &= !as_conflict(as_union(a0, b1));
+  ok &= !!as_conflict(as_union(a1, c));
   ok &= m0 == m1;
-  ok &= (a1 | b0 | d) == e;
-  ok &= as_from_mask(as_mask(e), (e >> 1) & AS_MASK) == e;
+  ok &= as_union(as_union(a1, b0), d) == e;
+  ok &= as_select(as_mask(e), 5) == e;
+  ok &= as_count(as_differ(e, c)) == 1;
+  COUNTUP(i, 5) {
+    unsigned int k = i * 3, n = AS_SIZE - k < 5 ? AS_SIZE - k : 5, v = i * 11;
+    alt_set_t r = 0;
+    COUNTUP(j, n) r = as_union(r, as_single(k + j, v >> j));
+    ok &= as_multi(k, n, v) == r;
+  }
+  // the last id
+  unsigned int z = AS_SIZE - 1;
+  ok &= !!as_conflict(as_union(as_single(z, 0), as_multi(z, 1, 1)));
+  ok &= as_get(as_union(e, as_single(z, 1)), z) == 2;
 //  ok &= !!as_more_general_than(a0, c);
   return ok ? 0 : -1;
 }
@@ -566,23 +1015,32 @@ bool check_bit(uint8_t *m, unsigned int x) {
 // used to get consistent allocations
 void alloc_to(size_t n) {
   if(n < cells_size &&
+     uninitialized_cells &&
      uninitialized_cells < &cells[n]) {
-    size_t s = &cells[n] - uninitialized_cells;
-    cell_t *c = closure_alloc_cells(s);
-    c->op = OP_value;
-    c->size = calculate_args_from_cells(s);
-    closure_free(c);
+    cell_t *c = uninitialized_cells;
+    uninitialized_cells = &cells[n];
+    free_block(c, uninitialized_cells - c);
   }
 }
 
-bool check_cycle() {
-  size_t i = 0;
-  cell_t *start = cells_ptr, *ptr = start;
-  while(ptr->mem.next != start) {
-    if(i > cells_size) return false;
-    i++;
-    assert_error(is_cell(ptr->mem.next->mem.next));
-    ptr = ptr->mem.next;
+bool check_free_lists() {
+  size_t free_cnt = 0;
+  FOREACH(i, free_list) {
+    cell_t *head = free_list[i], *c = head;
+    if(!c) continue;
+    do {
+      size_t n = c->mem.block_size;
+      if(free_cnt > cells_size ||
+         !is_cell(c) ||
+         c->mem.next->mem.prev != c ||
+         free_list_class(n) != i ||
+         c[n-1].mem.block_size != n) return false;
+      COUNTUP(j, n) {
+        if(c[j].op) return false;
+      }
+      free_cnt += n;
+      c = c->mem.next;
+    } while(c != head);
   }
   return true;
 }
@@ -597,7 +1055,37 @@ TEST(alloc) {
       closure_free(a[i]);
     }
   }
-  return leak_test() && check_cycle() ? 0 : -1;
+  return leak_test() && check_free_lists() ? 0 : -1;
+}
+
+TEST(coalesce) {
+  cell_t *a = func(OP_ap, 5, 1);
+  cell_t *b = func(OP_ap, 9, 1);
+  cell_t *c = func(OP_ap, 1, 1);
+  if(b != a + closure_cells(a) ||
+     c != b + closure_cells(b)) return -1;
+  closure_free(a);
+  closure_free(c);
+  closure_free(b);
+  // a, b, and c should be merged into one free block ending at c
+  size_t n = c->mem.block_size;
+  if(n < (size_t)(c - a) + 1 ||
+     !is_free_block(c + 1 - n)) return -2;
+  return leak_test() && check_free_lists() ? 0 : -3;
+}
+
+TEST(cells_grow) {
+  cell_t *a[CELLS_CHUNK / 64];
+  size_t n = 0, size = cells_size;
+  while(cells_size == size && n < LENGTH(a)) {
+    a[n++] = func(OP_ap, 1000, 1);
+  }
+  bool grew = cells_size > size && is_cell(a[n-1]);
+  COUNTUP(i, n) {
+    closure_free(a[i]);
+  }
+  if(!grew) return -1;
+  return leak_test() && check_free_lists() ? 0 : -2;
 }
 
 bool leak_test() {
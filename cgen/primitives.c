@@ -12,7 +12,7 @@
 #include "io.h"
 #include "cgen/primitives.h"
 
-static int mem[256];
+static int mem[1 << 20];
 static int *mem_ptr = mem;
 static char strings[1 << 22]; // ***
 static char *strings_ptr = strings;
@@ -36,16 +36,39 @@ void init_primitives() {
   strings_ptr = strings;
 }
 
-array arr_alloc(unsigned int n) {
-  assert_error(mem_ptr - mem + n <= (int)LENGTH(mem), "out of mem");
+#if INTERFACE
+// extent of a buffer's elements claimed by some array
+typedef struct {
+  unsigned int lo, hi;
+} arr_extent_t;
+#endif
+
+#define ARR_HEADER (sizeof(arr_extent_t) / sizeof(int))
+#define ARR_MIN_CAPACITY 8
+
+static
+arr_extent_t *arr_extent(const array *arr) {
+  return (arr_extent_t *)arr->elem - 1;
+}
+
+// allocate a buffer for n elements, starting empty at offset
+array arr_alloc_at(unsigned int n, unsigned int offset) {
+  assert_error(mem_ptr - mem + ARR_HEADER + n <= LENGTH(mem), "out of mem");
   array arr = {
     .capacity = n,
-    .elem = mem_ptr
+    .offset = offset,
+    .elem = mem_ptr + ARR_HEADER
   };
-  mem_ptr += n;
+  *arr_extent(&arr) = (arr_extent_t) { .lo = offset, .hi = offset };
+  mem_ptr += ARR_HEADER + n;
   return arr;
 }
 
+// allocate a buffer with equal headroom on both sides
+array arr_alloc(unsigned int n) {
+  return arr_alloc_at(n, n / 2);
+}
+
 char *string_alloc(unsigned int n) {
   assert_error(strings_ptr - strings + n <= (int)LENGTH(strings),
                "out of mem (%d requested, %d available)",
@@ -55,6 +78,130 @@ char *string_alloc(unsigned int n) {
   return s;
 }
 
+#if INTERFACE
+// allocation state to return to after a loop iteration
+typedef struct {
+  int *mem;
+  char *strings;
+} mem_mark_t;
+#endif
+
+mem_mark_t mem_mark() {
+  return (mem_mark_t) {
+    .mem = mem_ptr,
+    .strings = strings_ptr
+  };
+}
+
+// a live range of bytes to be moved by compact()
+typedef struct {
+  char *ptr;
+  size_t size;
+  unsigned int index; // of the value referring to the range
+} live_ref_t;
+
+#define MAX_LIVE_REFS 32
+
+// move live ranges in [start, *top) down to start
+// overlapping ranges are moved together, so substrings stay in place
+// returns the number of moved ranges, which are at the beginning of refs
+static
+unsigned int compact(char *start, char **top, live_ref_t *refs, unsigned int n) {
+  // remove references outside the region and sort the rest
+  unsigned int cnt = 0;
+  COUNTUP(i, n) {
+    live_ref_t r = refs[i];
+    if(r.ptr < start || r.ptr >= *top) continue;
+    unsigned int j = cnt++;
+    while(j && refs[j-1].ptr > r.ptr) {
+      refs[j] = refs[j-1];
+      j--;
+    }
+    refs[j] = r;
+  }
+
+  char *dst = start;
+  unsigned int i = 0;
+  while(i < cnt) {
+    char
+      *lo = refs[i].ptr,
+      *hi = lo + refs[i].size;
+    unsigned int j = i + 1;
+    while(j < cnt && refs[j].ptr <= hi) {
+      hi = max(hi, refs[j].ptr + refs[j].size);
+      j++;
+    }
+    memmove(dst, lo, hi - lo);
+    RANGEUP(k, i, j) {
+      refs[k].ptr = dst + (refs[k].ptr - lo);
+    }
+    dst += hi - lo;
+    i = j;
+  }
+  *top = dst;
+  return cnt;
+}
+
+/** Release memory allocated since mark, except for the live strings and arrays.
+ * The live values are moved down to the mark.
+ */
+void mem_release(mem_mark_t mark,
+                 seg_t **strs, unsigned int strs_n,
+                 array **arrs, unsigned int arrs_n) {
+  live_ref_t refs[MAX_LIVE_REFS];
+  assert_error(strs_n <= LENGTH(refs) && arrs_n <= LENGTH(refs));
+
+  COUNTUP(i, strs_n) {
+    refs[i] = (live_ref_t) {
+      .ptr = (char *)strs[i]->s,
+      .size = strs[i]->n,
+      .index = i
+    };
+  }
+  unsigned int n = compact(mark.strings, &strings_ptr, refs, strs_n);
+  COUNTUP(i, n) {
+    strs[refs[i].index]->s = refs[i].ptr;
+  }
+
+  COUNTUP(i, arrs_n) {
+    refs[i] = (live_ref_t) {
+      .ptr = arrs[i]->elem ? (char *)arr_extent(arrs[i]) : NULL,
+      .size = (ARR_HEADER + arrs[i]->capacity) * sizeof(int),
+      .index = i
+    };
+  }
+  char *top = (char *)mem_ptr;
+  n = compact((char *)mark.mem, &top, refs, arrs_n);
+  mem_ptr = (int *)top;
+  COUNTUP(i, n) {
+    arrs[refs[i].index]->elem = (int *)refs[i].ptr + ARR_HEADER;
+  }
+}
+
+TEST(mem_release) {
+  init_primitives();
+  seg_t s0 = seg_alloc("zero", 4);
+  mem_mark_t mark = mem_mark();
+  LOOP(3) {
+    seg_t s1 = seg_alloc("dead", 4);
+    seg_t s2 = seg_alloc("alive and well", 14);
+    seg_t sub = { .s = s2.s + 6, .n = 3 };
+    array arr = __primitive_quote0_li(42);
+    mem_release(mark,
+                (seg_t *[]) {&s0, &s2, &sub}, 3,
+                (array *[]) {&arr}, 1);
+    if(s2.s != mark.strings ||
+       strings_ptr != mark.strings + s2.n ||
+       segcmp("alive and well", s2) != 0 ||
+       segcmp("and", sub) != 0 ||
+       segcmp("zero", s0) != 0) return -1;
+    if((int *)arr_extent(&arr) != mark.mem ||
+       *arr_elem(&arr, 0) != 42) return -2;
+    (void)s1;
+  }
+  return 0;
+}
+
 seg_t seg_alloc(char *s, unsigned int n) {
   char *ns = string_alloc(n);
   memcpy(ns, s, n);
@@ -68,20 +215,58 @@ unsigned int array_remaining(array *arr) {
   return arr->capacity - arr->size;
 }
 
+// index 0 is the right end
 int *arr_elem(array *arr, unsigned int i) {
   return i < arr->size ?
-    &arr->elem[(arr->capacity + arr->offset - i) % arr->capacity] :
+    &arr->elem[arr->offset + arr->size - 1 - i] :
     NULL;
 }
 
+// can the array grow by l on the left and r on the right without copying?
+// only if it ends where the buffer's claimed extent does, so that no other array sees the change
+static
+bool arr_can_extend(const array *arr, unsigned int l, unsigned int r) {
+  if(!arr->elem) return false;
+  const arr_extent_t *ext = arr_extent(arr);
+  unsigned int end = arr->offset + arr->size;
+  return
+    (!l || (ext->lo == arr->offset && l <= arr->offset)) &&
+    (!r || (ext->hi == end && r <= arr->capacity - end));
+}
+
+// copy into a new buffer with room for l more on the left and r more on the right
+static
+void arr_copy(array *arr, unsigned int l, unsigned int r) {
+  unsigned int
+    n = arr->size + l + r,
+    capacity = max(ARR_MIN_CAPACITY, 2 * n);
+  array copy = arr_alloc_at(capacity, (capacity - n) / 2 + l);
+  copy.size = arr->size;
+  if(arr->size) {
+    memcpy(&copy.elem[copy.offset], &arr->elem[arr->offset], arr->size * sizeof(int));
+  }
+  arr_extent(&copy)->hi = copy.offset + copy.size;
+  *arr = copy;
+}
+
+/** Add l elements on the left and remove r elements on the right.
+ * Negative values do the opposite. The storage is shared between arrays,
+ * and is copied when growing would overwrite elements visible to another array.
+ */
 bool arr_shift(array *arr, int l, int r) {
-  bool res;
-  int s = l - r;
-  if((res = INRANGE(arr->size + s, 0, arr->capacity))) {
-    arr->size += s;
-    arr->offset = (arr->capacity + arr->offset - r) % arr->capacity;
+  if((int)arr->size + l - r < 0) return false;
+  unsigned int
+    grow_l = max(0, l),
+    grow_r = max(0, -r);
+  if(grow_l || grow_r) {
+    if(!arr_can_extend(arr, grow_l, grow_r)) arr_copy(arr, grow_l, grow_r);
+    arr_extent_t *ext = arr_extent(arr);
+    if(grow_l) ext->lo = arr->offset - grow_l;
+    if(grow_r) ext->hi = arr->offset + arr->size + grow_r;
   }
-  return res;
+  arr->offset -= l;
+  arr->size += l - r;
+  return true;
 }
 
 void print_array(array *arr) {
@@ -96,7 +281,7 @@ void print_array(array *arr) {
 }
 
 array arr_new() {
-  return arr_alloc(32);
+  return arr_alloc(ARR_MIN_CAPACITY);
 }
 
 TEST(arr_shift) {
@@ -114,6 +299,32 @@ TEST(arr_shift) {
   return 0;
 }
 
+TEST(arr_cow) {
+  init_primitives();
+  array a = __primitive_quote0_li(1);
+  array b = __primitive_pushr1(a, 2); // extends a's buffer in place
+  array c = __primitive_pushr1(a, 3); // must copy
+  array d = __primitive_ap10(0, b);
+  print_array(&a);
+  print_array(&b);
+  print_array(&c);
+  print_array(&d);
+  if(b.elem != a.elem || c.elem == a.elem) return -1;
+
+  // geometric growth
+  int *start = mem_ptr;
+  array x = nil;
+  COUNTUP(i, 1000) {
+    x = __primitive_pushr1(x, i);
+    x = __primitive_ap10(-(int)i, x);
+  }
+  if(x.size != 2000 ||
+     *arr_elem(&x, 0) != 999 ||
+     *arr_elem(&x, 1999) != -999) return -2;
+  printf("%d ints used for %d elements\n", (int)(mem_ptr - start), x.size);
+  return 0;
+}
+
 #if INTERFACE
 
 #define __primitive_add_iii(x, y) x + y
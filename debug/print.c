@@ -17,6 +17,7 @@
 
 #include "rt_types.h"
 #include <string.h>
+#include <stdlib.h>
 #include <inttypes.h>
 
 #if INTERFACE
@@ -43,8 +44,28 @@
 #include "debug/tags.h"
 #include "var.h"
 
-STATIC_ALLOC_DEPENDENT(visited, uint8_t, (cells_size + 7) / 8);
-STATIC_ALLOC_DEPENDENT(marked, uint8_t, (cells_size + 7) / 8);
+// bitsets indexed by cell, resized as `cells` grows
+static uint8_t *visited = NULL;
+static uint8_t *marked = NULL;
+static size_t visited_size = 0;
+static size_t marked_size = 0;
+
+static
+uint8_t *fit_bitset(uint8_t *m, size_t *size) {
+  size_t n = (cells_size + 7) / 8;
+  if(n > *size) {
+    m = realloc(m, n);
+    memset(m + *size, 0, n - *size);
+    *size = n;
+  }
+  return m;
+}
+
+static
+void fit_cell_bitsets() {
+  visited = fit_bitset(visited, &visited_size);
+  marked = fit_bitset(marked, &marked_size);
+}
 
 static enum {
   BASE_DEC = 0,
@@ -54,29 +75,24 @@ static enum {
 
 void mark_cell(cell_t *c) {
   if(is_cell(c)) {
+    fit_cell_bitsets();
     set_bit(marked, CELL_INDEX(c));
   }
 }
 
-char const *show_alt_set(uintptr_t as) {
-  static char out[sizeof(as)*4+1];
+char const *show_alt_set(alt_set_t as) {
+  static THREAD_LOCAL char out[AS_SIZE+1];
   char *p = out;
-  unsigned int n = sizeof(as)*4;
-  const unsigned int shift = sizeof(as) * 8 - 2;
-  uintptr_t mask = ((uintptr_t)3) << shift;
+  unsigned int n = AS_SIZE;
 
-  while(!(as & mask) && n) {
-    as <<= 2;
-    n--;
-  }
+  while(n && !as_get(as, n - 1)) n--;
   while(n--) {
-    switch(as >> shift) {
+    switch(as_get(as, n)) {
     case 0: *p++ = 'X'; break;
     case 1: *p++ = '0'; break;
     case 2: *p++ = '1'; break;
     case 3: *p++ = 'E'; break;
     }
-    as <<= 2;
   }
   *p++ = '\0';
   return out;
@@ -125,7 +141,7 @@ void get_name(const cell_t *c, const char **module_name, const char **word_name)
 }
 
 char const *function_token(const cell_t *c) {
-  static char ap_str[] = "ap00";
+  static THREAD_LOCAL char ap_str[] = "ap00";
   op op = c->op;
   if(op == OP_ap) {
     csize_t
@@ -168,6 +184,7 @@ void make_graph(char const *path, cell_t const *c) {
              "graph [\n"
              "rankdir = \"RL\"\n"
              "];\n", path);
+  fit_cell_bitsets();
   static_zero(visited);
   graph_cell(f, c);
   fprintf(f, "}\n");
@@ -195,6 +212,7 @@ void make_graph_all(char const *path) {
              "graph [\n"
              "rankdir = \"RL\"\n"
              "];\n", path, label);
+  fit_cell_bitsets();
   static_zero(visited);
   STATIC_FOREACH(i, cells) {
     graph_cell(f, &cells[i]);
@@ -443,12 +461,12 @@ void show_string(cell_t const *c) {
 }
 
 bool any_alt_overlap(cell_t const * const *p, csize_t size) {
-  uintptr_t mask = 0;
+  alt_set_t mask = 0;
   while(size--) {
     if(is_value(*p)) {
       alt_set_t m = as_mask((*p)->value.alt_set);
-      if(mask & m) return true;
-      mask |= m;
+      if(as_intersect(mask, m)) return true;
+      mask = as_union(mask, m);
     }
     p++;
   }
@@ -456,10 +474,10 @@ bool any_alt_overlap(cell_t const * const *p, csize_t size) {
 }
 
 csize_t any_conflicts(cell_t const * const *p, csize_t size) {
-  uintptr_t as = 0;
+  alt_set_t as = 0;
   COUNTUP(i, size) {
     if(is_value(*p)) {
-      as |= (*p)->value.alt_set;
+      as = as_union(as, (*p)->value.alt_set);
       if(as_conflict(as)) {
         return size - i;
       }
@@ -622,7 +640,7 @@ char *show_type_all(const cell_t *c) {
     "INLINE",
     "TRACED"
   };
-  static char buf[64];
+  static THREAD_LOCAL char buf[64];
   char *p = buf;
   p += sprintf(p, "%s", show_type(c->value.type));
   FOREACH(i, type_flag_name) {
@@ -659,7 +677,7 @@ char *show_type_all_short(const cell_t *c) {
     '@',
     '!'
   };
-  static char buf[LENGTH(type_flag_char) + 1];
+  static THREAD_LOCAL char buf[LENGTH(type_flag_char) + 1];
 
   char *p = buf;
 
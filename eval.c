@@ -26,7 +26,12 @@
 #include <dirent.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
 #include <inttypes.h>
+#ifdef THREAD_LOCAL_STATE
+#include <pthread.h>
+#endif
 
 #if defined(USE_READLINE)
 #include <readline/readline.h>
@@ -55,6 +60,9 @@
 #include "module.h"
 #include "list.h"
 #include "ir/trace.h"
+#include "ir/cache.h"
+#include "ir/deps.h"
+#include "ir/vm.h"
 #include "git_log.h"
 #include "debug/log_tree.h"
 #include "io.h"
@@ -74,6 +82,7 @@
 
 #define HISTORY_FILE ".poprc_history"
 #define RC_FILE ".poprc_rc"
+#define CACHE_FILE ".poprc_cache"
 
 bool quit = false;
 bool command_line = false;
@@ -107,6 +116,7 @@ void stats_stop() {
   saved_stats.stop = clock();
   saved_stats.alt_cnt = alt_cnt;
   saved_stats.trace_cnt = trace_count();
+  saved_stats.free_blocks = free_block_count();
 }
 
 void stats_display() {
@@ -114,16 +124,20 @@ void stats_display() {
     (double)CLOCKS_PER_SEC;
   printf("time         : %.3e sec\n"
          "allocated    : %d cells\n"
+         "interned     : %d cells\n"
          "working set  : %d cells\n"
          "reductions   : %d\n"
          "failures     : %d\n"
-         "trace        : %d\n",
+         "trace        : %d\n"
+         "fragments    : %d free blocks\n",
          time,
          saved_stats.alloc_cnt,
+         saved_stats.interned_cnt,
          saved_stats.max_alloc_cnt,
          saved_stats.reduce_cnt,
          saved_stats.fail_cnt,
-         saved_stats.trace_cnt
+         saved_stats.trace_cnt,
+         saved_stats.free_blocks
     );
   printf("rate         :");
   if(time != 0) {
@@ -134,6 +148,9 @@ void stats_display() {
          "alts used    : %d\n",
          saved_stats.alt_cnt);
   printf("static bytes : %ld\n", get_mem_size());
+  printf("cell bytes   : %ld of %ld reserved\n",
+         cells_size * sizeof(cell_t),
+         cells_max * sizeof(cell_t));
 }
 
 PARAMETER(echo, bool, false, "whether the input line is echoed") {
@@ -171,7 +188,16 @@ COMMAND(eval, "evaluate the argument") {
     } else {
       seg_t src = src_text(p);
       stats_start();
-      show_eval("  ", src, eval(p, &previous_result));
+      alt_fork_start();
+      cell_t *c = eval(p, &previous_result);
+      if(alt_fork_retry()) {
+        // a worker's results may share lists with the first result, so evaluate again in one process
+        alt_fork_stop();
+        drop(previous_result);
+        previous_result = NULL;
+        c = eval(p, &previous_result);
+      }
+      show_eval("  ", src, c);
       stats_stop();
     }
   }
@@ -227,6 +253,7 @@ int main(int argc, char **argv) {
   sa.sa_sigaction = crash_handler;
   sigaction(SIGSEGV, &sa, NULL);
 
+  stack_init(&sa);
   static_alloc_init();
   log_init();
   io_init();
@@ -235,9 +262,18 @@ int main(int argc, char **argv) {
 
   for(;;) {
     CATCH(&error) {
-      printf(NOTE("ERROR") " ");
-      print_last_log_msg();
-      print_active_entries("  - while compiling ");
+      if(alt_worker_failed) {
+        alt_fork_print(); // the error from the worker
+      } else {
+        printf(NOTE("ERROR") " ");
+        print_last_log_msg();
+        print_active_entries("  - while compiling ");
+      }
+      alt_fork_stop();
+      if(alt_worker) {
+        fflush(stdout);
+        _exit(1);
+      }
       if(exit_on_error) {
         printf("\nExiting on error.\n");
         printf("\n___ LOG ___\n");
@@ -258,6 +294,7 @@ int main(int argc, char **argv) {
       }
       cells_init();
       parse_init();
+      deps_init();
       module_init();
       eval_init();
       char *home = getenv("HOME");
@@ -282,6 +319,12 @@ int main(int argc, char **argv) {
 
         if(strcmp(exec_name, "popr") == 0) {
           eval_command_string(":ld " PREFIX "/share/poprc", 0);
+          if(home) {
+            char *cache_cmd;
+            asprintf(&cache_cmd, ":cache %s/" CACHE_FILE, home);
+            eval_command_string(cache_cmd, 0);
+            free(cache_cmd);
+          }
           eval_command_string(":import", 0);
         }
 
@@ -319,7 +362,9 @@ int main(int argc, char **argv) {
       command_line = false;
 
       if(!quit) run_eval(echo);
+      trace_cache_save();
       drop(previous_result);
+      free_entry_defs();
       free_modules();
       unload_files();
       if(run_leak_test &&
@@ -344,6 +389,7 @@ void emscripten_init(bool reinit) {
   io_init();
   cells_init();
   parse_init();
+  deps_init();
   module_init();
   eval_init();
   trace_reinit();
@@ -632,17 +678,38 @@ bool can_reduce(cell_t *l) {
      closure_is_ready(l->value.ptr[0]));
 }
 
-void reduce_root(cell_t **cp, int depth, int limit) {
+// true if reduce_root would leave the nested lists of l unchanged
+static
+bool nested_reduced(cell_t *l) {
+  cell_t **p;
+  FORLIST(p, l, true) {
+    if(can_reduce(*p)) {
+      cell_t **q;
+      FORLIST(q, *p, true) {
+        if(!is_value(*q)) return false;
+      }
+      if(!nested_reduced(*p)) return false;
+    }
+  }
+  return true;
+}
+
+// reduce the list *cp and its nested lists, keeping at most max results if max > 0
+void reduce_root(cell_t **cp, int depth, int limit, int max) {
   if(depth < limit) {
+    if(!depth) defer_free = true;
     insert_root(cp);
-    reduce_list(cp, depth);
-    if(*cp) { // alt?
+    reduce_list(cp, depth, max);
+    if(!depth) alt_fork_collect();
+    // only the first result is reduced further, and workers never have it
+    if(*cp && !alt_worker) { // alt?
       cell_t **p;
       FORLIST(p, *cp, true) { // ***
-        if(can_reduce(*p)) reduce_root(p, depth + 1, limit);
+        if(can_reduce(*p)) reduce_root(p, depth + 1, limit, 0);
       }
     }
     remove_root(cp);
+    if(!depth) drop_flush();
   }
 }
 
@@ -712,10 +779,12 @@ cell_t *eval(const cell_t *p, cell_t **previous) {
     *previous = NULL;
   } else {
     p = p->tok_list.next;
+    alt_fork_stop(); // can't be evaluated again
   }
   if(!allow_io && has_IO(p)) {
     if(!quiet) printf("IO not allowed.\n");
   } else {
+    if(has_IO(p)) alt_fork_stop(); // IO happens in order
     c = parse_expr(&p, eval_module(), NULL);
     if(!c) {
       if(!quiet) {
@@ -733,12 +802,13 @@ cell_t *eval(const cell_t *p, cell_t **previous) {
     left = *leftmost(&c);
     if(left && !closure_is_ready(left)) { // Automatic IO
       incomplete = true;
+      alt_fork_stop();
       if(allow_io && !has_IO(p)) {
         arg(left, val(T_SYMBOL, SYM_IO));
       }
     }
     if(!left || closure_is_ready(left)) {
-      reduce_root(&c, 0, reduction_limit);
+      reduce_root(&c, 0, reduction_limit, max_results);
       if(c) {
         ASSERT_REF();
         *previous = c;
@@ -755,9 +825,21 @@ cell_t *eval(const cell_t *p, cell_t **previous) {
 }
 
 void show_eval(const char *prefix, seg_t src, const cell_t *c) {
-  if(c) {
-    show_alts(prefix, c);
-  } else if (!quiet) {
+  if(alt_worker) {
+    // the parent reduces the nested lists of the first result in place,
+    // which may change lists shared with these results
+    if(alt_fork_retry()) _exit(ALT_WORKER_RETRY);
+    FOLLOW(p, c, alt) {
+      if(!nested_reduced((cell_t *)p)) _exit(ALT_WORKER_RETRY);
+    }
+    if(c) show_alts(prefix, c);
+    alt_fork_print();
+    fflush(stdout);
+    _exit(0);
+  }
+  if(c) show_alts(prefix, c);
+  bool forked = alt_fork_print(); // results from workers follow
+  if(!c && !forked && !quiet) {
     printf("\n");
     highlight_errors(src);
     printf(" |\n");
@@ -778,7 +860,7 @@ bool get_arity(const cell_t *p, csize_t *in, csize_t *out, cell_t *module) {
 }
 
 STATIC_ALLOC(files, struct mmfile, 16);
-size_t files_cnt = 0;
+THREAD_LOCAL size_t files_cnt = 0;
 
 bool load_file(int dirfd, const char *path) {
   if(files_cnt >= files_size) {
@@ -847,6 +929,43 @@ bool unload_files() {
   return success;
 }
 
+// position of p within the loaded files counting from 1, or 0 if not found
+uintptr_t loaded_file_pos(const char *p) {
+  uintptr_t pos = 1;
+  COUNTUP(i, files_cnt) {
+    const struct mmfile *f = &files[i];
+    if(p >= f->data && p < f->data + f->size) {
+      return pos + (p - f->data);
+    }
+    pos += f->size;
+  }
+  return 0;
+}
+
+// inverse of loaded_file_pos()
+const char *loaded_file_ptr(uintptr_t pos) {
+  if(!pos--) return NULL;
+  COUNTUP(i, files_cnt) {
+    const struct mmfile *f = &files[i];
+    if(pos < f->size) return f->data + pos;
+    pos -= f->size;
+  }
+  return NULL;
+}
+
+// hash the contents of the loaded files, in order
+uintptr_t loaded_files_hash() {
+  uintptr_t hash = 5381;
+  COUNTUP(i, files_cnt) {
+    const struct mmfile *f = &files[i];
+    COUNTUP(j, f->size) {
+      hash = hash * 33 + (unsigned char)f->data[j];
+    }
+    hash = hash * 33 + f->size;
+  }
+  return hash;
+}
+
 COMMAND(bits, "number of bits in a pointer") {
   printf("%d\n", (int)sizeof(void *) * 8);
   if(command_line) quit = true;
@@ -1021,6 +1140,10 @@ PARAMETER(reduction_limit, int, 5, "reduction limit") {
   reduction_limit = clamp(1, 100, arg);
 }
 
+PARAMETER(max_results, int, 0, "maximum number of results, or 0 for all") {
+  max_results = max(0, arg);
+}
+
 COMMAND(tag, "convert tag <-> hex") {
   if(match_class(rest, CC_NUMERIC, 0, 64)) {
     int x = parse_num(rest);
@@ -1036,6 +1159,10 @@ COMMAND(tag, "convert tag <-> hex") {
 
 bool call(tcell_t *e, val_t *in_args, val_t *out_args) {
   assert_throw(e && NOT_FLAG(*e, entry, PRIMITIVE));
+  if(use_vm && vm_supported(e)) {
+    vm_result r = vm_call(e, in_args, out_args);
+    if(r != VM_ABORT) return r == VM_SUCCESS;
+  }
   csize_t in = e->entry.in;
   csize_t out = e->entry.out;
   cell_t *c = func(OP_exec, in + 1, out);
@@ -1050,7 +1177,7 @@ bool call(tcell_t *e, val_t *in_args, val_t *out_args) {
   }
   refn(c, out-1);
   closure_set_ready(c, true);
-  reduce_root(&l, 0, reduction_limit);
+  reduce_root(&l, 0, reduction_limit, 1); // only the first result is used
   if(!l) return false;
   ASSERT_REF();
   if(out_args) {
@@ -1072,6 +1199,206 @@ void inputs_from_number(int n, range_t *bounds, int bounds_n, val_t *input) {
 
 #define ANALYZE_ARGS 8
 #define ANALYZE_MAX_COMBINATIONS (1<<24)
+#define ANALYZE_MAX_JOBS 64
+
+static int analyze_jobs = 1;
+
+COMMAND(jobs, "set the number of worker processes for analyze") {
+  if(match_class(rest, CC_NUMERIC, 0, 64)) {
+    analyze_jobs = clamp(1, ANALYZE_MAX_JOBS, parse_num(rest));
+  }
+  if(!quiet) printf("%d\n", analyze_jobs);
+}
+
+// atomically lower *x to v
+static
+void lower_to(int *x, int v) {
+  int prev = __atomic_load_n(x, __ATOMIC_RELAXED);
+  while(v < prev &&
+        !__atomic_compare_exchange_n(x, &prev, v, true,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// call entry on inputs start, start + step, ... below *fail,
+// and lower *fail to the index of the first failing input
+static
+void analyze_slice(tcell_t *entry, range_t *ranges, csize_t in,
+                   int start, int step, int *fail, bool dots) {
+  val_t inputs[ANALYZE_ARGS];
+  int n = DIV_UP(max(0, *fail - start), step);
+  int dot = n / 80;
+  for(int i = start; i < __atomic_load_n(fail, __ATOMIC_RELAXED); i += step) {
+    if(dots) {
+      if(!dot) {
+        dot = n / 80;
+        putchar('.');
+        fflush(stdout);
+      } else dot--;
+    }
+    inputs_from_number(i, ranges, in, inputs);
+    rt_init();
+    if(!call(entry, inputs, NULL)) {
+      lower_to(fail, i);
+      break;
+    }
+  }
+}
+
+// sent from each worker to the parent
+typedef struct {
+  bool done;
+  stats_t stats;
+} analyze_result_t;
+
+// fork workers that each test a strided slice of the inputs below *fail
+static
+bool analyze_parallel(tcell_t *entry, range_t *ranges, csize_t in, int *fail) {
+  pid_t pid[ANALYZE_MAX_JOBS];
+  int fd[ANALYZE_MAX_JOBS];
+  int jobs = analyze_jobs;
+
+  // shared so that workers can stop early
+  int *shared = mmap(NULL, sizeof(int),
+                     PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_ANONYMOUS,
+                     -1, 0);
+  if(shared == MAP_FAILED) return false;
+  *shared = *fail;
+
+  fflush(stdout);
+  COUNTUP(j, jobs) {
+    int p[2];
+    if(pipe(p)) {
+      jobs = j;
+      break;
+    }
+    if((pid[j] = fork()) < 0) {
+      close(p[0]);
+      close(p[1]);
+      jobs = j;
+      break;
+    }
+    if(!pid[j]) {
+      // worker
+      error_t error;
+      analyze_result_t result = { .done = false };
+      close(p[0]);
+      CATCH(&error) {
+        print_last_log_msg();
+      } else {
+        stats_start();
+        analyze_slice(entry, ranges, in, j, analyze_jobs, shared, j == 0);
+        result.done = true;
+      }
+      result.stats = stats;
+      result.stats.stop = clock();
+      fflush(stdout);
+      bool ok = write(p[1], &result, sizeof(result)) == sizeof(result);
+      _exit(ok ? 0 : 1);
+    }
+    close(p[1]);
+    fd[j] = p[0];
+  }
+
+  // collect results
+  bool done = jobs == analyze_jobs;
+  COUNTUP(j, jobs) {
+    analyze_result_t result;
+    if(read(fd[j], &result, sizeof(result)) == sizeof(result)) {
+      done &= result.done;
+      stats.reduce_cnt += result.stats.reduce_cnt;
+      stats.fail_cnt += result.stats.fail_cnt;
+      stats.alloc_cnt += result.stats.alloc_cnt;
+      stats.interned_cnt += result.stats.interned_cnt;
+      stats.max_alloc_cnt = max(stats.max_alloc_cnt, result.stats.max_alloc_cnt);
+
+      // count CPU time used by the worker
+      stats.start -= result.stats.stop - result.stats.start;
+    } else {
+      done = false;
+    }
+    close(fd[j]);
+    waitpid(pid[j], NULL, 0);
+  }
+  *fail = *shared;
+  munmap(shared, sizeof(int));
+  return done;
+}
+
+#ifdef THREAD_LOCAL_STATE
+typedef struct {
+  const char *def, *expr;
+  val_t expected;
+  int result;
+} eval_thread_t;
+
+// set up a runtime in this thread, define `f`, and repeatedly evaluate `expr`
+static
+void *eval_thread(void *arg) {
+  eval_thread_t *t = arg;
+  error_t error;
+  stack_init(&t);
+  static_alloc_reinit();
+  log_init();
+  t->result = -1;
+  CATCH(&error, true) {
+    t->result = -2;
+  } else {
+    cells_init();
+    parse_init();
+    deps_init();
+    module_init();
+    parse_eval_def(string_seg("f"), lex(t->def, NULL));
+    COUNTUP(i, 100) {
+      cell_t *prev = NULL;
+      cell_t *p = lex(t->expr, NULL);
+      const cell_t *c = eval(p, &prev);
+      free_toks(p);
+      bool ok = c && !c->alt && list_size(c) == 1 &&
+        is_value(c->value.ptr[0]) &&
+        c->value.ptr[0]->value.integer == t->expected;
+      drop(prev);
+      if(!ok) break;
+      if(i == 99) t->result = 0;
+    }
+    free_modules();
+  }
+  stack_free();
+  return NULL;
+}
+#endif
+
+// evaluate concurrently in threads, each with its own runtime
+// small stacks, so deep reductions must continue on heap segments
+TEST(thread_eval) {
+#ifdef THREAD_LOCAL_STATE
+  eval_thread_t t[] = {
+    { .def = "dup * 1 +", .expr = "3 f", .expected = 10 },
+    { .def = "1 + dup *", .expr = "3 f", .expected = 16 },
+    { .def = "[0 == 0 swap !] [dup 1- f 1+ swap 0 > !] | pushl popr swap drop",
+      .expr = "300 f", .expected = 300 }
+  };
+  pthread_t th[LENGTH(t)];
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  // thread-local state takes about 2MB of this, leaving a small stack
+  pthread_attr_setstacksize(&attr, 5 << 19);
+  int res = 0;
+  size_t n = 0;
+  while(n < LENGTH(t) &&
+        !pthread_create(&th[n], &attr, eval_thread, &t[n])) n++;
+  if(n < LENGTH(t)) res = -1;
+  COUNTUP(i, n) {
+    pthread_join(th[i], NULL);
+    if(!res && t[i].result) res = t[i].result * 10 - i;
+  }
+  pthread_attr_destroy(&attr);
+  return res;
+#else
+  return 0; // needs USE_THREAD_LOCAL=y
+#endif
+}
+
 COMMAND(analyze, "analyze a function") {
   range_t ranges[ANALYZE_ARGS];
   val_t inputs[ANALYZE_ARGS];
@@ -1097,24 +1424,19 @@ COMMAND(analyze, "analyze a function") {
     assert_throw(combinations <= ANALYZE_MAX_COMBINATIONS, "too many combinations");
     printf("%d combinations to test\n", combinations);
     stats_start();
-    int dot = combinations / 80;
-    COUNTUP(i, combinations) {
-      if(!dot) {
-        dot = combinations / 80;
-        putchar('.');
-        fflush(stdout);
-      } else dot--;
-      inputs_from_number(i, ranges, in, inputs);
-      rt_init();
-      bool success = call(entry, inputs, NULL);
-      if(!success) {
-        printf("\nFAILED test %d with inputs:", (int)i);
-        COUNTUP(j, in) {
-          printf(" %d", (int)inputs[j]);
-        }
-        printf("\n");
-        break;
+    int fail = combinations;
+    if(analyze_jobs > 1) {
+      assert_throw(analyze_parallel(entry, ranges, in, &fail), "analyze worker failed");
+    } else {
+      analyze_slice(entry, ranges, in, 0, 1, &fail, true);
+    }
+    if(fail < combinations) {
+      inputs_from_number(fail, ranges, in, inputs);
+      printf("\nFAILED test %d with inputs:", fail);
+      COUNTUP(j, in) {
+        printf(" %d", (int)inputs[j]);
       }
+      printf("\n");
     }
     printf("\n");
     stats_stop();
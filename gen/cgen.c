@@ -160,6 +160,21 @@ void gen_body(const tcell_t *e) {
   }
 }
 
+// compute loop invariant values once, before the loop and its memory mark
+static
+void gen_preheader(const tcell_t *e) {
+  bool first = true;
+  FOR_TRACE_CONST(c, e) {
+    if(FLAG(*c, trace, INVARIANT)) {
+      if(first) {
+        printf("\n  // loop invariant\n");
+        first = false;
+      }
+      gen_call(e, c, 0);
+    }
+  }
+}
+
 static
 void gen_return(const tcell_t *e, const tcell_t *l) {
   csize_t out_n = list_size(l);
@@ -284,7 +299,8 @@ bool last_call(const tcell_t *e, const tcell_t *c) {
 bool gen_instruction(const tcell_t *e, const tcell_t *c, int depth) {
   if(is_return(c))         { gen_return(e, c);        } else
   if(gen_skip(c) ||
-     is_value(c))          { /* nothing */            } else
+     is_value(c) ||
+     FLAG(*c, trace, INVARIANT)) { /* nothing */      } else
   if(c->op == OP_assert)   { gen_assert(e, c, depth); } else
   if(get_entry(c) == e &&
      last_call(e, c))      { gen_tail_call(e, c);
@@ -335,6 +351,60 @@ int cgen_index(const tcell_t *e, const cell_t *a) {
   return cgen_lookup(e, &e[tr_index(a)]);
 }
 
+// print an array of pointers to the arguments of type t, and its length
+static
+void gen_arg_refs(const tcell_t *e, type_t t) {
+  csize_t in = e->entry.in;
+  int n = 0;
+  COUNTUP(i, in) {
+    if(trace_type(&e[in - i]) == t) n++;
+  }
+  if(!n) {
+    printf("NULL, 0");
+    return;
+  }
+  printf("(%s*[]) {", ctype(t));
+  char *sep = "";
+  COUNTUP(i, in) {
+    if(trace_type(&e[in - i]) == t) {
+      printf("%s&%s%d", sep, cname(t), (int)(in - i));
+      sep = ", ";
+    }
+  }
+  printf("}, %d", n);
+}
+
+// can evaluating e allocate strings or arrays?
+// calls are followed up to depth, and assumed to allocate beyond that
+static
+bool may_allocate(const tcell_t *e, int depth) {
+  FOR_TRACE_CONST(c, e) {
+    type_t t = trace_type(c);
+    if(t == T_STRING || t == T_LIST || is_external(c)) return true;
+    if(c->op == OP_exec && c->trace.type != T_BOTTOM) {
+      const tcell_t *x = get_entry(c);
+      if(x != e && (!depth || may_allocate(x, depth - 1))) return true;
+    }
+  }
+  return false;
+}
+
+// only loops that may allocate need to release memory on each iteration
+static
+bool needs_mem_release(const tcell_t *e) {
+  return is_self_recursive(e) && may_allocate(e, 4);
+}
+
+// reclaim memory allocated in the last iteration, except for the arguments
+static
+void gen_mem_release(const tcell_t *e) {
+  printf("  mem_release(mark,\n              ");
+  gen_arg_refs(e, T_STRING);
+  printf(",\n              ");
+  gen_arg_refs(e, T_LIST);
+  printf(");\n");
+}
+
 void gen_tail_call(const tcell_t *e, const tcell_t *c) {
   csize_t in = closure_in(c);
   printf("\n  // tail call\n");
@@ -348,6 +418,8 @@ void gen_tail_call(const tcell_t *e, const tcell_t *c) {
            cname(trace_type(&e[a])), a);
   };
 
+  if(needs_mem_release(e)) gen_mem_release(e);
+
   // jump to the beginning
   printf("  goto entry;\n");
 }
@@ -583,6 +655,10 @@ void gen_function(tcell_t *e) {
   gen_function_signature(e);
   printf("\n{\n");
   gen_decls(e);
+  gen_preheader(e);
+  if(needs_mem_release(e)) {
+    printf("  const mem_mark_t mark = mem_mark();\n");
+  }
   gen_body(e);
   printf("}\n");
   printf("} // end ");
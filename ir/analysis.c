@@ -281,6 +281,65 @@ void last_use_analysis(tcell_t *entry) {
   }
 }
 
+// ops that always produce the same result from the same inputs
+bool is_pure_op(op op) {
+  switch(op) {
+  case OP_add: case OP_mul: case OP_sub: case OP_div: case OP_mod:
+  case OP_negate: case OP_add_float: case OP_mul_float: case OP_sub_float:
+  case OP_div_float: case OP_log: case OP_exp: case OP_cos: case OP_sin:
+  case OP_tan: case OP_atan2: case OP_sqrt: case OP_bitand: case OP_bitor:
+  case OP_bitxor: case OP_shiftl: case OP_shiftr: case OP_complement:
+  case OP_not: case OP_gt: case OP_gte: case OP_lt: case OP_lte:
+  case OP_eq: case OP_eq_s: case OP_neq: case OP_neq_s: case OP_to_float:
+  case OP_trunc: case OP_strcat: case OP_eq_str: case OP_to_string:
+  case OP_to_string_bin: case OP_from_string: case OP_from_string_bin:
+  case OP_strtrim: case OP_quote:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// can tc be computed once before a self tail recursive loop?
+static
+bool is_loop_invariant(tcell_t *entry, tcell_t *tc) {
+  if(!tc->op ||
+     is_value(tc) ||
+     !is_pure_op(tc->op) ||
+     closure_out(tc) ||
+     FLAG(*tc, expr, PARTIAL) ||
+     trace_type(tc) == T_BOTTOM) return false;
+  TRAVERSE(tc, in) {
+    if(!*p) return false;
+    tcell_t *a = &entry[tr_index(*p)];
+    if(is_var(a) ? FLAG(*a, trace, CHANGES) :
+       !is_value(a) && NOT_FLAG(*a, trace, INVARIANT)) return false;
+  }
+  return true;
+}
+
+// mark pure expressions that only depend on inputs that don't change
+// across self tail calls, so that they can be hoisted out of the loop
+// must follow trace_recursive_changes()
+void loop_invariant_analysis(tcell_t *entry) {
+  bool loops = false;
+  FOR_TRACE(tc, entry) {
+    if(is_user_func(tc) &&
+       get_entry(tc) == entry &&
+       FLAG(*tc, trace, JUMP)) {
+      loops = true;
+      break;
+    }
+  }
+  if(!loops) return;
+  FOR_TRACE(tc, entry) {
+    if(is_loop_invariant(entry, tc)) {
+      LOG("loop invariant %s[%d]", entry->word_name, tc - entry);
+      FLAG_SET(*tc, trace, INVARIANT);
+    }
+  }
+}
+
 // mark jumps, where return information isn't needed e.g. tail calls
 void mark_jumps(tcell_t *entry) {
   tcell_t *jump = NULL;
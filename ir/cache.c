@@ -0,0 +1,346 @@
+/* Copyright 2012-2020 Dustin DeWeese
+   This file is part of PoprC.
+
+    PoprC is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PoprC is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with PoprC.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "rt_types.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "startle/error.h"
+#include "startle/test.h"
+#include "startle/support.h"
+#include "startle/log.h"
+
+#include "cells.h"
+#include "eval.h"
+#include "ir/cache.h"
+#include "ir/compile.h"
+#include "ir/deps.h"
+#include "ir/trace.h"
+#include "ir/analysis.h"
+#include "parse/parse.h"
+#include "parse/lex.h"
+#include "module.h"
+#include "list.h"
+#include "var.h"
+#include "git_log.h"
+#include "parameters.h"
+
+// On-disk cache of compiled (compacted) trace entries
+//
+// The cache is a copy of trace_cells with pointers replaced by positions:
+//   - entry.parent and var pointers become trace indices + 1
+//   - word and module names become offsets + 1 into a string table
+//   - source text becomes a position within the loaded files (see loaded_file_pos())
+// It is keyed by a hash of the build, compile parameters, and the contents
+// of all loaded files, so it is invalidated whenever any of those change.
+
+#define TRACE_CACHE_MAGIC "poprtc2"
+
+typedef struct {
+  char magic[8];
+  uintptr_t key;
+  uint32_t tcell_size;
+  uint32_t cells;   // number of trace cells
+  uint32_t symbols; // number of symbols at the start of the string table
+  uint32_t strings; // size of the string table
+  uint32_t digest;  // entries_digest()
+} trace_cache_header_t;
+
+static char cache_path[256] = "";
+static uintptr_t cache_key = 0;
+static int cache_restored = 0; // number of cells restored
+
+// parameters that change compiled code
+static
+uintptr_t compile_parameters_hash() {
+  return unroll_limit * 33 + inline_budget;
+}
+
+static
+uintptr_t trace_cache_key() {
+  uintptr_t hash = loaded_files_hash();
+  const char *s = GIT_LOG;
+  while(*s) hash = hash * 33 + (unsigned char)*s++;
+  hash = hash * 33 + compile_parameters_hash();
+  return hash * 33 + sizeof(tcell_t);
+}
+
+// string table used while saving
+typedef struct {
+  char *data;
+  uint32_t size, capacity;
+} string_table_t;
+
+static
+uintptr_t add_string(string_table_t *t, const char *s) {
+  if(!s) return 0;
+  uint32_t n = strlen(s) + 1;
+  if(t->size + n > t->capacity) {
+    t->capacity = max(256, 2 * (t->size + n));
+    t->data = realloc(t->data, t->capacity);
+    assert_error(t->data);
+  }
+  uint32_t offset = t->size;
+  memcpy(t->data + offset, s, n);
+  t->size += n;
+  return offset + 1;
+}
+
+static
+uintptr_t encode_ptr(const tcell_t *p) {
+  return is_trace_cell(p) ? entry_number(p) + 1 : 0;
+}
+
+static
+tcell_t *decode_ptr(uintptr_t x) {
+  return x ? trace_cell_at(x - 1) : NULL;
+}
+
+static
+void encode_src(seg_t *src) {
+  uintptr_t pos = src->s ? loaded_file_pos(src->s) : 0;
+  src->s = (const char *)pos;
+  if(!pos) src->n = 0;
+}
+
+static
+void decode_src(seg_t *src) {
+  src->s = loaded_file_ptr((uintptr_t)src->s);
+  if(!src->s) src->n = 0;
+}
+
+// replace pointers in cells with positions
+static
+bool encode_entries(tcell_t *cells, size_t n, string_table_t *strings) {
+  tcell_t *end = cells + n;
+  for(tcell_t *e = cells; e < end; e += trace_entry_size(e)) {
+    if(FLAG(*e, entry, BLOCK) ||
+       e->pos ||
+       e->entry.specialize) return false; // not compacted
+    e->word_name = (const char *)add_string(strings, e->word_name);
+    e->module_name = (const char *)add_string(strings, e->module_name);
+    e->entry.parent = (tcell_t *)encode_ptr(e->entry.parent);
+    encode_src(&e->src);
+    FOR_TRACE(tc, e) {
+      encode_src(&tc->src);
+      if(is_var(tc)) {
+        tc->value.var = (tcell_t *)encode_ptr(tc->value.var);
+      }
+    }
+  }
+  return true;
+}
+
+// inverse of encode_entries, except for names
+static
+bool decode_entries(tcell_t *cells, size_t n) {
+  tcell_t *end = cells + n;
+  for(tcell_t *e = cells; e < end; e += trace_entry_size(e)) {
+    if(e->entry.len + 1 > end - e) return false;
+  }
+  for(tcell_t *e = cells; e < end; e += trace_entry_size(e)) {
+    e->entry.parent = decode_ptr((uintptr_t)e->entry.parent);
+    decode_src(&e->src);
+    FOR_TRACE(tc, e) {
+      decode_src(&tc->src);
+      if(is_var(tc)) {
+        tc->value.var = decode_ptr((uintptr_t)tc->value.var);
+      }
+    }
+  }
+  return true;
+}
+
+// hash all entries, without changing the stored hashes,
+// because hash_entry() also uses the stored hashes of called entries
+static
+uint32_t entries_digest(tcell_t *cells, size_t n) {
+  uint32_t digest = 1;
+  tcell_t *end = cells + n;
+  for(tcell_t *e = cells; e < end; e += trace_entry_size(e)) {
+    uint32_t hashes[e->entry.len + 1];
+    COUNTUP(i, e->entry.len + 1) hashes[i] = e[i].trace.hash;
+    digest = digest * 1979 + hash_entry(e);
+    COUNTUP(i, e->entry.len + 1) e[i].trace.hash = hashes[i];
+  }
+  return digest;
+}
+
+// entries must share their module's name
+static
+const char *restore_module_name(const char *name) {
+  cell_t *m = get_module(string_seg(name));
+  return m ? module_name(m) : seg_string(string_seg(name));
+}
+
+// replace the definition of a top level entry's word with the entry
+static
+bool register_entry(tcell_t *e) {
+  if(e->entry.parent || FLAG(*e, entry, QUOTE)) return false;
+  cell_t *m = get_module(string_seg(e->module_name));
+  if(!m) return false;
+  cell_t *l = module_get(m, string_seg(e->word_name));
+  if(!l || !is_list(l) || FLAG(*l, value, TRACED)) return false;
+  seg_t src = src_text(l->value.ptr[0]);
+  if(src.s != e->src.s || src.n != e->src.n) return false;
+
+  FLAG_SET(*l, value, TRACED);
+  l->alt = &e->c;
+  store_entries(e, m);
+  deps_add_restored_entry(e, l);
+  return true;
+}
+
+/** Restore compiled entries from the cache file.
+ * Only possible before anything has been compiled.
+ * @return the number of restored top level words.
+ */
+int trace_cache_restore() {
+  cache_key = trace_cache_key();
+  if(trace_count() || !cache_path[0]) return 0;
+  struct mmfile f = {
+    .path = cache_path,
+    .read_only = true
+  };
+  if(!mmap_file(&f)) return 0;
+
+  int words = 0;
+  const trace_cache_header_t *header = (trace_cache_header_t *)f.data;
+  if(f.size < sizeof(*header) ||
+     memcmp(header->magic, TRACE_CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+     header->key != cache_key ||
+     header->tcell_size != sizeof(tcell_t) ||
+     f.size != sizeof(*header) +
+               header->cells * sizeof(tcell_t) +
+               header->strings) goto done;
+
+  const tcell_t *cells = (tcell_t *)(header + 1);
+  const char
+    *strings = (char *)(cells + header->cells),
+    *strings_end = strings + header->strings;
+  if(header->strings && strings_end[-1]) goto done;
+
+  // symbols must get the same values
+  if(!symbols_match(strings, strings_end, header->symbols)) goto done;
+
+  tcell_t *start = trace_append(cells, header->cells);
+  if(!start) goto done;
+  if(!decode_entries(start, header->cells) ||
+     entries_digest(start, header->cells) != header->digest) {
+    trace_truncate(start);
+    goto done;
+  }
+
+  // only intern symbols once the cache is accepted
+  const char *s = strings;
+  COUNTUP(i, header->symbols) {
+    intern(string_seg(s));
+    s += strlen(s) + 1;
+  }
+
+  tcell_t *end = start + header->cells;
+  for(tcell_t *e = start; e < end; e += trace_entry_size(e)) {
+    uintptr_t
+      word = (uintptr_t)e->word_name,
+      module = (uintptr_t)e->module_name;
+    e->word_name = word ? seg_string(string_seg(strings + word - 1)) : NULL;
+    e->module_name = module ? restore_module_name(strings + module - 1) : NULL;
+  }
+  for(tcell_t *e = start; e < end; e += trace_entry_size(e)) {
+    if(register_entry(e)) words++;
+  }
+  trace_add_shared_entries(start);
+  cache_restored = header->cells;
+
+done:
+  munmap_file(&f);
+  return words;
+}
+
+/** Save compiled entries to the cache file,
+ * unless nothing new has been compiled, or the loaded files have changed.
+ */
+bool trace_cache_save() {
+  size_t n = trace_count();
+  if(!cache_path[0] ||
+     n <= (size_t)cache_restored ||
+     trace_cache_key() != cache_key ||
+     trace_current_entry()) return false;
+
+  bool success = false;
+  string_table_t strings = {0};
+  tcell_t *cells = malloc(n * sizeof(tcell_t));
+  assert_error(cells);
+  memcpy(cells, entry_from_number(0), n * sizeof(tcell_t));
+
+  uint32_t symbols = 0;
+  const char *s;
+  while((s = symbol_string(symbols))) {
+    add_string(&strings, s);
+    symbols++;
+  }
+  uint32_t digest = entries_digest(entry_from_number(0), n);
+  if(!encode_entries(cells, n, &strings)) goto done;
+
+  trace_cache_header_t header = {
+    .magic = TRACE_CACHE_MAGIC,
+    .key = cache_key,
+    .tcell_size = sizeof(tcell_t),
+    .cells = n,
+    .symbols = symbols,
+    .strings = strings.size,
+    .digest = digest
+  };
+
+  // write to a temporary file, then rename, so that readers never see a partial file
+  char tmp_path[sizeof(cache_path) + 8];
+  snprintf(tmp_path, sizeof(tmp_path), "%s.%d", cache_path, (int)getpid());
+  FILE *out = fopen(tmp_path, "wb");
+  if(!out) goto done;
+  success =
+    fwrite(&header, sizeof(header), 1, out) == 1 &&
+    fwrite(cells, sizeof(tcell_t), n, out) == n &&
+    fwrite(strings.data, 1, strings.size, out) == strings.size;
+  success &= fclose(out) == 0;
+  if(success) {
+    success = rename(tmp_path, cache_path) == 0;
+  } else {
+    unlink(tmp_path);
+  }
+
+done:
+  free(strings.data);
+  free(cells);
+  return success;
+}
+
+COMMAND(cache, "cache compiled words in the given file") {
+  if(rest) {
+    size_t n = read_to_ws(&rest, cache_path, sizeof(cache_path) - 1);
+    cache_path[n] = '\0';
+    cache_restored = 0;
+    int words = trace_cache_restore();
+    if(!quiet && words) printf("Restored %d compiled words from %s\n", words, cache_path);
+  } else {
+    cache_path[0] = '\0';
+  }
+}
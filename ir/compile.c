@@ -25,6 +25,7 @@
 #include "startle/support.h"
 #include "startle/map.h"
 #include "startle/log.h"
+#include "startle/static_alloc.h"
 
 #include "cells.h"
 #include "rt.h"
@@ -41,6 +42,7 @@
 #include "var.h"
 #include "ir/analysis.h"
 #include "parameters.h"
+#include "ir/deps.h"
 
 static void print_value(const cell_t *c) {
   switch(c->value.type) {
@@ -120,6 +122,9 @@ void print_bytecode(tcell_t *entry, bool tags) {
   if(FLAG(*entry, entry, RECURSIVE)) {
     printf(" rec");
   }
+  if(entry->entry.inlined) {
+    printf(" inlined %d", entry->entry.inlined);
+  }
   if(tags) {
     tag_t tag;
     write_tag(tag, entry->trace.hash);
@@ -194,8 +199,13 @@ void print_bytecode(tcell_t *entry, bool tags) {
       printf(" :: %c", type_char(tc->trace.type));
       if(FLAG(*c, expr, PARTIAL)) printf("?");
       printf(" x%d", c->n + 1);
+      if(tags && is_user_func(c)) {
+        const char *blocker = inline_blocker(entry, tc);
+        if(blocker) printf(" " FADE("(%s)"), blocker);
+      }
     }
     if(FLAG(*tc, trace, NO_SKIP)) printf(".");
+    if(FLAG(*tc, trace, INVARIANT)) printf("^");
     if(!is_value(c) && FLAG(*c, expr, TRACE)) {
       printf(" [TRACING]");
     }
@@ -395,10 +405,369 @@ void trace_drop_return(tcell_t *entry, int out, uintptr_t dep_mask) {
   entry->entry.out = used;
 }
 
+// can tc be replaced by an equivalent earlier expression?
+static
+bool cse_candidate(tcell_t *entry, tcell_t *tc) {
+  if(!tc->op ||
+     !is_expr(tc) ||
+     closure_out(tc) ||
+     trace_type(tc) == T_OPAQUE) return false;
+  if(is_user_func(tc)) {
+    tcell_t *e = get_entry(tc);
+    if(e == entry || NOT_FLAG(*e, entry, COMPLETE)) return false;
+  } else if(!is_pure_op(tc->op)) {
+    return false;
+  }
+  TRAVERSE(tc, in) {
+    // opaque values such as files are threaded through effects
+    if(!*p || trace_type(&entry[tr_index(*p)]) == T_OPAQUE) return false;
+  }
+  return true;
+}
+
+// expressions seen in the current branch by hash
+STATIC_ALLOC(cse_map, pair_t, 1 << 10);
+
+// common subexpression elimination within each branch
+// duplicates are left unreferenced to be removed by condense()
+static
+void eliminate_common_subexpressions(tcell_t *entry) {
+  csize_t len = entry->entry.len;
+  int *forward = (int *)get_trace_ptr(DIV_UP((len + 1) * sizeof(int), sizeof(tcell_t)));
+  bool found = false;
+
+  // find duplicates, comparing only within a branch
+  FOR_TRACE(tc, entry) {
+    tc->trace.hash = 0;
+  }
+  init_map(cse_map, cse_map_size);
+  FOR_TRACE(tc, entry) {
+    if(is_return(tc)) {
+      map_clear(cse_map);
+      continue;
+    }
+    if(!cse_candidate(entry, tc)) continue;
+    uint32_t hash = hash_trace_cell(entry, tc);
+    map_iterator it = map_iterator_begin(cse_map, hash);
+    for(pair_t *p = map_find_iter(&it); p; p = map_next(&it, p)) {
+      tcell_t *prev = &entry[p->second];
+      if(trace_cell_eq(entry, prev, tc)) {
+        LOG("cse %s[%d] -> %d", entry->word_name, tc - entry, prev - entry);
+        forward[tc - entry] = prev - entry;
+        found = true;
+        break;
+      }
+    }
+    if(!forward[tc - entry]) {
+      map_insert(cse_map, PAIR(hash, tc - entry)); // if full, just stop finding more
+    }
+  }
+
+  // redirect references to the earlier expression
+  if(found) {
+    FOR_TRACE(tc, entry) {
+      if(!tc->op) continue;
+      TRAVERSE(tc, in, ptrs) {
+        int x = tr_index(*p);
+        if(x > 0 && forward[x]) {
+          tr_set_index(p, forward[x]);
+          entry[forward[x]].n++;
+          entry[x].n--;
+        }
+      }
+    }
+  }
+  memset(forward, 0, (len + 1) * sizeof(int));
+}
+
+PARAMETER(inline_budget, int, 16, "cells a word may add to a caller when inlined") {
+  inline_budget = clamp(0, 1 << 10, arg);
+}
+
+// cells spliced in for a call to e
+static
+int inline_body_size(const tcell_t *e) {
+  int n = 0;
+  FOR_TRACE_CONST(p, e) {
+    if(p->op && !is_var(p) && !is_return(p)) n += calculate_tcells(p->size);
+  }
+  return n;
+}
+
+static
+int call_sites(const tcell_t *entry, const tcell_t *e) {
+  int n = 0;
+  FOR_TRACE_CONST(tc, entry) {
+    if(is_user_func(tc) && get_entry(tc) == e) n++;
+  }
+  return n;
+}
+
+// find the branch [start, ret] containing tc, excluding vars
+static
+void branch_bounds(const tcell_t *entry, const tcell_t *tc, int *start, int *ret) {
+  int s = entry->entry.in + 1;
+  *start = *ret = 0;
+  FOR_TRACE_CONST(p, entry, s) {
+    if(is_return(p)) {
+      if(p > tc) {
+        *start = s;
+        *ret = p - entry;
+        break;
+      }
+      s = p - entry + 1;
+    }
+  }
+  assert_error(*ret);
+}
+
+// can the branch [start, ret] be repeated for each alternative of the call c?
+// it must be free of effects and unreferenced by later branches, and
+// cells before c are repeated on failure, so they must not contain calls
+static
+bool branch_can_split(const tcell_t *entry, const tcell_t *c, int start, int ret) {
+  FOR_TRACE_CONST(tc, entry, start) {
+    if(tc - entry <= ret) {
+      if(trace_type(tc) == T_OPAQUE) return false;
+      // list contents are lazy, so a failure stored there won't fail the branch
+      if(ONEOF(tc->op, OP_pushr, OP_compose, OP_quote)) return false;
+      if(is_user_func(tc) && tc != c &&
+         (tc < c || (get_entry(tc) != entry &&
+                     get_entry(tc)->entry.alts > 1))) return false;
+    } else {
+      TRAVERSE(tc, const, in, ptrs) {
+        int x = tr_index(*p);
+        if(x >= start && x <= ret) return false;
+      }
+    }
+  }
+  return true;
+}
+
+// why a call can't be inlined, or NULL if it can
+const char *inline_blocker(const tcell_t *entry, const tcell_t *tc) {
+  const tcell_t *e = get_entry(tc);
+  if(e == entry) return "self";
+  if(NOT_FLAG(*e, entry, COMPLETE) ||
+     FLAG(*e, entry, RECURSIVE) ||
+     FLAG(*e, entry, MUTUAL)) return "recursive";
+  if(FLAG(*e, entry, QUOTE) ||
+     FLAG(*e, entry, ROW) ||
+     FLAG(*e, entry, PARTIAL) ||
+     FLAG(*e, entry, SYNC) ||
+     FLAG(*e, entry, RAM) ||
+     FLAG(*e, entry, STACK) ||
+     FLAG(*e, entry, RETURN_ADDR) ||
+     FLAG(*e, entry, TRACE)) return "special";
+  if(e->entry.out != 1 || closure_out(tc)) return "outputs";
+  if(closure_in(tc) != e->entry.in) return "arity";
+  TRAVERSE(tc, const, in) {
+    if(!*p) return "arity";
+  }
+  FOR_TRACE_CONST(p, e) {
+    if(is_user_func(p) && NOT_FLAG(*get_entry(p), entry, COMPLETE)) return "recursive";
+  }
+  int size = inline_body_size(e);
+  if(e->entry.alts > 1) {
+    int start, ret;
+    branch_bounds(entry, tc, &start, &ret);
+    // reduction inlines words with one alternative, so don't add more
+    if((entry->entry.alts == 1 && !is_self_recursive(entry)) ||
+       entry->entry.alts * e->entry.alts > (int)AS_SIZE ||
+       !branch_can_split(entry, tc, start, ret)) return "branches";
+    size += (e->entry.alts - 1) * (ret - start + 1);
+  }
+  if(size * call_sites(entry, e) > inline_budget) return "size";
+  return NULL;
+}
+
+// positions while splicing calls into an entry
+typedef struct inline_state {
+  tcell_t *entry, *buf;
+  int *map;   // for the first copy of each branch
+  int *bmap;  // for the current copy of the branch at start
+  int *emap;  // for a callee
+  int *memap; // for the callee with alternatives in the current branch
+  int start;
+} inline_state_t;
+
+// follow calls replaced by one of their arguments to the new position
+static
+int inline_resolve(const inline_state_t *s, int x) {
+  int v;
+  while((v = x >= s->start ? s->bmap[x] : s->map[x]) < 0) x = -v;
+  return v;
+}
+
+// lay out (and copy) alternative k of the callee of c at idx
+static
+int inline_callee(inline_state_t *s, const tcell_t *c, int *emap, int k, int idx, bool copy) {
+  const tcell_t *e = get_entry(c);
+  csize_t in = e->entry.in;
+  int r = 0, branch = 0;
+  if(copy) {
+    COUNTUP(i, in) {
+      emap[i + 1] = inline_resolve(s, tr_index(c->expr.arg[in - 1 - i]));
+    }
+  }
+  FOR_TRACE_CONST(ec, e, in + 1) {
+    if(is_return(ec)) {
+      if(branch++ == k) {
+        r = tr_index(ec->value.ptr[0]);
+        break;
+      }
+    } else if(branch == k) {
+      emap[ec - e] = idx;
+      if(copy) {
+        tcell_t *nc = &s->buf[idx];
+        memcpy(nc, ec, calculate_tcells(ec->size) * sizeof(tcell_t));
+        nc->alt = NULL;
+        FLAG_CLEAR(*nc, trace, NO_SKIP);
+        FLAG_CLEAR(*nc, trace, JUMP);
+        FLAG_CLEAR(*nc, trace, INVARIANT);
+        TRAVERSE(nc, args, ptrs) {
+          int x = tr_index(*p);
+          if(x > 0) *p = index_tr(emap[x]);
+        }
+      }
+      idx += calculate_tcells(ec->size);
+    }
+  }
+
+  // the call maps to the result, or to an argument as a negative index
+  s->bmap[c - s->entry] = r <= in ?
+    -tr_index(c->expr.arg[in - r]) :
+    emap[r];
+  return idx;
+}
+
+// lay out (and copy) copy k of the branch from s->start to ret at idx
+static
+int inline_branch(inline_state_t *s, int ret, int k, int idx, bool copy) {
+  tcell_t *entry = s->entry;
+  FOR_TRACE(tc, entry, s->start) {
+    int i = tc - entry;
+    if(i > ret) break;
+    if(is_user_func(tc) && !inline_blocker(entry, tc)) {
+      tcell_t *e = get_entry(tc);
+      if(copy && !k) {
+        LOG("inline %s[%d] %s.%s x%d", entry->word_name, i, e->module_name, e->word_name, e->entry.alts);
+      }
+      idx = e->entry.alts > 1 ?
+        inline_callee(s, tc, s->memap, k, idx, copy) :
+        inline_callee(s, tc, s->emap, 0, idx, copy);
+    } else {
+      s->bmap[i] = idx;
+      if(copy) {
+        tcell_t *nc = &s->buf[idx];
+        memcpy(nc, tc, calculate_tcells(tc->size) * sizeof(tcell_t));
+        if(is_return(nc)) nc->alt = NULL; // relinked by condense()
+        TRAVERSE(nc, args, ptrs) {
+          int x = tr_index(*p);
+          if(x > 0) tr_set_index(p, inline_resolve(s, x));
+        }
+      }
+      idx += calculate_tcells(tc->size);
+    }
+  }
+  return idx;
+}
+
+// splice the bodies of small non-recursive words into their call sites
+// a branch calling a word with alternatives is repeated for each alternative
+// returns true if anything was inlined
+static
+bool inline_calls(tcell_t *entry) {
+  csize_t len = entry->entry.len, in = entry->entry.in;
+  int bound = in + 1, max_len = 0, n = 0, alts = 0;
+
+  // count calls to inline and bound the new length
+  int branch_len = 0, split = 1;
+  FOR_TRACE(tc, entry, in + 1) {
+    branch_len += calculate_tcells(tc->size);
+    if(is_return(tc)) {
+      bound += split * branch_len;
+      alts += split - 1;
+      branch_len = 0;
+      split = 1;
+    } else if(is_user_func(tc) && !inline_blocker(entry, tc)) {
+      tcell_t *e = get_entry(tc);
+      branch_len += inline_body_size(e);
+      split = max(split, e->entry.alts);
+      max_len = max(max_len, e->entry.len);
+      n++;
+    }
+  }
+  if(!n || !entry_fits(entry, bound)) return false;
+
+  size_t map_size = DIV_UP((2 * (len + 1) + 2 * (max_len + 1)) * sizeof(int), sizeof(tcell_t));
+  inline_state_t s = {
+    .entry = entry,
+    .buf = get_trace_ptr(bound + map_size)
+  };
+  s.map = (int *)&s.buf[bound];
+  s.bmap = &s.map[len + 1];
+  s.emap = &s.bmap[len + 1];
+  s.memap = &s.emap[max_len + 1];
+
+  // vars stay in place
+  memcpy(&s.buf[1], &entry[1], in * sizeof(tcell_t));
+  COUNTUP(i, in) {
+    s.map[i + 1] = i + 1;
+  }
+
+  // copy each branch, once for each alternative of an inlined call
+  int idx = in + 1;
+  s.start = in + 1;
+  FOR_TRACE(tc, entry, in + 1) {
+    if(!is_return(tc)) continue;
+    int ret = tc - entry;
+    split = 1;
+    FOR_TRACE(p, entry, s.start) {
+      if(p == tc) break;
+      if(is_user_func(p) && !inline_blocker(entry, p)) {
+        split = max(split, get_entry(p)->entry.alts);
+      }
+    }
+    COUNTUP(k, split) {
+      inline_branch(&s, ret, k, idx, false);
+      if(!k) memcpy(&s.map[s.start], &s.bmap[s.start], (ret - s.start + 1) * sizeof(int));
+      idx = inline_branch(&s, ret, k, idx, true);
+    }
+    s.start = ret + 1;
+  }
+  csize_t new_len = idx - 1;
+  assert_le(new_len, bound - 1);
+
+  memcpy(&entry[1], &s.buf[1], new_len * sizeof(tcell_t));
+  if(new_len < len) memset(&entry[new_len + 1], 0, (len - new_len) * sizeof(tcell_t));
+  memset(s.buf, 0, (bound + map_size) * sizeof(tcell_t));
+  entry->entry.len = new_len;
+  entry->entry.alts += alts;
+  entry->entry.inlined = min(UINT8_MAX, entry->entry.inlined + n);
+
+  // recount references
+  FOR_TRACE(tc, entry) {
+    if(!is_return(tc)) tc->n = -1;
+  }
+  FOR_TRACE(tc, entry) {
+    TRAVERSE(tc, in, ptrs) {
+      int x = tr_index(*p);
+      if(x > 0) entry[x].n++;
+    }
+  }
+  return true;
+}
+
 // condense and run all analyses on the entry
 static
 void condense_and_analyze(tcell_t *entry) {
+  eliminate_common_subexpressions(entry);
   condense(entry);
+  if(inline_calls(entry)) {
+    eliminate_common_subexpressions(entry);
+    condense(entry);
+  }
   last_use_analysis(entry);
   no_skip_analysis(entry);
   mark_jumps(entry);
@@ -487,7 +856,6 @@ void trace_final_pass(tcell_t *entry) {
 }
 
 // add an entry and all sub-entries to a module
-static
 void store_entries(tcell_t *entry, cell_t *module) {
   assert_error(module_name(module) == entry->module_name);
   module_set(module, string_seg(entry->word_name), &entry->c);
@@ -526,7 +894,9 @@ void compile_module(cell_t *module) {
 
 // lookup an entry and compile if needed
 cell_t *module_lookup_compiled(seg_t path, cell_t **context) {
-  return compile_def(module_lookup(path, context), path, context);
+  cell_t *c = compile_def(module_lookup(path, context), path, context);
+  deps_add_use(c);
+  return c;
 }
 
 // compile a definition
@@ -602,10 +972,11 @@ bool compile_word(cell_t **entry, seg_t name, cell_t *module, csize_t in, csize_
   drop(c);
   trace_end_entry(e);
   dedup_subentries(e);
+  trace_share_entries(e);
   trace_compact(e);
 
   // finish
-  free_def(l);
+  deps_add_entry(e, l);
   return true;
 }
 
@@ -0,0 +1,326 @@
+/* Copyright 2012-2020 Dustin DeWeese
+   This file is part of PoprC.
+
+    PoprC is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PoprC is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with PoprC.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "rt_types.h"
+#include <string.h>
+#include <stdio.h>
+
+#include "startle/error.h"
+#include "startle/test.h"
+#include "startle/support.h"
+#include "startle/map.h"
+#include "startle/log.h"
+
+#include "cells.h"
+#include "eval.h"
+#include "ir/deps.h"
+#include "ir/compile.h"
+#include "ir/trace.h"
+#include "module.h"
+#include "parse/parse.h"
+#include "parse/lex.h"
+#include "list.h"
+#include "user_func.h"
+
+// Dependency graph between compiled top level entries
+//
+// Each compiled word keeps its definition, so that it can be recompiled
+// when a word it calls is redefined by reloading its module.
+// Words that are unchanged, and don't (transitively) call changed words,
+// keep their compiled entries.
+
+STATIC_ALLOC(entry_defs, pair_t, 1 << 12);    // entry -> definition
+STATIC_ALLOC(entry_callers, pair_t, 1 << 14); // callee entry -> caller entry
+static THREAD_LOCAL bool deps_incomplete = false; // some calls were not recorded
+
+void deps_init() {
+  init_map(entry_defs, entry_defs_size);
+  init_map(entry_callers, entry_callers_size);
+  deps_incomplete = false;
+}
+
+static
+cell_t *entry_def(const tcell_t *e) {
+  pair_t *x = map_find(entry_defs, (uintptr_t)e);
+  return x ? (cell_t *)x->second : NULL;
+}
+
+static
+void add_caller(tcell_t *callee, tcell_t *caller) {
+  map_iterator it = map_iterator_begin(entry_callers, (uintptr_t)callee);
+  for(pair_t *p = map_find_iter(&it); p; p = map_next(&it, p)) {
+    if(p->second == (uintptr_t)caller) return;
+  }
+  if(!map_insert(entry_callers, PAIR(callee, caller))) deps_incomplete = true;
+}
+
+/** Record that the entry being compiled uses the compiled word c.
+ * Calls are recorded when words are looked up rather than from OP_exec cells,
+ * because small words are inlined.
+ */
+void deps_add_use(cell_t *c) {
+  tcell_t *caller = trace_current_entry();
+  if(!caller || !c || !is_trace_cell(c)) return;
+  tcell_t
+    *caller_top = top_parent(caller),
+    *callee_top = top_parent(tcell_entry(c));
+  if(callee_top != caller_top) add_caller(callee_top, caller_top);
+}
+
+/** Record a compiled top level entry.
+ * The definition is kept until the entry is invalidated.
+ */
+void deps_add_entry(tcell_t *e, cell_t *def) {
+  if(!map_insert(entry_defs, PAIR(e, def))) {
+    deps_incomplete = true;
+    free_def(def);
+  }
+}
+
+// record an entry restored from the cache, without knowing which words it uses
+void deps_add_restored_entry(tcell_t *e, cell_t *def) {
+  deps_add_entry(e, def);
+  deps_incomplete = true;
+}
+
+// free all definitions kept for recompilation
+void free_entry_defs() {
+  FORMAP(i, entry_defs) {
+    free_def((cell_t *)entry_defs[i].second);
+    entry_defs[i].second = 0;
+  }
+}
+
+static
+map_t defs_map(cell_t *m) {
+  cell_t *c = *module_ref(m);
+  return c ? c->value.map : NULL;
+}
+
+static
+bool same_def(const cell_t *a, const cell_t *b) {
+  if(!a || !b) return a == b;
+  if(!is_list(a) || !is_list(b) ||
+     list_size(a) != list_size(b)) return false;
+  COUNTUP(i, list_size(a)) {
+    seg_t
+      sa = src_text(a->value.ptr[i]),
+      sb = src_text(b->value.ptr[i]);
+    if(sa.n != sb.n || memcmp(sa.s, sb.s, sa.n) != 0) return false;
+  }
+  return true;
+}
+
+// is the compiled entry still valid for the new definition?
+static
+bool same_source(const tcell_t *e, const cell_t *l) {
+  if(!l || !is_list(l) || list_size(l) != 1) return false;
+  seg_t s = src_text(l->value.ptr[0]);
+  return s.n == e->src.n && memcmp(s.s, e->src.s, s.n) == 0;
+}
+
+static
+tcell_t *top_entry(cell_t *c) {
+  tcell_t *e = is_trace_cell(c) ? tcell_entry(c) : NULL;
+  return e && !e->entry.parent ? e : NULL;
+}
+
+static
+bool contains_entry(tcell_t **a, size_t n, const tcell_t *e) {
+  COUNTUP(i, n) {
+    if(a[i] == e) return true;
+  }
+  return false;
+}
+
+static
+void add_invalid(tcell_t **invalid, size_t *n, tcell_t *e) {
+  if(!contains_entry(invalid, *n, e)) invalid[(*n)++] = e;
+}
+
+// does the value v copied from the old module refer to old_value?
+static
+bool refers_to(const cell_t *v, const cell_t *old_value) {
+  return v == old_value ||
+    (v && is_list(v) && FLAG(*v, value, TRACED) && v->alt == old_value);
+}
+
+// imports are copies of the imported modules' maps, so they must be updated
+static
+void update_imports(seg_t name, const cell_t *from, cell_t *to) {
+  map_t modules_map = defs_map(modules);
+  seg_t imports = string_seg("imports");
+  FORMAP(i, modules_map) {
+    cell_t *p = module_get((cell_t *)modules_map[i].second, imports);
+    map_t map;
+    if(!p || !is_module(p) || !(map = defs_map(p))) continue;
+    pair_t *x = seg_map_find(map, name);
+    if(x && refers_to((cell_t *)x->second, from)) x->second = (uintptr_t)to;
+  }
+}
+
+// revert a word to its definition, so that it will be recompiled
+static
+void revert_entry(tcell_t *e, cell_t *reloaded) {
+  pair_t *x = map_find(entry_defs, (uintptr_t)e);
+  if(!x) return;
+  cell_t *def = (cell_t *)x->second;
+  x->second = 0;
+  if(!def) return;
+  cell_t *m = get_module(string_seg(e->module_name));
+  seg_t name = string_seg(e->word_name);
+  if(m && m != reloaded && module_get(m, name) == &e->c) {
+    FLAG_CLEAR(*def, value, TRACED);
+    def->alt = NULL;
+    module_set(m, name, def);
+    update_imports(name, &e->c, def);
+  } else {
+    free_def(def);
+  }
+}
+
+/** Replace module `old` with the newly parsed module `m`.
+ * Compiled words that are unchanged, and only call unchanged words, are kept.
+ * Other words that call changed words are reverted so they will be recompiled.
+ * `old` is freed.
+ * @return the number of kept words.
+ */
+int reload_module(cell_t *old, cell_t *m) {
+  map_t old_map = defs_map(old);
+  if(!old_map) {
+    free_defs(old);
+    return 0;
+  }
+
+  size_t n = 0;
+  tcell_t *invalid[*map_cnt(entry_defs) + *map_cnt(old_map)];
+
+  // a change in imports or a new word can change the meaning of any word
+  seg_t imports = string_seg("imports");
+  cell_t *new_imports = module_get(m, imports);
+  bool invalidate_all = !same_def(module_get(old, imports), new_imports);
+  map_t new_map = defs_map(m);
+  if(new_imports && new_map && !invalidate_all) {
+    FORMAP(i, new_map) {
+      if(!module_get(old, string_seg((char *)new_map[i].first))) {
+        invalidate_all = true;
+        break;
+      }
+    }
+  }
+
+  // without a complete graph, recompile everything
+  if(deps_incomplete) {
+    FORMAP(i, entry_defs) {
+      if(entry_defs[i].second) add_invalid(invalid, &n, (tcell_t *)entry_defs[i].first);
+    }
+    invalidate_all = true;
+  }
+
+  // changed and removed words
+  FORMAP(i, old_map) {
+    tcell_t *e = top_entry((cell_t *)old_map[i].second);
+    if(!e) continue;
+    if(invalidate_all ||
+       !same_source(e, module_get(m, string_seg((char *)old_map[i].first)))) {
+      add_invalid(invalid, &n, e);
+    }
+  }
+
+  // transitive callers
+  for(size_t i = 0; i < n; i++) {
+    map_iterator it = map_iterator_begin(entry_callers, (uintptr_t)invalid[i]);
+    for(pair_t *p = map_find_iter(&it); p; p = map_next(&it, p)) {
+      tcell_t *caller = (tcell_t *)p->second;
+      if(entry_def(caller)) add_invalid(invalid, &n, caller);
+    }
+  }
+
+  // keep valid entries
+  int kept = 0;
+  FORMAP(i, old_map) {
+    tcell_t *e = top_entry((cell_t *)old_map[i].second);
+    if(!e) continue;
+    if(contains_entry(invalid, n, e)) continue;
+    cell_t *l = module_get(m, string_seg(e->word_name));
+    store_entries(e, m);
+    free_def(l);
+    kept++;
+  }
+
+  FORMAP(i, old_map) {
+    seg_t name = string_seg((char *)old_map[i].first);
+    cell_t *v = module_get(m, name);
+    if(v) update_imports(name, (cell_t *)old_map[i].second, v);
+  }
+  COUNTUP(i, n) {
+    revert_entry(invalid[i], m);
+  }
+  if(deps_incomplete) deps_init(); // all reverted
+  LOG("reload_module %s: kept %d, invalidated %d", module_name(m), kept, (int)n);
+  free_defs(old);
+  return kept;
+}
+
+static
+void print_compiled(const char *path) {
+  cell_t *ctx = NULL;
+  cell_t *c = module_lookup(string_seg(path), &ctx);
+  printf(" %s%s", path, c && is_trace_cell(c) ? "" : "*");
+}
+
+TEST(reload_module) {
+  cell_t *orig_modules = modules;
+  modules = make_module();
+  const char *src[] = {
+    "module a:\n"
+    "sq: dup *\n"
+    "inc: 1 +\n"
+    "sqinc: sq inc\n"
+    "module b:\n"
+    "imports: module a\n"
+    "sq2: sq sq\n"
+    "sqinc2: sqinc sqinc\n",
+    "module a:\n"
+    "sq: dup *\n"
+    "inc: 2 +\n"
+    "sqinc: sq inc\n"
+  };
+  const char *words[] = {"a.sq", "a.inc", "a.sqinc", "b.sq2", "b.sqinc2"};
+  int res = 0;
+  FOREACH(i, src) {
+    cell_t *p = lex(src[i], 0), *e = NULL;
+    seg_t n;
+    while(parse_module(&p, &n, &e));
+    free_toks(p);
+    if(e) res = -1;
+
+    // * marks words that need to be compiled
+    printf("loaded:");
+    FOREACH(j, words) print_compiled(words[j]);
+    printf("\n");
+    FOREACH(j, words) {
+      cell_t *ctx = NULL;
+      if(!module_lookup_compiled(string_seg(words[j]), &ctx)) res = -2;
+    }
+  }
+
+  free_modules();
+  closure_free(modules);
+  modules = orig_modules;
+  return res;
+}
@@ -17,7 +17,9 @@
 
 #include "rt_types.h"
 #include <string.h>
+#include <stdlib.h>
 #include <inttypes.h>
+#include <sys/mman.h>
 
 #include "startle/error.h"
 #include "startle/test.h"
@@ -39,29 +41,54 @@
 #include "var.h"
 #include "ir/analysis.h"
 #include "parameters.h"
+#include "module.h"
 
 // parameters
-#define ENTRY_BLOCK_SIZE 1024
+#define ENTRY_BLOCK_SIZE (1 << 13)
 #define MAP_BLOCK_SIZE 64
+#define TRACE_CELLS_MAX ((size_t)1 << 20)
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
 
 // storage for all trace entries
-STATIC_ALLOC_ALIGNED(trace_cells, tcell_t, 8000, 64);
-static tcell_t *trace_ptr = NULL;
+// Address space for `trace_cells_size` tcells is reserved once, followed by
+// `trace_block_map`. Pages are only used when touched, so storage grows as
+// needed without moving entries, and small runs only pay for what they use.
+THREAD_LOCAL tcell_t *trace_cells = NULL;
+THREAD_LOCAL size_t trace_cells_size = 0;
+static THREAD_LOCAL tcell_t *trace_ptr = NULL;
+static THREAD_LOCAL tcell_t *trace_hwm = NULL; // tcells from here on are zero
 
 // scratch spaces at the end of trace_cells
-static scratch_t *scratch_top = NULL;
-static scratch_t *scratch_ptr = NULL;
+static THREAD_LOCAL scratch_t *scratch_top = NULL;
+static THREAD_LOCAL scratch_t *scratch_ptr = NULL;
 
 // stack of entries that are being compiled
 STATIC_ALLOC(active_entries, tcell_t *, 1 << 4);
-static unsigned int prev_entry_pos = 0;
+STATIC_ALLOC_DEPENDENT(active_entry_gen, uintptr_t, active_entries_size);
+static THREAD_LOCAL unsigned int prev_entry_pos = 0;
+
+// open addressing index of the constants in active entries, grown as needed
+// slots are (tcell, generation of its entry), so slots left by finished entries never match
+#define VALUE_INDEX_MIN_SIZE (1 << 12)
+static THREAD_LOCAL pair_t *value_index = NULL;
+static THREAD_LOCAL size_t value_index_size = 0;
+static THREAD_LOCAL size_t value_index_used = 0;
+static THREAD_LOCAL uintptr_t value_index_gen = 0;
+#define VALUE_INDEX_DELETED ((uintptr_t)1)
 
 // index to quickly find an entry for a var inside
-STATIC_ALLOC_DEPENDENT(trace_block_map, tcell_t *, DIV_UP(trace_cells_size, 64));
+static THREAD_LOCAL tcell_t **trace_block_map = NULL;
+static THREAD_LOCAL size_t trace_block_map_size = 0;
 
 STATIC_ALLOC(switch_map, pair_t, 64);
 STATIC_ALLOC(switch_rev_map, pair_t, 64);
 
+// compacted sub-entries by hash, to share identical sub-entries between words
+STATIC_ALLOC(shared_entries, pair_t, 1 << 12);
+
 #include "ir/trace-local.h"
 
 #if INTERFACE
@@ -122,10 +149,46 @@ void trace_reinit() {
   trace_ptr = NULL;
 }
 
+static
+void trace_reserve() {
+  // settle for less if the address space is limited
+  for(size_t n = TRACE_CELLS_MAX; n >= ENTRY_BLOCK_SIZE * 4; n /= 2) {
+    size_t map_size = DIV_UP(n, MAP_BLOCK_SIZE);
+    void *p = mmap(NULL, n * sizeof(tcell_t) + map_size * sizeof(tcell_t *),
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                   -1, 0);
+    if(p != MAP_FAILED) {
+      trace_cells = p;
+      trace_cells_size = n;
+      trace_block_map = (tcell_t **)(trace_cells + n);
+      trace_block_map_size = map_size;
+      trace_hwm = trace_cells;
+      return;
+    }
+  }
+  assert_throw(false, "could not reserve space for `trace_cells`");
+}
+
+// note that tcells before end may be non-zero
+static
+void trace_touch(tcell_t *end) {
+  if(end > trace_hwm) trace_hwm = end;
+}
+
 void trace_init() {
   prev_entry_pos = 0;
   reset_scratch();
-  if(!trace_ptr) trace_ptr = trace_cells;
+  if(!trace_cells) trace_reserve();
+  if(!trace_ptr) {
+    trace_ptr = trace_cells;
+    memset(trace_cells, 0, (trace_hwm - trace_cells) * sizeof(tcell_t));
+    memset(trace_block_map, 0,
+           min(trace_block_map_size,
+               DIV_UP(trace_hwm - trace_cells, MAP_BLOCK_SIZE) + 1) * sizeof(tcell_t *));
+    trace_hwm = trace_cells;
+    init_map(shared_entries, shared_entries_size);
+  }
   scratch_top = (scratch_t *)(trace_cells + trace_cells_size);
   scratch_ptr = (scratch_t *)(trace_cells + trace_cells_size);
   init_map(switch_map, switch_map_size);
@@ -151,6 +214,11 @@ int entry_number(tcell_t const *e) {
   return e ? e - trace_cells : -1;
 }
 
+// like entry_from_number(), but for any trace cell, even if unused
+tcell_t *trace_cell_at(uintptr_t n) {
+  return n < trace_cells_size ? &trace_cells[n] : NULL;
+}
+
 tcell_t *entry_from_number(int n) {
   assert_throw(n >= 0 &&
                n < trace_ptr - trace_cells,
@@ -181,9 +249,15 @@ bool entry_has(tcell_t *entry, tcell_t *v) {
   return v > entry && v < end;
 }
 
+// tcells reserved for an entry that is still in its blocks
+static
+size_t entry_block_cells(const tcell_t *e) {
+  return max(1, e->entry.blocks) * ENTRY_BLOCK_SIZE;
+}
+
 tcell_t *trace_entry_next(tcell_t *e) {
   return e + (FLAG(*e, entry, BLOCK) ?
-              ENTRY_BLOCK_SIZE :
+              entry_block_cells(e) :
               trace_entry_size(e));
 }
 
@@ -253,6 +327,110 @@ void dedup_entry(tcell_t **e) {
   }
 }
 
+// hash ignoring the entry's own hash, which is used for recursive calls
+static
+uint32_t shared_entry_key(tcell_t *e) {
+  e->trace.hash = 0;
+  return hash_entry(e);
+}
+
+static
+bool entry_headers_match(const tcell_t *a, const tcell_t *b) {
+  return
+    a->entry.len == b->entry.len &&
+    a->entry.in == b->entry.in &&
+    a->entry.out == b->entry.out &&
+    a->entry.alts == b->entry.alts &&
+    (a->entry.flags & ~ENTRY_BLOCK) == (b->entry.flags & ~ENTRY_BLOCK);
+}
+
+// redirect calls in e from one entry to another
+static
+void replace_calls(tcell_t *e, tcell_t *from, tcell_t *to) {
+  FOR_TRACE(c, e) {
+    if(is_user_func(c) && get_entry(c) == from) set_entry(c, to);
+  }
+}
+
+// find a compacted sub-entry before `before` identical to e
+static
+tcell_t *find_shared_entry(tcell_t *e, tcell_t *before) {
+  uint32_t key = shared_entry_key(e);
+  map_iterator it = map_iterator_begin(shared_entries, key);
+  for(pair_t *p = map_find_iter(&it); p; p = map_next(&it, p)) {
+    tcell_t *s = (tcell_t *)p->second;
+    if(s >= before ||
+       !s->n ||
+       !entry_headers_match(e, s)) continue;
+    replace_calls(e, e, s); // recursive calls must match
+    if(entries_match(e, s)) return s;
+    replace_calls(e, s, e);
+  }
+  return NULL;
+}
+
+// replace sub-entries of e with identical shared sub-entries, children first
+static
+void share_entry_calls(tcell_t *top, tcell_t *e) {
+  FOR_TRACE(c, e) {
+    if(!is_user_func(c)) continue;
+    tcell_t *ce = get_entry(c);
+    if(ce->entry.parent != e || !ce->n) continue;
+    share_entry_calls(top, ce);
+    tcell_t *s = find_shared_entry(ce, top);
+    if(s) {
+      LOG("sharing %s for %s", s->word_name, ce->word_name);
+      ce->n = 0; // tag for deletion
+      ce->entry.compact = s; // forward remaining calls
+      replace_calls(e, ce, s);
+    }
+  }
+}
+
+/** Replace sub-entries of a completed top level entry
+ * with identical sub-entries compiled for earlier words.
+ * Must be followed by trace_compact().
+ */
+void trace_share_entries(tcell_t *top) {
+  share_entry_calls(top, top);
+
+  // update remaining calls to replaced entries
+  for(tcell_t *e = top; e < trace_ptr; e = trace_entry_next(e)) {
+    if(!e->n) continue;
+    FOR_TRACE(c, e) {
+      if(!is_user_func(c)) continue;
+      tcell_t *ce = get_entry(c);
+      while(ce > top && !ce->n && ce->entry.compact) ce = ce->entry.compact;
+      set_entry(c, ce);
+    }
+  }
+}
+
+// make compacted sub-entries of e available for sharing, children first
+static
+void add_shared_entries(tcell_t *e) {
+  FOR_TRACE(c, e) {
+    if(!is_user_func(c)) continue;
+    tcell_t *ce = get_entry(c);
+    if(ce->entry.parent == e) add_shared_entries(ce);
+  }
+  if(e->entry.parent) {
+    uint32_t key = shared_entry_key(e);
+    map_iterator it = map_iterator_begin(shared_entries, key);
+    for(pair_t *p = map_find_iter(&it); p; p = map_next(&it, p)) {
+      if(p->second == (uintptr_t)e) return;
+    }
+    map_insert(shared_entries, PAIR(key, e));
+  }
+}
+
+// make compacted sub-entries from start onwards available for sharing
+void trace_add_shared_entries(tcell_t *start) {
+  for(tcell_t *e = start; e < trace_ptr; e = trace_entry_next(e)) {
+    if(!e->entry.parent) add_shared_entries(e);
+  }
+}
+
 // get the entry for a var
 tcell_t *var_entry(tcell_t *v) {
   if(!v) return NULL;
@@ -402,18 +580,163 @@ bool equal_value(const cell_t *a, const cell_t *b) {
   }
 }
 
-// look through the trace for a matching value
+// hash consistent with equal_value, or 0 if the value can't be matched
 static
-int trace_lookup_value_linear(tcell_t *entry, const cell_t *c) {
-  FOR_TRACE(p, entry) {
-    if(p->op == OP_value &&
-       NOT_FLAG(*p, value, VAR) &&
-       equal_value(&p->c, c))
-      return p - entry;
+uintptr_t value_hash(const cell_t *c) {
+  uintptr_t hash;
+  switch(c->value.type) {
+  case T_INT:
+    hash = c->value.integer;
+    break;
+  case T_SYMBOL:
+    hash = c->value.symbol;
+    break;
+  case T_FLOAT: {
+    double f = c->value.flt;
+    if(f == 0.0) f = 0.0; // -0.0 == 0.0
+    uint64_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    hash = bits ^ (bits >> 32);
+    break;
+  }
+  case T_LIST:
+    if(!is_empty_list(c)) return 0;
+    hash = 0;
+    break;
+  case T_STRING: {
+    seg_t s = value_seg(c);
+    hash = nonzero_hash(s.s, s.n);
+    break;
+  }
+  default:
+    return 0;
   }
+  hash = (hash ^ (hash >> 29)) * 0x9e3779b97f4a7c15 + c->value.type;
+  return hash ? hash : 1;
+}
+
+static
+bool is_indexed_value(const tcell_t *p) {
+  return p->op == OP_value && NOT_FLAG(*p, value, VAR);
+}
+
+static
+bool entry_is_active(const tcell_t *entry) {
+  return pos_entry(entry->pos) == entry;
+}
+
+static
+uintptr_t entry_gen(const tcell_t *entry) {
+  return entry_is_active(entry) ? active_entry_gen[entry->pos - 1] : 0;
+}
+
+// find a matching value in entry, or else the free slot for it
+static
+int value_index_find(tcell_t *entry, const cell_t *c, uintptr_t hash, pair_t **slot) {
+  uintptr_t gen = entry_gen(entry);
+  if(!value_index_size) {
+    if(slot) *slot = NULL;
+    return -1;
+  }
+  size_t i = hash % value_index_size;
+  while(value_index[i].first) {
+    tcell_t *p = (tcell_t *)value_index[i].first;
+    if(value_index[i].second == gen &&
+       value_index[i].first != VALUE_INDEX_DELETED &&
+       is_indexed_value(p) &&
+       equal_value(&p->c, c)) return p - entry;
+    i = (i + 1) % value_index_size;
+  }
+  if(slot) *slot = &value_index[i];
   return -1;
 }
 
+// rebuild the index from the active entries, dropping stale slots
+// and growing the table to keep it at most a quarter full
+static
+void value_index_rebuild() {
+  size_t n = 1;
+  COUNTUP(i, prev_entry_pos) {
+    FOR_TRACE(p, active_entries[i]) {
+      if(is_indexed_value(p)) n++;
+    }
+  }
+  size_t size = max(value_index_size, (size_t)VALUE_INDEX_MIN_SIZE);
+  while(n * 4 > size) size *= 2;
+  if(size != value_index_size) {
+    pair_t *index = calloc(size, sizeof(pair_t));
+    assert_throw(index, "could not grow `value_index`");
+    free(value_index);
+    value_index = index;
+    value_index_size = size;
+  } else {
+    memset(value_index, 0, sizeof(value_index[0]) * value_index_size);
+  }
+  value_index_used = 0;
+  COUNTUP(i, prev_entry_pos) {
+    tcell_t *e = active_entries[i];
+    FOR_TRACE(p, e) {
+      uintptr_t hash;
+      pair_t *slot;
+      if(is_indexed_value(p) &&
+         (hash = value_hash(&p->c)) &&
+         value_index_find(e, &p->c, hash, &slot) < 0) {
+        *slot = (pair_t) { (uintptr_t)p, entry_gen(e) };
+        value_index_used++;
+      }
+    }
+  }
+}
+
+// add the value at entry[x] to the index
+static
+void value_index_add(tcell_t *entry, int x) {
+  tcell_t *p = &entry[x];
+  uintptr_t hash = value_hash(&p->c);
+  pair_t *slot;
+  if(!hash || !entry_is_active(entry)) return;
+  if((value_index_used + 1) * 2 > value_index_size) {
+    value_index_rebuild(); // includes p
+  } else if(value_index_find(entry, &p->c, hash, &slot) < 0) {
+    *slot = (pair_t) { (uintptr_t)p, entry_gen(entry) };
+    value_index_used++;
+  }
+}
+
+// remove a value before its storage is reused
+static
+void value_index_remove(tcell_t *entry, tcell_t *p) {
+  uintptr_t hash;
+  if(!value_index_size ||
+     !is_indexed_value(p) ||
+     !(hash = value_hash(&p->c))) return;
+  for(size_t i = hash % value_index_size;
+      value_index[i].first;
+      i = (i + 1) % value_index_size) {
+    if(value_index[i].first == (uintptr_t)p &&
+       value_index[i].second == entry_gen(entry)) {
+      value_index[i].first = VALUE_INDEX_DELETED;
+      return;
+    }
+  }
+}
+
+// look up a matching value in the entry
+static
+int trace_lookup_value(tcell_t *entry, const cell_t *c) {
+  uintptr_t hash = value_hash(c);
+  if(!hash) return -1;
+  if(!entry_is_active(entry)) {
+    FOR_TRACE(p, entry) {
+      if(is_indexed_value(p) &&
+         equal_value(&p->c, c))
+        return p - entry;
+    }
+    return -1;
+  }
+  return value_index_find(entry, c, hash, NULL);
+}
+
 // Change the active entry, and add to the list if needed.
 void switch_entry(tcell_t *entry, cell_t *r) {
   CONTEXT("switch_entry %s %C", entry->word_name, r);
@@ -487,7 +810,7 @@ int trace_get_value(tcell_t *entry, cell_t *r) {
     switch_entry(entry, r);
     return var_index(entry, r->value.var);
   } else {
-    int t = trace_lookup_value_linear(entry, r);
+    int t = trace_lookup_value(entry, r);
     if(t) return t;
   }
   assert_error(false);
@@ -510,9 +833,10 @@ int trace_alloc(tcell_t *entry, csize_t args) {
   assert_error(NOT_FLAG(*entry, entry, COMPLETE));
   int index = entry->entry.len + 1;
   size_t size = calculate_tcells(args);
+  assert_throw(entry_fits(entry, entry->entry.len + size), "entry too large");
   entry->entry.len += size;
-  assert_error(entry->entry.len <= ENTRY_BLOCK_SIZE - 1);
   tcell_t *tc = &entry[index];
+  trace_zero(tc, size);
   tc->n = -1;
   tc->size = args;
   tc->trace.range = RANGE_NONE;
@@ -695,7 +1019,7 @@ int trace_store_value(tcell_t *entry, cell_t *c) {
   if(!entry) return -1;
 
   // look to see if the value already is in the trace
-  int x = trace_lookup_value_linear(entry, c);
+  int x = trace_lookup_value(entry, c);
   if(x == -1) {
     assert_error(!is_list(c) || list_size(c) == 0);
     x = trace_copy_cell(entry, c);
@@ -707,6 +1031,7 @@ int trace_store_value(tcell_t *entry, cell_t *c) {
     tc->n = -1;
     tc->trace.type = c->value.type;
     tc->trace.range = get_range(c);
+    value_index_add(entry, x);
   }
 
   apply_condition(c, &x);
@@ -733,27 +1058,49 @@ int trace_store_something(tcell_t *entry, tcell_t **v) {
   return x;
 }
 
+// zero n tcells at p that may have been used before
+static
+void trace_zero(tcell_t *p, size_t n) {
+  if(p < trace_hwm) {
+    memset(p, 0, sizeof(*p) * min(n, (size_t)(trace_hwm - p)));
+  }
+}
+
 tcell_t *get_trace_ptr(size_t size) {
-  assert_throw((void *)(trace_ptr + size) < (void *)(trace_cells + trace_cells_size),
+  assert_throw((void *)(trace_ptr + size) < (void *)scratch_ptr,
     "`trace_cells` too small");
-  memset(trace_ptr, 0, sizeof(*trace_ptr) * size);
+  trace_zero(trace_ptr, size);
+  trace_touch(trace_ptr + size);
   return trace_ptr;
 }
 
+// reserve n blocks at trace_ptr
+// cells are cleared by trace_alloc() as they are used
+static
+bool trace_add_blocks(size_t n) {
+  tcell_t *end = trace_ptr + n * ENTRY_BLOCK_SIZE;
+  if((void *)end >= (void *)scratch_ptr) return false;
+  trace_ptr = end;
+  trace_touch(end);
+  return true;
+}
+
 // setup for tracing
 tcell_t *trace_start_entry(tcell_t *parent, csize_t out) {
-  tcell_t *e = get_trace_ptr(ENTRY_BLOCK_SIZE);
-  trace_ptr += ENTRY_BLOCK_SIZE; // TODO
-  assert_error((char *)trace_ptr < (char *)scratch_ptr);
+  tcell_t *e = trace_ptr;
+  assert_throw(trace_add_blocks(1), "`trace_cells` too small");
+  trace_zero(e, 1);
   e->n = PERSISTENT;
   e->entry = (struct entry) {
     .out = out,
     .parent = parent,
-    .flags = ENTRY_BLOCK
+    .flags = ENTRY_BLOCK,
+    .blocks = 1
   };
 
   // active_entries[e->pos-1] = e
   assert_throw(prev_entry_pos < active_entries_size, "`active_entries` too small");
+  active_entry_gen[prev_entry_pos] = ++value_index_gen;
   active_entries[prev_entry_pos++] = e;
   e->pos = prev_entry_pos;
   trace_update_block_map(e);
@@ -761,6 +1108,14 @@ tcell_t *trace_start_entry(tcell_t *parent, csize_t out) {
   return e;
 }
 
+// does e call itself?
+bool is_self_recursive(const tcell_t *e) {
+  FOR_TRACE_CONST(c, e) {
+    if(c->op == OP_exec && get_entry(c) == e) return true;
+  }
+  return false;
+}
+
 static
 bool has_mutual_recursion(const tcell_t *entry) {
   FOR_TRACE_CONST(c, entry) {
@@ -785,6 +1140,7 @@ void trace_end_entry(tcell_t *e) {
     FLAG_SET_TO(*e, entry, MUTUAL, has_mutual_recursion(e));
   } else {
     FLAG_SET_TO(*e, entry, RECURSIVE, trace_recursive_changes(e));
+    if(FLAG(*e, entry, RECURSIVE)) loop_invariant_analysis(e);
   }
   hw_analysis(e);
   hash_entry(e);
@@ -854,6 +1210,7 @@ void trace_reclaim(tcell_t *e, tcell_t *tc) {
         }
       }
     }
+    value_index_remove(e, tc);
     e->entry.len = ix - 1;
   } else {
     tc->n = -1;
@@ -1319,24 +1676,36 @@ int trace_entry_size(const tcell_t *e) {
   return e->entry.len + 1;
 }
 
+// can an entry still in its blocks grow to len cells?
+// the last entry takes more blocks as needed
+bool entry_fits(tcell_t *e, int len) {
+  if(NOT_FLAG(*e, entry, BLOCK) ||
+     len > (csize_t)~0) return false;
+  size_t have = e->entry.blocks, need = DIV_UP(len + 1, ENTRY_BLOCK_SIZE);
+  if(need <= have) return true;
+  if(trace_entry_next(e) != trace_ptr ||
+     need > UINT8_MAX ||
+     !trace_add_blocks(need - have)) return false;
+  e->entry.blocks = need;
+  trace_update_block_map(e);
+  return true;
+}
+
 // Compact from blocks to minimum size
+// tcells left behind are cleared when used again
 void trace_compact(tcell_t *entry) {
   // build map
   tcell_t *end = trace_ptr;
   tcell_t *ne = entry;
-  for(tcell_t *e = entry;
-      e < end;
-      e += ENTRY_BLOCK_SIZE) {
+  for(tcell_t *e = entry; e < end; e += entry_block_cells(e)) {
     if(e->n) {
       e->entry.compact = ne;
       ne += trace_entry_size(e);
-    } else {
-      memset(e, 0, sizeof(trace_cells[0]) * ENTRY_BLOCK_SIZE);
     }
   }
 
   // update references
-  for(tcell_t *e = entry; e < end; e += ENTRY_BLOCK_SIZE) {
+  for(tcell_t *e = entry; e < end; e += entry_block_cells(e)) {
     if(!e->n) continue;
 
     // update calls
@@ -1356,9 +1725,11 @@ void trace_compact(tcell_t *entry) {
   }
 
   // move and clean up
-  for(tcell_t *e = entry; e < end; e += ENTRY_BLOCK_SIZE) {
+  for(tcell_t *e = entry, *next; e < end; e = next) {
+    next = e + entry_block_cells(e);
     if(!e->n) continue;
     FLAG_CLEAR(*e, entry, BLOCK);
+    e->entry.blocks = 0;
 
     // move
     tcell_t *compact = e->entry.compact;
@@ -1374,12 +1745,76 @@ void trace_compact(tcell_t *entry) {
 
   trace_ptr = ne;
   trace_update_block_map(entry);
+  add_shared_entries(entry);
 }
 
 int trace_count() {
   return trace_ptr ? trace_ptr - trace_cells : 0;
 }
 
+// append n cells of compacted entries
+tcell_t *trace_append(const tcell_t *src, size_t n) {
+  trace_init();
+  if(trace_ptr + n >= (tcell_t *)scratch_ptr) return NULL;
+  tcell_t *start = trace_ptr;
+  memcpy(start, src, sizeof(trace_cells[0]) * n);
+  trace_ptr += n;
+  trace_touch(trace_ptr);
+  trace_update_block_map(start);
+  return start;
+}
+
+// remove all entries from p onwards
+void trace_truncate(tcell_t *p) {
+  assert_error(p >= trace_cells && p <= trace_ptr);
+  memset(p, 0, sizeof(trace_cells[0]) * (trace_ptr - p));
+  trace_ptr = p;
+  trace_update_block_map(p);
+}
+
+// compile a word that is longer than a block
+TEST(large_entry) {
+  cell_t *orig_modules = modules;
+  modules = make_module();
+
+  // long: "aa..." swap ++ "bb..." swap ++ ...
+  // each string constant takes hundreds of tcells
+  const char *head = "module t:\nlong:";
+  const int n = 22, len = 45000;
+  char *src = malloc(strlen(head) + n * (len + 16) + 2);
+  char *s = stpcpy(src, head);
+  COUNTUP(i, n) {
+    s = stpcpy(s, " \"");
+    memset(s, 'a' + i, len);
+    s = stpcpy(s + len, "\" swap ++");
+  }
+  strcpy(s, "\n");
+
+  int res = 0;
+  cell_t *p = lex(src, 0), *err = NULL;
+  seg_t name;
+  while(parse_module(&p, &name, &err));
+  free_toks(p);
+  if(err) res = -1;
+
+  cell_t *ctx = NULL;
+  cell_t *c = module_lookup_compiled(string_seg("t.long"), &ctx);
+  if(!c) {
+    if(!res) res = -2;
+  } else {
+    tcell_t *e = tcell_entry(c);
+    printf("t.long: %d tcells\n", trace_entry_size(e));
+    if(e->entry.len < ENTRY_BLOCK_SIZE) res = -3;
+    else if(FLAG(*e, entry, BLOCK) || !is_return(&e[e->entry.len])) res = -4;
+  }
+
+  free(src);
+  free_modules();
+  closure_free(modules);
+  modules = orig_modules;
+  return res;
+}
+
 // delay a branch so that it is listed at the end
 // this allows reducing base cases first
 void delay_branch(context_t *ctx, priority_t priority) {
@@ -1405,9 +1840,9 @@ void trace_extend(tcell_t *entry, tcell_t *tc) {
 cell_t *trace_extension(cell_t *l, int in, int out) {
   tcell_t *v = l->value.var;
   if(!v->trace.extension) return NULL;
-  assert_lt(v->trace.extension, ENTRY_BLOCK_SIZE);
   tcell_t *entry = var_entry(v);
   if(entry != trace_current_entry()) return NULL; // HACK to avoid switch_entry
+  assert_lt(v->trace.extension, trace_entry_size(entry));
   tcell_t *tc = &entry[v->trace.extension];
   if(closure_in(tc) == in + 1 && closure_out(tc) >= out) {
     LOG("trace_extension %s %d -> %d", entry->word_name, v-entry, tc-entry);
@@ -1473,9 +1908,10 @@ bool trace_cell_eq(const tcell_t *entry, const tcell_t *a, const tcell_t *b) {
   op op = a->op;
   if(op == OP_value) {
     if(is_var(a)) {
-      return is_var(b) && a->pos == b->pos;
+      return a == b;
     } else {
-      switch(op) {
+      if(a->value.type != b->value.type) return false;
+      switch(a->value.type) {
       case T_INT: return a->value.integer == b->value.integer;
       case T_SYMBOL: return a->value.symbol == b->value.symbol;
       case T_FLOAT: return a->value.flt == b->value.flt;
@@ -1491,6 +1927,7 @@ bool trace_cell_eq(const tcell_t *entry, const tcell_t *a, const tcell_t *b) {
   } else {
     if(closure_out(a) != closure_out(b)) return false;
     if(closure_in(a) != closure_in(b)) return false;
+    if(is_user_func(a) && get_entry(a) != get_entry(b)) return false;
     COUNTUP(i, closure_in(a)) {
       if(!trace_cell_eq(entry,
                         get_arg_const(entry, a->expr.arg[i]),
@@ -0,0 +1,424 @@
+/* Copyright 2012-2020 Dustin DeWeese
+   This file is part of PoprC.
+
+    PoprC is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PoprC is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with PoprC.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "rt_types.h"
+#include <string.h>
+#include <stdio.h>
+
+#include "startle/error.h"
+#include "startle/test.h"
+#include "startle/support.h"
+#include "startle/log.h"
+
+#include "cells.h"
+#include "rt.h"
+#include "eval.h"
+#include "special.h"
+#include "ir/vm.h"
+#include "ir/compile.h"
+#include "ir/trace.h"
+#include "module.h"
+#include "parse/parse.h"
+#include "parse/lex.h"
+#include "list.h"
+#include "user_func.h"
+#include "var.h"
+#include "parameters.h"
+#include "primitive/arithmetic.h"
+
+// Direct interpreter for compiled entries
+//
+// Complete entries that only use integers and symbols can be run
+// without building and reducing a graph. Each trace cell has a register
+// holding its unboxed value, and cells are evaluated block by block,
+// moving on to the next block when a block fails, as in generated C.
+// Values that are only needed by a later block are evaluated on demand.
+
+#if INTERFACE
+typedef enum vm_result {
+  VM_FAIL = 0,
+  VM_SUCCESS,
+  VM_ABORT // can't be run by the interpreter, use reduction instead
+} vm_result;
+#endif
+
+#define VM_MAX_DEPTH 1024
+#define VM_MAX_ENTRIES 64
+
+// state of a register, the result + 1, or zero if not yet evaluated
+#define VM_UNKNOWN 0
+#define VM_STATE(r) ((r) + 1)
+
+typedef struct vm_frame {
+  const tcell_t *e;
+  val_t *regs;
+  uint8_t *state;
+  int depth;
+} vm_frame_t;
+
+PARAMETER(use_vm, bool, true, "run compiled words with the direct interpreter") {
+  use_vm = arg;
+}
+
+static
+val_t (*vm_op2(op op))(val_t, val_t) {
+  switch(op) {
+  case OP_add: return add_op;
+  case OP_sub: return sub_op;
+  case OP_mul: return mul_op;
+  case OP_div: return div_op;
+  case OP_mod: return mod_op;
+  case OP_bitand: return bitand_op;
+  case OP_bitor: return bitor_op;
+  case OP_bitxor: return bitxor_op;
+  case OP_shiftl: return shiftl_op;
+  case OP_shiftr: return shiftr_op;
+  case OP_gt: return gt_op;
+  case OP_gte: return gte_op;
+  case OP_lt: return lt_op;
+  case OP_lte: return lte_op;
+  case OP_eq:
+  case OP_eq_s: return eq_op;
+  case OP_neq:
+  case OP_neq_s: return neq_op;
+  default: return NULL;
+  }
+}
+
+static
+val_t (*vm_op1(op op))(val_t) {
+  switch(op) {
+  case OP_negate: return negate_op;
+  case OP_complement: return complement_op;
+  case OP_not: return not_op;
+  default: return NULL;
+  }
+}
+
+static
+bool vm_supported_entry(const tcell_t *e, const tcell_t **visited, int n) {
+  if(n >= VM_MAX_ENTRIES ||
+     FLAG(*e, entry, PRIMITIVE) ||
+     NOT_FLAG(*e, entry, COMPLETE) ||
+     e->entry.out < 1) return false;
+  COUNTUP(i, n) {
+    if(visited[i] == e) return true; // recursive
+  }
+  visited[n++] = e;
+
+  FOR_TRACE_CONST(c, e) {
+    if(is_return(c)) {
+      if(list_size(c) != e->entry.out) return false;
+      continue;
+    }
+    if(!ONEOF(trace_type(c), T_INT, T_SYMBOL)) return false;
+    if(is_var(c)) {
+      if(c - e > e->entry.in) return false;
+    } else if(!is_value(c)) {
+      switch(c->op) {
+      case OP_dep:
+      case OP_seq:
+      case OP_assert:
+        break;
+      case OP_exec: {
+        const tcell_t *x = get_entry(c);
+        if(closure_in(c) != x->entry.in ||
+           closure_out(c) + 1 != x->entry.out ||
+           !vm_supported_entry(x, visited, n)) return false;
+        break;
+      }
+      default:
+        if(!vm_op1(c->op) && !vm_op2(c->op)) return false;
+      }
+    }
+  }
+  return true;
+}
+
+/** Can entry e, and all entries it calls, be run by the interpreter?
+ * The result for the last entry is kept until something new is compiled.
+ */
+bool vm_supported(const tcell_t *e) {
+  static THREAD_LOCAL const tcell_t *last_entry = NULL;
+  static THREAD_LOCAL int last_count = -1;
+  static THREAD_LOCAL bool last_supported = false;
+  if(e != last_entry || trace_count() != last_count) {
+    const tcell_t *visited[VM_MAX_ENTRIES];
+    last_entry = e;
+    last_count = trace_count();
+    last_supported = vm_supported_entry(e, visited, 0);
+  }
+  return last_supported;
+}
+
+static vm_result vm_run(const tcell_t *e, const val_t *in_args, val_t *out_args, int depth);
+
+static
+vm_result vm_eval(vm_frame_t *f, int i);
+
+static
+vm_result vm_arg(vm_frame_t *f, const tcell_t *c, int n, val_t *x) {
+  int i = tr_index(c->expr.arg[n]);
+  vm_result r = vm_eval(f, i);
+  *x = f->regs[i];
+  return r;
+}
+
+static
+vm_result vm_exec(vm_frame_t *f, const tcell_t *c) {
+  const tcell_t *x = get_entry(c);
+  csize_t
+    in = closure_in(c),
+    n = closure_args(c),
+    start_out = n - closure_out(c);
+  val_t in_args[in], out_args[x->entry.out];
+  COUNTUP(i, in) {
+    vm_result r = vm_arg(f, c, i, &in_args[i]);
+    if(r != VM_SUCCESS) return r;
+  }
+  vm_result r = vm_run(x, in_args, out_args, f->depth + 1);
+  if(r == VM_ABORT) return r;
+  f->regs[c - f->e] = out_args[0];
+  RANGEUP(i, start_out, n) {
+    int a = tr_index(c->expr.arg[i]);
+    if(a > 0) {
+      f->regs[a] = out_args[i - start_out + 1];
+      f->state[a] = VM_STATE(r);
+    }
+  }
+  return r;
+}
+
+// evaluate a cell on demand
+// each evaluation counts as a reduction, so that :stats reflects work done by the VM
+static
+vm_result vm_eval(vm_frame_t *f, int i) {
+  if(f->state[i] != VM_UNKNOWN) return f->state[i] - 1;
+  const tcell_t *c = &f->e[i];
+  stats.reduce_cnt++;
+  val_t *res = &f->regs[i], x, y;
+  vm_result r = VM_SUCCESS;
+  val_t (*op1)(val_t);
+  val_t (*op2)(val_t, val_t);
+
+  if(is_value(c)) {
+    *res = trace_type(c) == T_SYMBOL ? c->value.symbol : c->value.integer;
+  } else if(c->op == OP_exec) {
+    r = vm_exec(f, c);
+  } else if(c->op == OP_dep) {
+    int src = tr_index(c->expr.arg[0]);
+    r = vm_eval(f, src);
+    if(r == VM_SUCCESS && f->state[i] == VM_UNKNOWN) r = VM_ABORT; // not an output
+  } else if(c->op == OP_assert) {
+    if((r = vm_arg(f, c, 1, &y)) == VM_SUCCESS) {
+      if(y != SYM_True) {
+        r = VM_FAIL;
+      } else {
+        r = vm_arg(f, c, 0, res);
+      }
+    }
+  } else if(c->op == OP_seq) {
+    if((r = vm_arg(f, c, 1, &y)) == VM_SUCCESS) {
+      r = vm_arg(f, c, 0, res);
+    }
+  } else if((op2 = vm_op2(c->op))) {
+    if((r = vm_arg(f, c, 1, &y)) == VM_SUCCESS &&
+       (r = vm_arg(f, c, 0, &x)) == VM_SUCCESS) {
+      if(y == 0 && ONEOF(c->op, OP_div, OP_mod)) {
+        r = VM_FAIL;
+      } else {
+        *res = op2(x, y);
+      }
+    }
+  } else if((op1 = vm_op1(c->op))) {
+    if((r = vm_arg(f, c, 0, &x)) == VM_SUCCESS) {
+      *res = op1(x);
+    }
+  } else {
+    r = VM_ABORT;
+  }
+
+  if(r == VM_ABORT) return r;
+  f->state[i] = VM_STATE(r);
+  return r;
+}
+
+// is c the last call in its block, so that it can be replaced with a jump?
+static
+bool vm_last_call(vm_frame_t *f, const tcell_t *c) {
+  const tcell_t *e = f->e;
+  if(get_entry(c) != e) return false;
+  FOR_TRACE_CONST(p, e, closure_next_const(c) - e) {
+    if(is_return(p)) return true;
+    if(p->op == OP_assert) {
+      int q = tr_index(p->expr.arg[1]);
+      if(f->state[q] != VM_STATE(VM_SUCCESS) ||
+         f->regs[q] != SYM_True) return false;
+    } else if(!ONEOF(p->op, OP_dep, OP_seq)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+static
+vm_result vm_return(vm_frame_t *f, const tcell_t *l, val_t *out_args) {
+  csize_t out_n = list_size(l);
+  COUNTUP(i, out_n) {
+    int a = tr_index(l->value.ptr[i]);
+    vm_result r = vm_eval(f, a);
+    if(r != VM_SUCCESS) return r;
+    out_args[out_n - 1 - i] = f->regs[a];
+  }
+  return VM_SUCCESS;
+}
+
+static
+vm_result vm_run(const tcell_t *e, const val_t *in_args, val_t *out_args, int depth) {
+  if(depth > VM_MAX_DEPTH) return VM_ABORT;
+  csize_t
+    in = e->entry.in,
+    len = e->entry.len;
+  val_t regs[len + 1], args[in];
+  uint8_t state[len + 1];
+  vm_frame_t f = {
+    .e = e,
+    .regs = regs,
+    .state = state,
+    .depth = depth
+  };
+  memcpy(args, in_args, sizeof(args));
+
+jump:
+  memset(state, VM_UNKNOWN, sizeof(state));
+  COUNTUP(i, in) {
+    regs[in - i] = args[i];
+    state[in - i] = VM_STATE(VM_SUCCESS);
+  }
+
+  bool skip = false;
+  FOR_TRACE_CONST(c, e) {
+    vm_result r = VM_SUCCESS;
+    if(is_return(c)) {
+      if(!skip &&
+         (r = vm_return(&f, c, out_args)) != VM_FAIL) return r;
+      skip = false;
+      continue;
+    }
+    if(skip || is_value(c) || ONEOF(c->op, OP_dep, OP_seq)) continue;
+    if(c->op == OP_assert) {
+      // only check the condition, the value is an alias
+      val_t q;
+      r = vm_arg(&f, c, 1, &q);
+      if(r == VM_SUCCESS && q != SYM_True) r = VM_FAIL;
+    } else if(c->op == OP_exec && vm_last_call(&f, c)) {
+      COUNTUP(i, in) {
+        if((r = vm_arg(&f, c, i, &regs[0])) != VM_SUCCESS) break;
+        args[i] = regs[0];
+      }
+      if(r == VM_SUCCESS) goto jump;
+    } else {
+      r = vm_eval(&f, c - e);
+    }
+    if(r == VM_ABORT) return r;
+    if(r == VM_FAIL) skip = true;
+  }
+  return VM_FAIL;
+}
+
+/** Run entry e on in_args, storing results in out_args (if not NULL).
+ * Only for entries where vm_supported() is true.
+ * @return VM_ABORT if the interpreter can't finish, e.g. because of deep recursion.
+ */
+vm_result vm_call(const tcell_t *e, const val_t *in_args, val_t *out_args) {
+  val_t out[e->entry.out];
+  vm_result r = vm_run(e, in_args, out, 0);
+  if(r == VM_SUCCESS && out_args) memcpy(out_args, out, sizeof(out));
+  return r;
+}
+
+TEST(vm) {
+  cell_t *orig_modules = modules;
+  modules = make_module();
+  const char *src =
+    "module t:\n"
+    "head: popr swap drop\n"
+    "fib: [dup 1 <= !] [dup 1 - dup 1 - fib swap fib + swap 1 > !] | pushl head\n"
+    "fact: [1 == 1 swap !] [dup dup 1 - fact * swap 1 > !] | pushl head\n"
+    "down: [dup 0 <= !] [dup 1 - down swap 0 > !] | pushl head\n"
+    "inv: 1000 swap /\n"
+    "pos: 3 % 0 >\n";
+  const struct {
+    const char *name;
+    int min, max;
+  } words[] = {
+    {"t.fib", -2, 10},
+    {"t.fact", -2, 10},
+    {"t.down", -3, 50},
+    {"t.inv", -5, 5},
+    {"t.pos", -5, 5}
+  };
+  int res = 0;
+  cell_t *p = lex(src, 0), *err = NULL;
+  seg_t n;
+  while(parse_module(&p, &n, &err));
+  free_toks(p);
+  if(err) res = -1;
+
+  bool vm = use_vm;
+  FOREACH(i, words) {
+    cell_t *ctx = NULL;
+    cell_t *c = module_lookup_compiled(string_seg(words[i].name), &ctx);
+    if(!c) {
+      res = -2;
+      continue;
+    }
+    tcell_t *e = tcell_entry(c);
+    bool supported = vm_supported(e);
+    printf("%s:%s supported\n", words[i].name, supported ? "" : " not");
+    if(!supported) continue;
+    for(val_t x = words[i].min; x <= words[i].max; x++) {
+      val_t vm_out = 0, rt_out = 0;
+      vm_result r = vm_call(e, &x, &vm_out);
+      use_vm = false;
+      rt_init();
+      bool ok = call(e, &x, &rt_out);
+      use_vm = vm;
+      if(r != (ok ? VM_SUCCESS : VM_FAIL) ||
+         (ok && vm_out != rt_out)) {
+        printf("  %d: vm %d (%d), reduced %d (%d)\n",
+               (int)x, (int)r, (int)vm_out, ok, (int)rt_out);
+        res = -3;
+      }
+    }
+  }
+
+  // self tail calls don't use the stack
+  cell_t *ctx = NULL;
+  cell_t *c = module_lookup_compiled(string_seg("t.down"), &ctx);
+  val_t x = 100000, y = -1;
+  int reduce_cnt = stats.reduce_cnt;
+  if(!c || vm_call(tcell_entry(c), &x, &y) != VM_SUCCESS || y != 0) res = -4;
+
+  // and are counted as reductions
+  if(stats.reduce_cnt - reduce_cnt < x) res = -5;
+
+  free_modules();
+  closure_free(modules);
+  modules = orig_modules;
+  return res;
+}
@@ -148,7 +148,7 @@ response func_list(cell_t **cp, context_t *ctx) {
         c->value.ptr[n-1] = make_list(0);
       } else {
         CHECK(r);
-        ctx->alt_set |= c->value.ptr[n-1]->value.alt_set;
+        ctx->alt_set = as_union(ctx->alt_set, c->value.ptr[n-1]->value.alt_set);
         CHECK_IF(as_conflict(ctx->alt_set), FAIL);
       }
     }
@@ -172,19 +172,32 @@ void log_ptrs(cell_t *c) {
   }
 }
 
-void reduce_list(cell_t **cp, int depth) {
+// reduce alternatives in order, stopping after max results if max > 0
+void reduce_list(cell_t **cp, int depth, int max) {
   context_t *ctx = &CTX(return);
   ctx->priority = PRIORITY_TOP;
   ctx->depth = depth;
   response rsp = SUCCESS;
   cell_t **p = cp;
+  int n = 0;
+  bool root = !depth && max <= 0; // allow alt_fork()
+  if(root) alt_fork_results = 0;
   while(*p) {
+    if(max > 0 && n >= max) {
+      // drop the unexplored alternatives
+      drop(*p);
+      *p = NULL;
+      break;
+    }
     rsp = func_list(p, ctx);
     assert_error(rsp != DELAY);
     if(rsp == SUCCESS) {
       p = &(*p)->alt;
+      n++;
+      if(root) alt_fork_results = n;
     }
   }
+  alt_fork_results = -1;
 }
 
 list_iterator_t list_begin(cell_t *l) {
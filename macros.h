@@ -220,13 +220,12 @@
 // unions of alt_sets
 #define AS_UNION_2(c, x)               \
   (c->expr.arg[x]->value.alt_set)
-#define AS_UNION_3(c, x, y)            \
-  (c->expr.arg[x]->value.alt_set |     \
-   c->expr.arg[y]->value.alt_set)
-#define AS_UNION_4(c, x, y, z)         \
-  (c->expr.arg[x]->value.alt_set |     \
-   c->expr.arg[y]->value.alt_set |     \
-   c->expr.arg[z]->value.alt_set)
+#define AS_UNION_3(c, x, y)                     \
+  as_union(c->expr.arg[x]->value.alt_set,       \
+           c->expr.arg[y]->value.alt_set)
+#define AS_UNION_4(c, x, y, z)                  \
+  as_union(AS_UNION_3(c, x, y),                 \
+           c->expr.arg[z]->value.alt_set)
 #define AS_UNION(c, ...) DISPATCH(AS_UNION, c, ##__VA_ARGS__)
 
 #define CELL_INDEX(x) (int)((x) - cells)
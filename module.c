@@ -76,7 +76,7 @@ pair_t primitive_module[] = {
   #include "word_list.h"
 };
 
-cell_t *modules = NULL;
+THREAD_LOCAL cell_t *modules = NULL;
 
 cell_t *make_module() {
   cell_t *l = alloc_list(1);
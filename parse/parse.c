@@ -42,6 +42,7 @@
 #include "user_func.h"
 #include "list.h"
 #include "var.h"
+#include "ir/deps.h"
 
 // List of predefined symbols in value order.
 STATIC_ALLOC_DEPENDENT(symbol_index, const char *, symbols_size);
@@ -73,7 +74,7 @@ static pair_t init_symbols[] = {
 #undef ENTRY
 
 STATIC_ALLOC(strings, char, 1 << 14);
-static char *strings_top;
+static THREAD_LOCAL char *strings_top;
 
 void print_symbols() {
   print_string_map(symbols);
@@ -437,8 +438,8 @@ bool parse_module(cell_t **c, seg_t *name, cell_t **err) {
   cell_free(n);
   const char *strname = seg_string(*name); // TODO remove redundant string allocation
   cell_t *m = parse_defs(&p, strname, err);
-  UNUSED cell_t *old = module_set(modules, *name, m);
-  assert_error(old == NULL); // TODO append modules?
+  cell_t *old = module_set(modules, *name, m);
+  if(old) reload_module(old, m);
   if(modules) modules->n = PERSISTENT;
   *c = p;
   return !*err;
@@ -516,7 +517,8 @@ cell_t *parse_subexpr(const cell_t **l, cell_t *module, tcell_t *entry, int dept
 
     case CC_NUMERIC:
     {
-      push_arg(arg_stack, &n, seg, int_val(strtol(seg.s, NULL, 0)));
+      // parsed literals aren't interned, because they may be marked when compiled
+      push_arg(arg_stack, &n, seg, val(T_INT, strtol(seg.s, NULL, 0)));
     } break;
 
     case CC_FLOAT:
@@ -665,8 +667,21 @@ uintptr_t intern(seg_t sym) {
   return v;
 }
 
+/** Would interning `n` strings, packed from `s` to `end`,
+ *  give them the values 0 to n-1? Doesn't intern anything. */
+bool symbols_match(const char *s, const char *end, size_t n) {
+  if(n > symbols_size) return false;
+  COUNTUP(i, n) {
+    if(s >= end) return false;
+    pair_t *x = string_map_find(symbols, s);
+    if(x ? x->second != i : symbol_string(i) != NULL) return false;
+    s += strlen(s) + 1;
+  }
+  return true;
+}
+
 cell_t *string_symbol(seg_t sym) {
-  return symbol(intern(sym));
+  return val(T_SYMBOL, intern(sym));
 }
 
 const char *symbol_string(val_t x) {
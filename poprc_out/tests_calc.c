@@ -0,0 +1,613 @@
+#include "cgen/main.h"
+
+symbol_t tests_calc(symbol_t sym1);
+symbol_t tests_calc__loop(symbol_t sym2, array lst1);
+symbol_t io_getline__loop(symbol_t sym3, opaque_t intf2, seg_t str1, opaque_t *out_intf0, seg_t *out_str1);
+int algorithm_gcd_cl_iterate(int int2, int int1);
+int algorithm__ct__cl_iterate(int int3, int int2, int int1);
+int tests_fibl_cl_times_cl_iterate(int int3, int int2, int int1);
+int tests_fact(int int1);
+int list_length_cl_iterate(int int2, array lst1);
+int algorithm_sum_cl_foldr_cl_iterate(int int2, array lst1);
+
+symbol_t tests_calc(symbol_t sym1)
+{
+  const int int3 = 0;
+
+entry: {
+  array lst2 = __primitive_quote0_li(int3);
+  symbol_t sym4 = tests_calc__loop(sym1, lst2);
+  return sym4;
+}
+} // end tests_calc
+
+symbol_t tests_calc__loop(symbol_t sym2, array lst1)
+{
+  const seg_t str4 = { .s = "stream,out:std", .n = 14 };
+  opaque_t intf5;
+  array lst6;
+  int int7;
+  const seg_t str10 = { .s = "\n", .n = 1 };
+  opaque_t intf12;
+  const seg_t str15 = { .s = "stream,in:std", .n = 13 };
+  opaque_t intf16;
+  const seg_t str19 = { .s = "", .n = 0 };
+  seg_t str20, str21;
+  int int22;
+  opaque_t intf24;
+  symbol_t sym25, sym29;
+  const seg_t str30 = { .s = "+", .n = 1 };
+  array lst33;
+  int int34, int35, int36;
+  array lst39;
+  symbol_t sym42;
+  const seg_t str43 = { .s = "-", .n = 1 };
+  array lst46;
+  int int47, int48, int49;
+  array lst52;
+  symbol_t sym55;
+  const seg_t str56 = { .s = "*", .n = 1 };
+  array lst59;
+  int int60, int61, int62;
+  array lst65;
+  symbol_t sym68;
+  const seg_t str69 = { .s = "/", .n = 1 };
+  array lst72;
+  int int73, int74, int75;
+  array lst78;
+  symbol_t sym81;
+  const seg_t str82 = { .s = "gcd", .n = 3 };
+  array lst85;
+  int int86, int87, int88;
+  array lst91;
+  symbol_t sym94;
+  const seg_t str95 = { .s = "^", .n = 1 };
+  array lst98;
+  int int99, int100, int101;
+  const int int102 = 1;
+  array lst105;
+  symbol_t sym108;
+  const seg_t str109 = { .s = "fib", .n = 3 };
+  int int113;
+  const int int114 = 0;
+  array lst117;
+  symbol_t sym120;
+  const seg_t str121 = { .s = "fact", .n = 4 };
+  int int124;
+  array lst127;
+  symbol_t sym130;
+  const seg_t str131 = { .s = "len", .n = 3 };
+  int int134;
+  array lst137;
+  symbol_t sym140;
+  const seg_t str141 = { .s = "sum", .n = 3 };
+  int int144;
+  array lst146;
+  symbol_t sym149;
+  const seg_t str150 = { .s = "swap", .n = 4 };
+  array lst153;
+  any_t any154, any157;
+  array lst159;
+  symbol_t sym162;
+  const seg_t str163 = { .s = "dup", .n = 3 };
+  array lst168;
+  symbol_t sym171;
+  const seg_t str172 = { .s = "drop", .n = 4 };
+  array lst175;
+  any_t any176;
+  array lst179;
+  const mem_mark_t mark = mem_mark();
+
+entry: {
+  symbol_t sym3 = __primitive_open_yyso(sym2, str4, &intf5);
+  if(__primitive_ap01_lLi(lst1, &lst6, &int7)) {
+    goto block182;
+  }
+  seg_t str8 = __primitive_to_string_si(int7);
+  seg_t str9 = __primitive_strcat_sss(str8, str10);
+  symbol_t sym11 = __primitive_write_yyoso(sym3, intf5, str9, &intf12);
+  symbol_t sym13 = __primitive_close_yyo(sym11, intf12);
+  symbol_t sym14 = __primitive_open_yyso(sym13, str15, &intf16);
+  symbol_t sym17 = io_getline__loop(sym14, intf16, str19, &intf24, &str20);
+  str21 = __primitive_strtrim_ss(str20);
+  if(__primitive_from_string_iS(str21, &int22)) {
+    sym25 = __primitive_close_yyo(sym17, intf24);
+    goto block29;
+  }
+  sym25 = __primitive_close_yyo(sym17, intf24);
+  array lst26 = __primitive_pushr1_lli(lst1, int22);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst26;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block29: {
+  sym29 = __primitive_eq_str_ySs(str21, str30);
+  if(!sym29) { // assert
+    goto block42;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst33, &int34, &int35)) {
+    goto block42;
+  }
+  int36 = __primitive_add_iii(int34, int35);
+  lst39 = __primitive_pushr1_lli(lst33, int36);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst39;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block42: {
+  sym42 = __primitive_eq_str_ySs(str21, str43);
+  if(!sym42) { // assert
+    goto block55;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst46, &int47, &int48)) {
+    goto block55;
+  }
+  int49 = __primitive_sub_iii(int47, int48);
+  lst52 = __primitive_pushr1_lli(lst46, int49);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst52;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block55: {
+  sym55 = __primitive_eq_str_ySs(str21, str56);
+  if(!sym55) { // assert
+    goto block68;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst59, &int60, &int61)) {
+    goto block68;
+  }
+  int62 = __primitive_mul_iii(int60, int61);
+  lst65 = __primitive_pushr1_lli(lst59, int62);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst65;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block68: {
+  sym68 = __primitive_eq_str_ySs(str21, str69);
+  if(!sym68) { // assert
+    goto block81;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst72, &int74, &int73)) {
+    goto block81;
+  }
+  if(__primitive_div_iii(int74, int73, &int75)) {
+    goto block81;
+  }
+  lst78 = __primitive_pushr1_lli(lst72, int75);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst78;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block81: {
+  sym81 = __primitive_eq_str_ySs(str21, str82);
+  if(!sym81) { // assert
+    goto block94;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst85, &int86, &int87)) {
+    goto block94;
+  }
+  int88 = algorithm_gcd_cl_iterate(int86, int87);
+  lst91 = __primitive_pushr1_lli(lst85, int88);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst91;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block94: {
+  sym94 = __primitive_eq_str_ySs(str21, str95);
+  if(!sym94) { // assert
+    goto block108;
+  }
+  if(__primitive_ap02_lLii(lst1, &lst98, &int99, &int100)) {
+    goto block120;
+  }
+  int101 = algorithm__ct__cl_iterate(int102, int99, int100);
+  lst105 = __primitive_pushr1_lli(lst98, int101);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst105;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block108: {
+  sym108 = __primitive_eq_str_ySs(str21, str109);
+  if(!sym108) { // assert
+    goto block120;
+  }
+  int int112 = __primitive_sub_iii(int7, int102);
+  int113 = tests_fibl_cl_times_cl_iterate(int112, int114, int102);
+  lst117 = __primitive_pushr1_lli(lst6, int113);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst117;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block120: {
+  sym120 = __primitive_eq_str_ySs(str21, str121);
+  if(!sym120) { // assert
+    goto block130;
+  }
+  int124 = tests_fact(int7);
+  lst127 = __primitive_pushr1_lli(lst6, int124);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst127;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block130: {
+  sym130 = __primitive_eq_str_ySs(str21, str131);
+  if(!sym130) { // assert
+    goto block140;
+  }
+  int134 = list_length_cl_iterate(int114, lst1);
+  lst137 = __primitive_pushr1_lli(lst1, int134);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst137;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block140: {
+  sym140 = __primitive_eq_str_ySs(str21, str141);
+  if(!sym140) { // assert
+    goto block149;
+  }
+  int144 = algorithm_sum_cl_foldr_cl_iterate(int114, lst1);
+  lst146 = __primitive_quote0_li(int144);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst146;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block149: {
+  sym149 = __primitive_eq_str_ySs(str21, str150);
+  if(!sym149) { // assert
+    goto block162;
+  }
+  if(__primitive_ap02_lLaa(lst1, &lst153, &any154, &any157)) {
+    goto block162;
+  }
+  lst159 = __primitive_pushr2_llaa(lst153, any157, any154);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst159;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block162: {
+  sym162 = __primitive_eq_str_ySs(str21, str163);
+  if(!sym162) { // assert
+    goto block171;
+  }
+  lst168 = __primitive_pushr2_llii(lst6, int7, int7);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst168;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block171: {
+  sym171 = __primitive_eq_str_yss(str21, str172);
+  if(!sym171) { // assert
+    goto block182;
+  }
+  if(__primitive_ap02_lla0(lst1, &lst175, &any176, NULL)) {
+    goto block182;
+  }
+  lst179 = __primitive_pushr1_lla(lst175, any176);
+
+  // tail call
+  sym2 = sym25;
+  lst1 = lst179;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block182: {
+  return sym25;
+}
+} // end tests_calc__loop
+
+symbol_t io_getline__loop(symbol_t sym3, opaque_t intf2, seg_t str1, opaque_t *out_intf0, seg_t *out_str1)
+{
+  symbol_t sym4;
+  seg_t str5, str6;
+  const seg_t str7 = { .s = "\n", .n = 1 };
+  opaque_t intf8;
+  seg_t str9;
+  opaque_t intf12;
+  symbol_t sym16;
+  const seg_t str17 = { .s = "", .n = 0 };
+  symbol_t sym18, sym21;
+  opaque_t intf28;
+  seg_t str35;
+  const mem_mark_t mark = mem_mark();
+
+entry: {
+  sym4 = __primitive_read_yyooS(sym3, intf2, &intf8, &str5);
+  if(__primitive_strsplit_sSsS(str5, str7, &str6, &str9)) {
+    goto block15;
+  }
+  seg_t str10 = __primitive_strcat_sss(str1, str9);
+  symbol_t sym11 = __primitive_unread_yyoso(sym4, intf8, str10, &intf12);
+  if(out_intf0) *out_intf0 = intf12;
+  if(out_str1) *out_str1 = str6;
+  return sym11;
+}
+
+block15: {
+  sym16 = __primitive_eq_str_ySs(str5, str17);
+  sym18 = __primitive_not_yy(sym16);
+  if(!sym18) { // assert
+    goto block42;
+  }
+  seg_t str20 = __primitive_strcat_sSs(str1, str5);
+  sym21 = io_getline__loop(sym4, intf8, str20, &intf28, &str35);
+  if(!sym16) { // assert
+    goto block42;
+  }
+  if(out_intf0) *out_intf0 = intf28;
+  if(out_str1) *out_str1 = str35;
+  return sym21;
+}
+
+block42: {
+  if(out_intf0) *out_intf0 = intf8;
+  if(out_str1) *out_str1 = str1;
+  return sym4;
+}
+} // end io_getline__loop
+
+int algorithm_gcd_cl_iterate(int int2, int int1)
+{
+  symbol_t sym3;
+  const int int4 = 0;
+  int int9, int10;
+
+entry: {
+  sym3 = __primitive_neq_yii(int1, int4);
+  symbol_t sym5 = __primitive_not_yy(sym3);
+  if(!sym5) { // assert
+    goto block8;
+  }
+  return int2;
+}
+
+block8: {
+  assert_error(sym3);
+  assert_error(!__primitive_mod_iii(int2, int1, &int9));
+
+  // tail call
+  int2 = int1;
+  int1 = int9;
+  goto entry;
+}
+} // end algorithm_gcd_cl_iterate
+
+int algorithm__ct__cl_iterate(int int3, int int2, int int1)
+{
+  symbol_t sym4;
+  const int int5 = 0;
+  const int int11 = 1;
+  symbol_t sym12;
+  int int14;
+  const int int17 = 1;
+  int int18;
+  const int int25 = 1;
+  int int26;
+
+entry: {
+  sym4 = __primitive_neq_yii(int1, int5);
+  symbol_t sym6 = __primitive_not_yy(sym4);
+  if(!sym6) { // assert
+    goto block9;
+  }
+  return int3;
+}
+
+block9: {
+  assert_error(sym4);
+  int int10 = __primitive_bitand_iii(int1, int11);
+  sym12 = __primitive_eq_yii(int10, int11);
+  if(!sym12) { // assert
+    goto block20;
+  }
+  int14 = __primitive_mul_iii(int3, int2);
+  int int15 = __primitive_mul_iii(int2, int2);
+  int int16 = __primitive_shiftr_iii(int1, int17);
+
+  // tail call
+  int3 = int14;
+  int2 = int15;
+  int1 = int16;
+  goto entry;
+}
+
+block20: {
+  symbol_t sym21 = __primitive_not_yy(sym12);
+  assert_error(sym21);
+  int int23 = __primitive_mul_iii(int2, int2);
+  int int24 = __primitive_shiftr_iii(int1, int25);
+
+  // tail call
+  int3 = int3;
+  int2 = int23;
+  int1 = int24;
+  goto entry;
+}
+} // end algorithm__ct__cl_iterate
+
+int tests_fibl_cl_times_cl_iterate(int int3, int int2, int int1)
+{
+  symbol_t sym4;
+  const int int5 = 0;
+  const int int11 = 1;
+  int int13;
+
+entry: {
+  sym4 = __primitive_gt_yii(int3, int5);
+  symbol_t sym6 = __primitive_not_yy(sym4);
+  if(!sym6) { // assert
+    goto block9;
+  }
+  return int1;
+}
+
+block9: {
+  assert_error(sym4);
+  int int10 = __primitive_sub_iii(int3, int11);
+  int int12 = __primitive_add_iii(int2, int1);
+
+  // tail call
+  int3 = int10;
+  int2 = int1;
+  int1 = int12;
+  goto entry;
+}
+} // end tests_fibl_cl_times_cl_iterate
+
+int tests_fact(int int1)
+{
+  const int int3 = 1;
+  int int10;
+
+entry: {
+  symbol_t sym2 = __primitive_eq_yii(int1, int3);
+  if(!sym2) { // assert
+    goto block6;
+  }
+  return int3;
+}
+
+block6: {
+  symbol_t sym6 = __primitive_gt_yii(int1, int3);
+  assert_error(sym6);
+  int int8 = __primitive_sub_iii(int1, int3);
+  int int9 = tests_fact(int8);
+  int10 = __primitive_mul_iii(int1, int9);
+  return int10;
+}
+} // end tests_fact
+
+int list_length_cl_iterate(int int2, array lst1)
+{
+  array lst3;
+  any_t any4;
+  const int int7 = 1;
+  const mem_mark_t mark = mem_mark();
+
+entry: {
+  if(__primitive_ap01_lla(lst1, &lst3, &any4)) {
+    goto block10;
+  }
+  int int6 = __primitive_add_iii(int2, int7);
+
+  // tail call
+  int2 = int6;
+  lst1 = lst3;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block10: {
+  return int2;
+}
+} // end list_length_cl_iterate
+
+int algorithm_sum_cl_foldr_cl_iterate(int int2, array lst1)
+{
+  array lst3;
+  int int4;
+  const mem_mark_t mark = mem_mark();
+
+entry: {
+  if(__primitive_ap01_lli(lst1, &lst3, &int4)) {
+    goto block9;
+  }
+  int int6 = __primitive_add_iii(int4, int2);
+
+  // tail call
+  int2 = int6;
+  lst1 = lst3;
+  mem_release(mark,
+              NULL, 0,
+              (array *[]) {&lst1}, 1);
+  goto entry;
+}
+
+block9: {
+  return int2;
+}
+} // end algorithm_sum_cl_foldr_cl_iterate
+
+MAIN(tests_calc)
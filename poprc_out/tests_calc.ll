@@ -0,0 +1,6145 @@
+	.file	"tests_calc.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "poprc_out/tests_calc.c"
+	.globl	tests_calc
+	.type	tests_calc, @function
+tests_calc:
+.LFB0:
+	.file 1 "poprc_out/tests_calc.c"
+	.loc 1 14 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+	movl	%edi, -36(%rbp)
+	.loc 1 15 13
+	movl	$0, -4(%rbp)
+.L2:
+.LBB2:
+	.loc 1 18 16
+	leaq	-32(%rbp), %rax
+	movl	-4(%rbp), %edx
+	movl	%edx, %esi
+	movq	%rax, %rdi
+	call	__primitive_quote0_li@PLT
+	.loc 1 19 19
+	movl	-36(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-32(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-16(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movl	%esi, %edi
+	call	tests_calc__loop
+	addq	$32, %rsp
+	movl	%eax, -8(%rbp)
+	.loc 1 20 10
+	movl	-8(%rbp), %eax
+.LBE2:
+	.loc 1 22 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	tests_calc, .-tests_calc
+	.section	.rodata
+.LC0:
+	.string	""
+	.text
+	.globl	tests_calc__loop
+	.type	tests_calc__loop, @function
+tests_calc__loop:
+.LFB1:
+	.loc 1 25 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$1152, %rsp
+	movl	%edi, -1140(%rbp)
+	.loc 1 34 15
+	leaq	.LC0(%rip), %rax
+	movq	%rax, -208(%rbp)
+	movq	$0, -200(%rbp)
+	.loc 1 67 13
+	movl	$1, -8(%rbp)
+	.loc 1 72 13
+	movl	$0, -12(%rbp)
+	.loc 1 99 27
+	movl	$0, %eax
+	call	mem_mark@PLT
+	movq	%rax, -960(%rbp)
+	movq	%rdx, -952(%rbp)
+.L6:
+.L5:
+.LBB3:
+	.loc 1 102 19
+	leaq	-136(%rbp), %rcx
+	movq	str4.0(%rip), %rsi
+	movq	8+str4.0(%rip), %rdx
+	movl	-1140(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_open_yyso@PLT
+	movl	%eax, -16(%rbp)
+	.loc 1 103 6
+	leaq	-164(%rbp), %rsi
+	leaq	-160(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_ap01@PLT
+	addq	$32, %rsp
+	.loc 1 103 5
+	testb	%al, %al
+	jne	.L58
+	.loc 1 106 16
+	movl	-164(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_to_string_si@PLT
+	movq	%rax, -976(%rbp)
+	movq	%rdx, -968(%rbp)
+	.loc 1 107 16
+	movq	str10.1(%rip), %rax
+	movq	8+str10.1(%rip), %rdx
+	movq	-976(%rbp), %rdi
+	movq	-968(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -992(%rbp)
+	movq	%rdx, -984(%rbp)
+	.loc 1 108 20
+	movq	-136(%rbp), %rsi
+	leaq	-176(%rbp), %rcx
+	movq	-992(%rbp), %rax
+	movq	-984(%rbp), %rdx
+	movl	-16(%rbp), %edi
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_write_yyoso@PLT
+	movl	%eax, -20(%rbp)
+	.loc 1 109 20
+	movq	-176(%rbp), %rdx
+	movl	-20(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -24(%rbp)
+	.loc 1 110 20
+	leaq	-184(%rbp), %rcx
+	movq	str15.2(%rip), %rsi
+	movq	8+str15.2(%rip), %rdx
+	movl	-24(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_open_yyso@PLT
+	movl	%eax, -28(%rbp)
+	.loc 1 111 20
+	movq	-184(%rbp), %rsi
+	leaq	-224(%rbp), %r8
+	leaq	-256(%rbp), %rcx
+	movq	-208(%rbp), %rax
+	movq	-200(%rbp), %rdx
+	movl	-28(%rbp), %edi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	io_getline__loop
+	movl	%eax, -32(%rbp)
+	.loc 1 112 11
+	movq	-224(%rbp), %rdx
+	movq	-216(%rbp), %rax
+	movq	%rdx, %rdi
+	movq	%rax, %rsi
+	call	__primitive_strtrim_ss@PLT
+	movq	%rax, -240(%rbp)
+	movq	%rdx, -232(%rbp)
+	.loc 1 113 6
+	leaq	-244(%rbp), %rdx
+	movq	-240(%rbp), %rcx
+	movq	-232(%rbp), %rax
+	movq	%rcx, %rdi
+	movq	%rax, %rsi
+	call	__primitive_from_string_is@PLT
+	.loc 1 113 5
+	testb	%al, %al
+	je	.L9
+	.loc 1 114 13
+	movq	-256(%rbp), %rdx
+	movl	-32(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -4(%rbp)
+.L10:
+.LBE3:
+.LBB4:
+	.loc 1 130 11
+	movq	str30.3(%rip), %rax
+	movq	8+str30.3(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -36(%rbp)
+	.loc 1 131 5
+	cmpl	$0, -36(%rbp)
+	jne	.L11
+	.loc 1 132 5
+	jmp	.L14
+.L9:
+.LBE4:
+.LBB5:
+	.loc 1 117 11
+	movq	-256(%rbp), %rdx
+	movl	-32(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -4(%rbp)
+	.loc 1 118 17
+	movl	-244(%rbp), %esi
+	leaq	-1024(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 121 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 122 8
+	movq	-1024(%rbp), %rax
+	movq	-1016(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-1008(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 125 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1032(%rbp)
+	.loc 1 123 3
+	leaq	-1032(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L11:
+.LBE5:
+.LBB6:
+	.loc 1 134 6
+	leaq	-296(%rbp), %r8
+	leaq	-292(%rbp), %rsi
+	leaq	-288(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 134 5
+	testb	%al, %al
+	jne	.L59
+	.loc 1 137 11
+	movl	-292(%rbp), %edx
+	movl	-296(%rbp), %eax
+	.loc 1 137 9
+	addl	%edx, %eax
+	movl	%eax, -40(%rbp)
+	.loc 1 138 11
+	leaq	-320(%rbp), %rdi
+	movl	-40(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-288(%rbp), %rax
+	movq	-280(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-272(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 141 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 142 8
+	movq	-320(%rbp), %rax
+	movq	-312(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-304(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 145 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1040(%rbp)
+	.loc 1 143 3
+	leaq	-1040(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L59:
+	.loc 1 135 5
+	nop
+.L14:
+.LBE6:
+.LBB7:
+	.loc 1 150 11
+	movq	str43.4(%rip), %rax
+	movq	8+str43.4(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -44(%rbp)
+	.loc 1 151 5
+	cmpl	$0, -44(%rbp)
+	je	.L60
+	.loc 1 154 6
+	leaq	-360(%rbp), %r8
+	leaq	-356(%rbp), %rsi
+	leaq	-352(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 154 5
+	testb	%al, %al
+	jne	.L61
+	.loc 1 157 11
+	movl	-356(%rbp), %edx
+	movl	-360(%rbp), %eax
+	.loc 1 157 9
+	subl	%eax, %edx
+	movl	%edx, -48(%rbp)
+	.loc 1 158 11
+	leaq	-384(%rbp), %rdi
+	movl	-48(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-352(%rbp), %rax
+	movq	-344(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-336(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 161 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 162 8
+	movq	-384(%rbp), %rax
+	movq	-376(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-368(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 165 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1048(%rbp)
+	.loc 1 163 3
+	leaq	-1048(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L60:
+	.loc 1 152 5
+	nop
+	jmp	.L18
+.L61:
+	.loc 1 155 5
+	nop
+.L18:
+.LBE7:
+.LBB8:
+	.loc 1 170 11
+	movq	str56.5(%rip), %rax
+	movq	8+str56.5(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -52(%rbp)
+	.loc 1 171 5
+	cmpl	$0, -52(%rbp)
+	je	.L62
+	.loc 1 174 6
+	leaq	-424(%rbp), %r8
+	leaq	-420(%rbp), %rsi
+	leaq	-416(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 174 5
+	testb	%al, %al
+	jne	.L63
+	.loc 1 177 11
+	movl	-420(%rbp), %edx
+	movl	-424(%rbp), %eax
+	.loc 1 177 9
+	imull	%edx, %eax
+	movl	%eax, -56(%rbp)
+	.loc 1 178 11
+	leaq	-448(%rbp), %rdi
+	movl	-56(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-416(%rbp), %rax
+	movq	-408(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-400(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 181 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 182 8
+	movq	-448(%rbp), %rax
+	movq	-440(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-432(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 185 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1056(%rbp)
+	.loc 1 183 3
+	leaq	-1056(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L62:
+	.loc 1 172 5
+	nop
+	jmp	.L22
+.L63:
+	.loc 1 175 5
+	nop
+.L22:
+.LBE8:
+.LBB9:
+	.loc 1 190 11
+	movq	str69.6(%rip), %rax
+	movq	8+str69.6(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -60(%rbp)
+	.loc 1 191 5
+	cmpl	$0, -60(%rbp)
+	je	.L64
+	.loc 1 194 6
+	leaq	-484(%rbp), %r8
+	leaq	-488(%rbp), %rsi
+	leaq	-480(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 194 5
+	testb	%al, %al
+	jne	.L65
+	.loc 1 197 6
+	movl	-484(%rbp), %ecx
+	movl	-488(%rbp), %eax
+	leaq	-492(%rbp), %rdx
+	movl	%ecx, %esi
+	movl	%eax, %edi
+	call	__primitive_div_iii@PLT
+	.loc 1 197 5
+	testb	%al, %al
+	jne	.L66
+	.loc 1 200 11
+	movl	-492(%rbp), %esi
+	leaq	-528(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-480(%rbp), %rax
+	movq	-472(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-464(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 203 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 204 8
+	movq	-528(%rbp), %rax
+	movq	-520(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-512(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 207 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1064(%rbp)
+	.loc 1 205 3
+	leaq	-1064(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L64:
+	.loc 1 192 5
+	nop
+	jmp	.L27
+.L65:
+	.loc 1 195 5
+	nop
+	jmp	.L27
+.L66:
+	.loc 1 198 5
+	nop
+.L27:
+.LBE9:
+.LBB10:
+	.loc 1 212 11
+	movq	str82.7(%rip), %rax
+	movq	8+str82.7(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -64(%rbp)
+	.loc 1 213 5
+	cmpl	$0, -64(%rbp)
+	je	.L67
+	.loc 1 216 6
+	leaq	-568(%rbp), %r8
+	leaq	-564(%rbp), %rsi
+	leaq	-560(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 216 5
+	testb	%al, %al
+	jne	.L68
+	.loc 1 219 11
+	movl	-568(%rbp), %edx
+	movl	-564(%rbp), %eax
+	movl	%edx, %esi
+	movl	%eax, %edi
+	call	algorithm_gcd_cl_iterate
+	movl	%eax, -68(%rbp)
+	.loc 1 220 11
+	leaq	-592(%rbp), %rdi
+	movl	-68(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-560(%rbp), %rax
+	movq	-552(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-544(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 223 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 224 8
+	movq	-592(%rbp), %rax
+	movq	-584(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-576(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 227 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1072(%rbp)
+	.loc 1 225 3
+	leaq	-1072(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L67:
+	.loc 1 214 5
+	nop
+	jmp	.L31
+.L68:
+	.loc 1 217 5
+	nop
+.L31:
+.LBE10:
+.LBB11:
+	.loc 1 232 11
+	movq	str95.8(%rip), %rax
+	movq	8+str95.8(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -72(%rbp)
+	.loc 1 233 5
+	cmpl	$0, -72(%rbp)
+	je	.L69
+	.loc 1 236 6
+	leaq	-632(%rbp), %r8
+	leaq	-628(%rbp), %rsi
+	leaq	-624(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 236 5
+	testb	%al, %al
+	jne	.L70
+	.loc 1 239 12
+	movl	-632(%rbp), %edx
+	movl	-628(%rbp), %ecx
+	movl	-8(%rbp), %eax
+	movl	%ecx, %esi
+	movl	%eax, %edi
+	call	algorithm__ct__cl_iterate
+	movl	%eax, -76(%rbp)
+	.loc 1 240 12
+	leaq	-656(%rbp), %rdi
+	movl	-76(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-624(%rbp), %rax
+	movq	-616(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-608(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 243 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 244 8
+	movq	-656(%rbp), %rax
+	movq	-648(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-640(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 247 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1080(%rbp)
+	.loc 1 245 3
+	leaq	-1080(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L69:
+	.loc 1 234 5
+	nop
+.L33:
+.LBE11:
+.LBB12:
+	.loc 1 252 12
+	movq	str109.9(%rip), %rax
+	movq	8+str109.9(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -80(%rbp)
+	.loc 1 253 5
+	cmpl	$0, -80(%rbp)
+	je	.L71
+	.loc 1 256 16
+	movl	-164(%rbp), %eax
+	.loc 1 256 7
+	subl	-8(%rbp), %eax
+	movl	%eax, -84(%rbp)
+	.loc 1 257 12
+	movl	-8(%rbp), %edx
+	movl	-12(%rbp), %ecx
+	movl	-84(%rbp), %eax
+	movl	%ecx, %esi
+	movl	%eax, %edi
+	call	tests_fibl_cl_times_cl_iterate
+	movl	%eax, -88(%rbp)
+	.loc 1 258 12
+	leaq	-688(%rbp), %rdi
+	movl	-88(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-144(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 261 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 262 8
+	movq	-688(%rbp), %rax
+	movq	-680(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-672(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 265 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1088(%rbp)
+	.loc 1 263 3
+	leaq	-1088(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L70:
+.LBE12:
+.LBB13:
+	.loc 1 237 5
+	nop
+	jmp	.L35
+.L71:
+.LBE13:
+.LBB14:
+	.loc 1 254 5
+	nop
+.L35:
+.LBE14:
+.LBB15:
+	.loc 1 270 12
+	movq	str121.10(%rip), %rax
+	movq	8+str121.10(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -92(%rbp)
+	.loc 1 271 5
+	cmpl	$0, -92(%rbp)
+	je	.L72
+	.loc 1 274 12
+	movl	-164(%rbp), %eax
+	movl	%eax, %edi
+	call	tests_fact
+	movl	%eax, -96(%rbp)
+	.loc 1 275 12
+	leaq	-720(%rbp), %rdi
+	movl	-96(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-144(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 278 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 279 8
+	movq	-720(%rbp), %rax
+	movq	-712(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-704(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 282 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1096(%rbp)
+	.loc 1 280 3
+	leaq	-1096(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L72:
+	.loc 1 272 5
+	nop
+.L38:
+.LBE15:
+.LBB16:
+	.loc 1 287 12
+	movq	str131.11(%rip), %rax
+	movq	8+str131.11(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -100(%rbp)
+	.loc 1 288 5
+	cmpl	$0, -100(%rbp)
+	je	.L73
+	.loc 1 291 12
+	movl	-12(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movl	%esi, %edi
+	call	list_length_cl_iterate
+	addq	$32, %rsp
+	movl	%eax, -104(%rbp)
+	.loc 1 292 12
+	leaq	-752(%rbp), %rdi
+	movl	-104(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 295 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 296 8
+	movq	-752(%rbp), %rax
+	movq	-744(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-736(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 299 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1104(%rbp)
+	.loc 1 297 3
+	leaq	-1104(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L73:
+	.loc 1 289 5
+	nop
+.L40:
+.LBE16:
+.LBB17:
+	.loc 1 304 12
+	movq	str141.12(%rip), %rax
+	movq	8+str141.12(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -108(%rbp)
+	.loc 1 305 5
+	cmpl	$0, -108(%rbp)
+	je	.L74
+	.loc 1 308 12
+	movl	-12(%rbp), %esi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movl	%esi, %edi
+	call	algorithm_sum_cl_foldr_cl_iterate
+	addq	$32, %rsp
+	movl	%eax, -112(%rbp)
+	.loc 1 309 12
+	leaq	-784(%rbp), %rax
+	movl	-112(%rbp), %edx
+	movl	%edx, %esi
+	movq	%rax, %rdi
+	call	__primitive_quote0_li@PLT
+	.loc 1 312 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 313 8
+	movq	-784(%rbp), %rax
+	movq	-776(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-768(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 316 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1112(%rbp)
+	.loc 1 314 3
+	leaq	-1112(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L74:
+	.loc 1 306 5
+	nop
+.L42:
+.LBE17:
+.LBB18:
+	.loc 1 321 12
+	movq	str150.13(%rip), %rax
+	movq	8+str150.13(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -116(%rbp)
+	.loc 1 322 5
+	cmpl	$0, -116(%rbp)
+	je	.L75
+	.loc 1 325 6
+	leaq	-824(%rbp), %r8
+	leaq	-820(%rbp), %rsi
+	leaq	-816(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movq	%r8, %rdx
+	call	__primitive_ap02@PLT
+	addq	$32, %rsp
+	.loc 1 325 5
+	testb	%al, %al
+	jne	.L76
+	.loc 1 328 12
+	movl	-820(%rbp), %r8d
+	movl	-824(%rbp), %esi
+	leaq	-848(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-816(%rbp), %rax
+	movq	-808(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-800(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movl	%r8d, %edx
+	call	__primitive_pushr2@PLT
+	addq	$32, %rsp
+	.loc 1 331 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 332 8
+	movq	-848(%rbp), %rax
+	movq	-840(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-832(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 335 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1120(%rbp)
+	.loc 1 333 3
+	leaq	-1120(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L75:
+	.loc 1 323 5
+	nop
+	jmp	.L46
+.L76:
+	.loc 1 326 5
+	nop
+.L46:
+.LBE18:
+.LBB19:
+	.loc 1 340 12
+	movq	str163.14(%rip), %rax
+	movq	8+str163.14(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -120(%rbp)
+	.loc 1 341 5
+	cmpl	$0, -120(%rbp)
+	je	.L77
+	.loc 1 344 12
+	movl	-164(%rbp), %r8d
+	movl	-164(%rbp), %esi
+	leaq	-880(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-144(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	movl	%r8d, %edx
+	call	__primitive_pushr2@PLT
+	addq	$32, %rsp
+	.loc 1 347 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 348 8
+	movq	-880(%rbp), %rax
+	movq	-872(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-864(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 351 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1128(%rbp)
+	.loc 1 349 3
+	leaq	-1128(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L77:
+	.loc 1 342 5
+	nop
+.L48:
+.LBE19:
+.LBB20:
+	.loc 1 356 12
+	movq	str172.15(%rip), %rax
+	movq	8+str172.15(%rip), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -124(%rbp)
+	.loc 1 357 5
+	cmpl	$0, -124(%rbp)
+	je	.L78
+	.loc 1 360 6
+	leaq	-916(%rbp), %rsi
+	leaq	-912(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_ap02_lli0@PLT
+	addq	$32, %rsp
+	.loc 1 360 5
+	testb	%al, %al
+	jne	.L79
+	.loc 1 363 12
+	movl	-916(%rbp), %esi
+	leaq	-944(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	-912(%rbp), %rax
+	movq	-904(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	-896(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_pushr1@PLT
+	addq	$32, %rsp
+	.loc 1 366 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -1140(%rbp)
+	.loc 1 367 8
+	movq	-944(%rbp), %rax
+	movq	-936(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-928(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 370 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -1136(%rbp)
+	.loc 1 368 3
+	leaq	-1136(%rbp), %rdx
+	movq	-960(%rbp), %rsi
+	movq	-952(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L5
+.L58:
+.LBE20:
+.LBB21:
+	.loc 1 104 5
+	nop
+	jmp	.L8
+.L78:
+.LBE21:
+.LBB22:
+	.loc 1 358 5
+	nop
+	jmp	.L8
+.L79:
+	.loc 1 361 5
+	nop
+.L8:
+.LBE22:
+	.loc 1 375 10
+	movl	-4(%rbp), %eax
+	.loc 1 377 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	tests_calc__loop, .-tests_calc__loop
+	.globl	io_getline__loop
+	.type	io_getline__loop, @function
+io_getline__loop:
+.LFB2:
+	.loc 1 380 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$256, %rsp
+	movl	%edi, -212(%rbp)
+	movq	%rsi, -224(%rbp)
+	movq	%rdx, -240(%rbp)
+	movq	%rcx, -232(%rbp)
+	movq	%r8, -248(%rbp)
+	movq	%r9, -256(%rbp)
+	.loc 1 388 15
+	leaq	.LC0(%rip), %rax
+	movq	%rax, -128(%rbp)
+	movq	$0, -120(%rbp)
+	.loc 1 392 27
+	movl	$0, %eax
+	call	mem_mark@PLT
+	movq	%rax, -176(%rbp)
+	movq	%rdx, -168(%rbp)
+.L81:
+.LBB23:
+	.loc 1 395 10
+	leaq	-48(%rbp), %rcx
+	leaq	-72(%rbp), %rdx
+	movq	-224(%rbp), %rsi
+	movl	-212(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_read_yyoos@PLT
+	movl	%eax, -4(%rbp)
+	.loc 1 396 6
+	leaq	-96(%rbp), %r8
+	leaq	-64(%rbp), %rcx
+	movq	str7.16(%rip), %rax
+	movq	8+str7.16(%rip), %rdx
+	movq	-48(%rbp), %rdi
+	movq	-40(%rbp), %rsi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strsplit_ssss@PLT
+	.loc 1 396 5
+	testb	%al, %al
+	jne	.L97
+	.loc 1 399 17
+	movq	-96(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -192(%rbp)
+	movq	%rdx, -184(%rbp)
+	.loc 1 400 20
+	movq	-72(%rbp), %rsi
+	leaq	-104(%rbp), %rcx
+	movq	-192(%rbp), %rax
+	movq	-184(%rbp), %rdx
+	movl	-4(%rbp), %edi
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_unread_yyoso@PLT
+	movl	%eax, -8(%rbp)
+	.loc 1 401 5
+	cmpq	$0, -248(%rbp)
+	je	.L84
+	.loc 1 401 28 discriminator 1
+	movq	-104(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L84:
+	.loc 1 402 5
+	cmpq	$0, -256(%rbp)
+	je	.L85
+	.loc 1 402 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-64(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L85:
+	.loc 1 403 10
+	movl	-8(%rbp), %eax
+	jmp	.L95
+.L97:
+	.loc 1 397 5
+	nop
+.L83:
+.LBE23:
+.LBB24:
+	.loc 1 407 11
+	movq	-128(%rbp), %rax
+	movq	-120(%rbp), %rdx
+	movq	-48(%rbp), %rdi
+	movq	-40(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -12(%rbp)
+	.loc 1 408 11
+	cmpl	$0, -12(%rbp)
+	sete	%al
+	.loc 1 408 9
+	movzbl	%al, %eax
+	movl	%eax, -16(%rbp)
+	.loc 1 409 5
+	cmpl	$0, -16(%rbp)
+	je	.L98
+	.loc 1 412 17
+	movq	-48(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -208(%rbp)
+	movq	%rdx, -200(%rbp)
+	.loc 1 413 11
+	movq	-72(%rbp), %rsi
+	leaq	-160(%rbp), %r8
+	leaq	-136(%rbp), %rcx
+	movq	-208(%rbp), %rax
+	movq	-200(%rbp), %rdx
+	movl	-4(%rbp), %edi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	io_getline__loop
+	movl	%eax, -20(%rbp)
+	.loc 1 414 5
+	cmpl	$0, -12(%rbp)
+	je	.L99
+	.loc 1 417 5
+	cmpq	$0, -248(%rbp)
+	je	.L90
+	.loc 1 417 28 discriminator 1
+	movq	-136(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L90:
+	.loc 1 418 5
+	cmpq	$0, -256(%rbp)
+	je	.L91
+	.loc 1 418 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L91:
+	.loc 1 419 10
+	movl	-20(%rbp), %eax
+	jmp	.L95
+.L98:
+	.loc 1 410 5
+	nop
+	jmp	.L92
+.L99:
+	.loc 1 415 5
+	nop
+.L92:
+.LBE24:
+	.loc 1 423 5
+	cmpq	$0, -248(%rbp)
+	je	.L93
+	.loc 1 423 28 discriminator 1
+	movq	-72(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L93:
+	.loc 1 424 5
+	cmpq	$0, -256(%rbp)
+	je	.L94
+	.loc 1 424 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-240(%rbp), %rax
+	movq	-232(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L94:
+	.loc 1 425 10
+	movl	-4(%rbp), %eax
+.L95:
+	.loc 1 427 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	io_getline__loop, .-io_getline__loop
+	.section	.rodata
+	.align 8
+.LC1:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:445: %s: Assertion `sym3' failed: "
+	.align 8
+.LC2:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:446: %s: Assertion `!__primitive_mod_iii(int2, int1, &int9)' failed: "
+	.text
+	.globl	algorithm_gcd_cl_iterate
+	.type	algorithm_gcd_cl_iterate, @function
+algorithm_gcd_cl_iterate:
+.LFB3:
+	.loc 1 430 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+	movl	%edi, -20(%rbp)
+	movl	%esi, -24(%rbp)
+	.loc 1 432 13
+	movl	$0, -4(%rbp)
+.L101:
+.LBB25:
+	.loc 1 436 10
+	movl	-24(%rbp), %eax
+	cmpl	-4(%rbp), %eax
+	setne	%al
+	.loc 1 436 8
+	movzbl	%al, %eax
+	movl	%eax, -8(%rbp)
+	.loc 1 437 19
+	cmpl	$0, -8(%rbp)
+	sete	%al
+	.loc 1 437 12
+	movzbl	%al, %eax
+	movl	%eax, -12(%rbp)
+	.loc 1 438 5
+	cmpl	$0, -12(%rbp)
+	je	.L111
+	.loc 1 441 10
+	movl	-20(%rbp), %eax
+	jmp	.L110
+.L111:
+	.loc 1 439 5
+	nop
+.L103:
+.LBE25:
+	.loc 1 445 3
+	cmpl	$0, -8(%rbp)
+	jne	.L105
+	.loc 1 445 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.20(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L106
+	.loc 1 445 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L106:
+	.loc 1 445 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L105:
+	.loc 1 446 3 is_stmt 1
+	leaq	-16(%rbp), %rdx
+	movl	-24(%rbp), %ecx
+	movl	-20(%rbp), %eax
+	movl	%ecx, %esi
+	movl	%eax, %edi
+	call	__primitive_mod_iii@PLT
+	testb	%al, %al
+	je	.L107
+	.loc 1 446 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC2(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.20(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L108
+	.loc 1 446 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L108:
+	.loc 1 446 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L107:
+	.loc 1 449 8 is_stmt 1
+	movl	-24(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	.loc 1 450 8
+	movl	-16(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	.loc 1 451 3
+	jmp	.L101
+.L110:
+	.loc 1 453 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	algorithm_gcd_cl_iterate, .-algorithm_gcd_cl_iterate
+	.section	.rodata
+	.align 8
+.LC3:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:477: %s: Assertion `sym4' failed: "
+	.align 8
+.LC4:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:496: %s: Assertion `sym21' failed: "
+	.text
+	.globl	algorithm__ct__cl_iterate
+	.type	algorithm__ct__cl_iterate, @function
+algorithm__ct__cl_iterate:
+.LFB4:
+	.loc 1 456 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$80, %rsp
+	movl	%edi, -68(%rbp)
+	movl	%esi, -72(%rbp)
+	movl	%edx, -76(%rbp)
+	.loc 1 458 13
+	movl	$0, -4(%rbp)
+	.loc 1 459 13
+	movl	$1, -8(%rbp)
+	.loc 1 462 13
+	movl	$1, -12(%rbp)
+	.loc 1 464 13
+	movl	$1, -16(%rbp)
+.L114:
+.L113:
+.LBB26:
+	.loc 1 468 10
+	movl	-76(%rbp), %eax
+	cmpl	-4(%rbp), %eax
+	setne	%al
+	.loc 1 468 8
+	movzbl	%al, %eax
+	movl	%eax, -20(%rbp)
+	.loc 1 469 19
+	cmpl	$0, -20(%rbp)
+	sete	%al
+	.loc 1 469 12
+	movzbl	%al, %eax
+	movl	%eax, -24(%rbp)
+	.loc 1 470 5
+	cmpl	$0, -24(%rbp)
+	je	.L127
+	.loc 1 473 10
+	movl	-68(%rbp), %eax
+	jmp	.L125
+.L127:
+	.loc 1 471 5
+	nop
+.L116:
+.LBE26:
+.LBB27:
+	.loc 1 477 3
+	cmpl	$0, -20(%rbp)
+	jne	.L118
+	.loc 1 477 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC3(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.19(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L119
+	.loc 1 477 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L119:
+	.loc 1 477 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L118:
+	.loc 1 478 7 is_stmt 1
+	movl	-76(%rbp), %eax
+	andl	-8(%rbp), %eax
+	movl	%eax, -28(%rbp)
+	.loc 1 479 11
+	movl	-28(%rbp), %eax
+	cmpl	-8(%rbp), %eax
+	sete	%al
+	.loc 1 479 9
+	movzbl	%al, %eax
+	movl	%eax, -32(%rbp)
+	.loc 1 480 5
+	cmpl	$0, -32(%rbp)
+	je	.L128
+	.loc 1 483 9
+	movl	-68(%rbp), %eax
+	imull	-72(%rbp), %eax
+	movl	%eax, -36(%rbp)
+	.loc 1 484 7
+	movl	-72(%rbp), %eax
+	imull	%eax, %eax
+	movl	%eax, -40(%rbp)
+	.loc 1 485 7
+	movl	-12(%rbp), %eax
+	movl	-76(%rbp), %edx
+	movl	%eax, %ecx
+	sarl	%cl, %edx
+	movl	%edx, %eax
+	movl	%eax, -44(%rbp)
+	.loc 1 488 8
+	movl	-36(%rbp), %eax
+	movl	%eax, -68(%rbp)
+	.loc 1 489 8
+	movl	-40(%rbp), %eax
+	movl	%eax, -72(%rbp)
+	.loc 1 490 8
+	movl	-44(%rbp), %eax
+	movl	%eax, -76(%rbp)
+	.loc 1 491 3
+	jmp	.L113
+.L128:
+	.loc 1 481 5
+	nop
+.L121:
+.LBE27:
+.LBB28:
+	.loc 1 495 20
+	cmpl	$0, -32(%rbp)
+	sete	%al
+	.loc 1 495 12
+	movzbl	%al, %eax
+	movl	%eax, -48(%rbp)
+	.loc 1 496 3
+	cmpl	$0, -48(%rbp)
+	jne	.L122
+	.loc 1 496 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC4(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.19(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L123
+	.loc 1 496 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L123:
+	.loc 1 496 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L122:
+	.loc 1 497 7 is_stmt 1
+	movl	-72(%rbp), %eax
+	imull	%eax, %eax
+	movl	%eax, -52(%rbp)
+	.loc 1 498 7
+	movl	-16(%rbp), %eax
+	movl	-76(%rbp), %edx
+	movl	%eax, %ecx
+	sarl	%cl, %edx
+	movl	%edx, %eax
+	movl	%eax, -56(%rbp)
+	.loc 1 502 8
+	movl	-52(%rbp), %eax
+	movl	%eax, -72(%rbp)
+	.loc 1 503 8
+	movl	-56(%rbp), %eax
+	movl	%eax, -76(%rbp)
+	.loc 1 504 3
+	jmp	.L113
+.L125:
+.LBE28:
+	.loc 1 506 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	algorithm__ct__cl_iterate, .-algorithm__ct__cl_iterate
+	.section	.rodata
+	.align 8
+.LC5:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:525: %s: Assertion `sym4' failed: "
+	.text
+	.globl	tests_fibl_cl_times_cl_iterate
+	.type	tests_fibl_cl_times_cl_iterate, @function
+tests_fibl_cl_times_cl_iterate:
+.LFB5:
+	.loc 1 509 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+	movl	%edi, -36(%rbp)
+	movl	%esi, -40(%rbp)
+	movl	%edx, -44(%rbp)
+	.loc 1 511 13
+	movl	$0, -4(%rbp)
+	.loc 1 512 13
+	movl	$1, -8(%rbp)
+.L130:
+.LBB29:
+	.loc 1 516 10
+	movl	-36(%rbp), %eax
+	cmpl	-4(%rbp), %eax
+	setg	%al
+	.loc 1 516 8
+	movzbl	%al, %eax
+	movl	%eax, -12(%rbp)
+	.loc 1 517 19
+	cmpl	$0, -12(%rbp)
+	sete	%al
+	.loc 1 517 12
+	movzbl	%al, %eax
+	movl	%eax, -16(%rbp)
+	.loc 1 518 5
+	cmpl	$0, -16(%rbp)
+	je	.L138
+	.loc 1 521 10
+	movl	-44(%rbp), %eax
+	jmp	.L137
+.L138:
+	.loc 1 519 5
+	nop
+.L132:
+.LBE29:
+.LBB30:
+	.loc 1 525 3
+	cmpl	$0, -12(%rbp)
+	jne	.L134
+	.loc 1 525 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC5(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.18(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L135
+	.loc 1 525 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L135:
+	.loc 1 525 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L134:
+	.loc 1 526 7 is_stmt 1
+	movl	-36(%rbp), %eax
+	subl	-8(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	.loc 1 527 7
+	movl	-40(%rbp), %edx
+	movl	-44(%rbp), %eax
+	addl	%edx, %eax
+	movl	%eax, -24(%rbp)
+	.loc 1 530 8
+	movl	-20(%rbp), %eax
+	movl	%eax, -36(%rbp)
+	.loc 1 531 8
+	movl	-44(%rbp), %eax
+	movl	%eax, -40(%rbp)
+	.loc 1 532 8
+	movl	-24(%rbp), %eax
+	movl	%eax, -44(%rbp)
+	.loc 1 533 3
+	jmp	.L130
+.L137:
+.LBE30:
+	.loc 1 535 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	tests_fibl_cl_times_cl_iterate, .-tests_fibl_cl_times_cl_iterate
+	.section	.rodata
+	.align 8
+.LC6:
+	.string	"\001\033[37;41m!!!\033[0m poprc_out/tests_calc.c:552: %s: Assertion `sym6' failed: "
+	.text
+	.globl	tests_fact
+	.type	tests_fact, @function
+tests_fact:
+.LFB6:
+	.loc 1 538 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+	movl	%edi, -36(%rbp)
+	.loc 1 539 13
+	movl	$1, -4(%rbp)
+.L140:
+.LBB31:
+	.loc 1 543 19
+	movl	-36(%rbp), %eax
+	cmpl	-4(%rbp), %eax
+	sete	%al
+	.loc 1 543 12
+	movzbl	%al, %eax
+	movl	%eax, -8(%rbp)
+	.loc 1 544 5
+	cmpl	$0, -8(%rbp)
+	je	.L147
+	.loc 1 547 10
+	movl	-4(%rbp), %eax
+	jmp	.L143
+.L147:
+	.loc 1 545 5
+	nop
+.L142:
+.LBE31:
+.LBB32:
+	.loc 1 551 19
+	movl	-36(%rbp), %eax
+	cmpl	-4(%rbp), %eax
+	setg	%al
+	.loc 1 551 12
+	movzbl	%al, %eax
+	movl	%eax, -12(%rbp)
+	.loc 1 552 3
+	cmpl	$0, -12(%rbp)
+	jne	.L144
+	.loc 1 552 3 is_stmt 0 discriminator 1
+	movl	$0, %eax
+	call	log_add_context@PLT
+	leaq	.LC6(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_first@PLT
+	leaq	__func__.17(%rip), %rax
+	movq	%rax, %rdi
+	call	log_add_last@PLT
+	testb	%al, %al
+	je	.L145
+	.loc 1 552 3 discriminator 2
+	movl	$0, %eax
+	call	breakpoint@PLT
+.L145:
+	.loc 1 552 3 discriminator 4
+	movl	$0, %eax
+	call	breakpoint@PLT
+	movl	$1, %edi
+	call	return_error@PLT
+.L144:
+	.loc 1 553 7 is_stmt 1
+	movl	-36(%rbp), %eax
+	subl	-4(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	.loc 1 554 14
+	movl	-16(%rbp), %eax
+	movl	%eax, %edi
+	call	tests_fact
+	movl	%eax, -20(%rbp)
+	.loc 1 555 9
+	movl	-36(%rbp), %eax
+	imull	-20(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	.loc 1 556 10
+	movl	-24(%rbp), %eax
+.L143:
+.LBE32:
+	.loc 1 558 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	tests_fact, .-tests_fact
+	.globl	list_length_cl_iterate
+	.type	list_length_cl_iterate, @function
+list_length_cl_iterate:
+.LFB7:
+	.loc 1 561 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$96, %rsp
+	movl	%edi, -84(%rbp)
+	.loc 1 564 13
+	movl	$1, -4(%rbp)
+	.loc 1 565 27
+	movl	$0, %eax
+	call	mem_mark@PLT
+	movq	%rax, -64(%rbp)
+	movq	%rdx, -56(%rbp)
+.L149:
+.LBB33:
+	.loc 1 568 6
+	leaq	-36(%rbp), %rsi
+	leaq	-32(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_ap01@PLT
+	addq	$32, %rsp
+	.loc 1 568 5
+	testb	%al, %al
+	jne	.L154
+	.loc 1 571 7
+	movl	-84(%rbp), %edx
+	movl	-4(%rbp), %eax
+	addl	%edx, %eax
+	movl	%eax, -8(%rbp)
+	.loc 1 574 8
+	movl	-8(%rbp), %eax
+	movl	%eax, -84(%rbp)
+	.loc 1 575 8
+	movq	-32(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-16(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 578 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	.loc 1 576 3
+	leaq	-72(%rbp), %rdx
+	movq	-64(%rbp), %rsi
+	movq	-56(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L149
+.L154:
+	.loc 1 569 5
+	nop
+.L151:
+.LBE33:
+	.loc 1 583 10
+	movl	-84(%rbp), %eax
+	.loc 1 585 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	list_length_cl_iterate, .-list_length_cl_iterate
+	.globl	algorithm_sum_cl_foldr_cl_iterate
+	.type	algorithm_sum_cl_foldr_cl_iterate, @function
+algorithm_sum_cl_foldr_cl_iterate:
+.LFB8:
+	.loc 1 588 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$96, %rsp
+	movl	%edi, -84(%rbp)
+	.loc 1 591 27
+	movl	$0, %eax
+	call	mem_mark@PLT
+	movq	%rax, -64(%rbp)
+	movq	%rdx, -56(%rbp)
+.L156:
+.LBB34:
+	.loc 1 594 6
+	leaq	-36(%rbp), %rsi
+	leaq	-32(%rbp), %rdi
+	subq	$8, %rsp
+	subq	$24, %rsp
+	movq	%rsp, %rcx
+	movq	16(%rbp), %rax
+	movq	24(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+	movq	32(%rbp), %rax
+	movq	%rax, 16(%rcx)
+	call	__primitive_ap01@PLT
+	addq	$32, %rsp
+	.loc 1 594 5
+	testb	%al, %al
+	jne	.L161
+	.loc 1 597 14
+	movl	-36(%rbp), %edx
+	.loc 1 597 7
+	movl	-84(%rbp), %eax
+	addl	%edx, %eax
+	movl	%eax, -4(%rbp)
+	.loc 1 600 8
+	movl	-4(%rbp), %eax
+	movl	%eax, -84(%rbp)
+	.loc 1 601 8
+	movq	-32(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rax, 16(%rbp)
+	movq	%rdx, 24(%rbp)
+	movq	-16(%rbp), %rax
+	movq	%rax, 32(%rbp)
+	.loc 1 604 27
+	leaq	16(%rbp), %rax
+	movq	%rax, -72(%rbp)
+	.loc 1 602 3
+	leaq	-72(%rbp), %rdx
+	movq	-64(%rbp), %rsi
+	movq	-56(%rbp), %rax
+	movl	$1, %r9d
+	movq	%rdx, %r8
+	movl	$0, %ecx
+	movl	$0, %edx
+	movq	%rsi, %rdi
+	movq	%rax, %rsi
+	call	mem_release@PLT
+	jmp	.L156
+.L161:
+	.loc 1 595 5
+	nop
+.L158:
+.LBE34:
+	.loc 1 609 10
+	movl	-84(%rbp), %eax
+	.loc 1 611 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	algorithm_sum_cl_foldr_cl_iterate, .-algorithm_sum_cl_foldr_cl_iterate
+	.section	.rodata
+.LC7:
+	.string	"\033[37;44mERROR\033[0m "
+	.text
+	.globl	main
+	.type	main, @function
+main:
+.LFB9:
+	.loc 1 613 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$224, %rsp
+	movl	%edi, -212(%rbp)
+	movq	%rsi, -224(%rbp)
+	.loc 1 613 1
+	leaq	-208(%rbp), %rax
+	movq	%rax, current_error(%rip)
+	movq	current_error(%rip), %rax
+	movb	$1, 204(%rax)
+	leaq	-208(%rbp), %rax
+	movq	%rax, %rdi
+	call	_setjmp@PLT
+	testl	%eax, %eax
+	je	.L164
+	.loc 1 613 1 is_stmt 0 discriminator 3
+	leaq	.LC7(%rip), %rax
+	movq	%rax, %rdi
+	movl	$0, %eax
+	call	printf@PLT
+	movl	$0, %eax
+	call	print_last_log_msg@PLT
+	movl	-8(%rbp), %eax
+	negl	%eax
+	jmp	.L166
+.L164:
+	.loc 1 613 1 discriminator 4
+	movl	$0, %eax
+	call	static_alloc_init@PLT
+	movl	$0, %eax
+	call	log_init@PLT
+	movl	$0, %eax
+	call	io_init@PLT
+	movl	$0, %eax
+	call	init_primitives@PLT
+	movl	$2, %edi
+	call	tests_calc
+	movl	$0, %eax
+.L166:
+	.loc 1 613 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	main, .-main
+	.section	.rodata
+.LC8:
+	.string	"stream,out:std"
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	str4.0, @object
+	.size	str4.0, 16
+str4.0:
+	.quad	.LC8
+	.quad	14
+	.section	.rodata
+.LC9:
+	.string	"\n"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str10.1, @object
+	.size	str10.1, 16
+str10.1:
+	.quad	.LC9
+	.quad	1
+	.section	.rodata
+.LC10:
+	.string	"stream,in:std"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str15.2, @object
+	.size	str15.2, 16
+str15.2:
+	.quad	.LC10
+	.quad	13
+	.section	.rodata
+.LC11:
+	.string	"+"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str30.3, @object
+	.size	str30.3, 16
+str30.3:
+	.quad	.LC11
+	.quad	1
+	.section	.rodata
+.LC12:
+	.string	"-"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str43.4, @object
+	.size	str43.4, 16
+str43.4:
+	.quad	.LC12
+	.quad	1
+	.section	.rodata
+.LC13:
+	.string	"*"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str56.5, @object
+	.size	str56.5, 16
+str56.5:
+	.quad	.LC13
+	.quad	1
+	.section	.rodata
+.LC14:
+	.string	"/"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str69.6, @object
+	.size	str69.6, 16
+str69.6:
+	.quad	.LC14
+	.quad	1
+	.section	.rodata
+.LC15:
+	.string	"gcd"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str82.7, @object
+	.size	str82.7, 16
+str82.7:
+	.quad	.LC15
+	.quad	3
+	.section	.rodata
+.LC16:
+	.string	"^"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str95.8, @object
+	.size	str95.8, 16
+str95.8:
+	.quad	.LC16
+	.quad	1
+	.section	.rodata
+.LC17:
+	.string	"fib"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str109.9, @object
+	.size	str109.9, 16
+str109.9:
+	.quad	.LC17
+	.quad	3
+	.section	.rodata
+.LC18:
+	.string	"fact"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str121.10, @object
+	.size	str121.10, 16
+str121.10:
+	.quad	.LC18
+	.quad	4
+	.section	.rodata
+.LC19:
+	.string	"len"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str131.11, @object
+	.size	str131.11, 16
+str131.11:
+	.quad	.LC19
+	.quad	3
+	.section	.rodata
+.LC20:
+	.string	"sum"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str141.12, @object
+	.size	str141.12, 16
+str141.12:
+	.quad	.LC20
+	.quad	3
+	.section	.rodata
+.LC21:
+	.string	"swap"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str150.13, @object
+	.size	str150.13, 16
+str150.13:
+	.quad	.LC21
+	.quad	4
+	.section	.rodata
+.LC22:
+	.string	"dup"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str163.14, @object
+	.size	str163.14, 16
+str163.14:
+	.quad	.LC22
+	.quad	3
+	.section	.rodata
+.LC23:
+	.string	"drop"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str172.15, @object
+	.size	str172.15, 16
+str172.15:
+	.quad	.LC23
+	.quad	4
+	.align 16
+	.type	str7.16, @object
+	.size	str7.16, 16
+str7.16:
+	.quad	.LC9
+	.quad	1
+	.section	.rodata
+	.align 16
+	.type	__func__.20, @object
+	.size	__func__.20, 25
+__func__.20:
+	.string	"algorithm_gcd_cl_iterate"
+	.align 16
+	.type	__func__.19, @object
+	.size	__func__.19, 26
+__func__.19:
+	.string	"algorithm__ct__cl_iterate"
+	.align 16
+	.type	__func__.18, @object
+	.size	__func__.18, 31
+__func__.18:
+	.string	"tests_fibl_cl_times_cl_iterate"
+	.align 8
+	.type	__func__.17, @object
+	.size	__func__.17, 11
+__func__.17:
+	.string	"tests_fact"
+	.text
+.Letext0:
+	.file 2 "/usr/include/stdint.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./startle/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.file 8 "/usr/include/setjmp.h"
+	.file 9 ".gen/startle/error.h"
+	.file 10 ".gen/cgen/primitives.h"
+	.file 11 ".gen/io.h"
+	.file 12 ".gen/startle/log.h"
+	.file 13 ".gen/startle/static_alloc.h"
+	.file 14 "/usr/include/stdio.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x162f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF252
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.long	0x58
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x9
+	.long	0x72
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0xd
+	.long	0x72
+	.uleb128 0x7
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x57
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x43
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x9
+	.long	0x79
+	.uleb128 0x17
+	.long	.LASF14
+	.byte	0x10
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x10
+	.long	0xcd
+	.uleb128 0x14
+	.string	"s"
+	.byte	0x4
+	.byte	0x20
+	.byte	0xf
+	.long	0xa4
+	.byte	0
+	.uleb128 0x14
+	.string	"n"
+	.byte	0x4
+	.byte	0x21
+	.byte	0xa
+	.long	0x8a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x22
+	.byte	0x3
+	.long	0xa9
+	.uleb128 0xd
+	.long	0xcd
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF15
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF16
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0xf8
+	.uleb128 0x10
+	.long	0x64
+	.long	0x108
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x18
+	.byte	0x80
+	.byte	0x6
+	.byte	0x5
+	.long	0x11e
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x7
+	.byte	0x15
+	.long	0x11e
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x43
+	.long	0x12e
+	.uleb128 0x11
+	.long	0x43
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.long	0x108
+	.uleb128 0x17
+	.long	.LASF20
+	.byte	0xc8
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x8
+	.long	0x16f
+	.uleb128 0xa
+	.long	.LASF21
+	.byte	0x7
+	.byte	0x20
+	.byte	0xf
+	.long	0xec
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x21
+	.byte	0x9
+	.long	0x58
+	.byte	0x40
+	.uleb128 0xa
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x22
+	.byte	0x10
+	.long	0x12e
+	.byte	0x48
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1e
+	.long	0x17b
+	.uleb128 0x10
+	.long	0x13a
+	.long	0x18b
+	.uleb128 0x11
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF253
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x9
+	.byte	0x8
+	.byte	0x6
+	.long	0x1b0
+	.uleb128 0x19
+	.long	.LASF25
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF26
+	.byte	0x1
+	.uleb128 0x19
+	.long	.LASF27
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF28
+	.byte	0x9
+	.byte	0xe
+	.byte	0x1b
+	.long	0x18b
+	.uleb128 0x18
+	.byte	0xd0
+	.byte	0x9
+	.byte	0x10
+	.long	0x1ec
+	.uleb128 0x14
+	.string	"env"
+	.byte	0x9
+	.byte	0x11
+	.byte	0xb
+	.long	0x16f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF29
+	.byte	0x9
+	.byte	0x12
+	.byte	0x10
+	.long	0x1b0
+	.byte	0xc8
+	.uleb128 0xa
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x13
+	.byte	0x8
+	.long	0xde
+	.byte	0xcc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x14
+	.byte	0x2
+	.long	0x1bc
+	.uleb128 0x20
+	.long	.LASF254
+	.byte	0x9
+	.byte	0x15
+	.byte	0x1e
+	.long	0x204
+	.uleb128 0x9
+	.long	0x1ec
+	.uleb128 0x7
+	.long	.LASF32
+	.byte	0xa
+	.byte	0x3
+	.byte	0xd
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0xa
+	.byte	0x8
+	.byte	0x16
+	.long	0x221
+	.uleb128 0x17
+	.long	.LASF33
+	.byte	0x18
+	.byte	0xa
+	.byte	0x9
+	.byte	0x8
+	.long	0x263
+	.uleb128 0xa
+	.long	.LASF34
+	.byte	0xa
+	.byte	0xa
+	.byte	0x10
+	.long	0x3c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF35
+	.byte	0xa
+	.byte	0xb
+	.byte	0x10
+	.long	0x3c
+	.byte	0x4
+	.uleb128 0xa
+	.long	.LASF36
+	.byte	0xa
+	.byte	0xc
+	.byte	0x10
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0xa
+	.long	.LASF37
+	.byte	0xa
+	.byte	0xd
+	.byte	0x8
+	.long	0x263
+	.byte	0x10
+	.byte	0
+	.uleb128 0x9
+	.long	0x58
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0xa
+	.byte	0x51
+	.long	0x28b
+	.uleb128 0x14
+	.string	"mem"
+	.byte	0xa
+	.byte	0x52
+	.byte	0x8
+	.long	0x263
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF38
+	.byte	0xa
+	.byte	0x53
+	.byte	0x9
+	.long	0x6d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF39
+	.byte	0xa
+	.byte	0x54
+	.byte	0x2
+	.long	0x268
+	.uleb128 0xd
+	.long	0x28b
+	.uleb128 0x7
+	.long	.LASF40
+	.byte	0xa
+	.byte	0x62
+	.byte	0xf
+	.long	0x6b
+	.uleb128 0x7
+	.long	.LASF41
+	.byte	0xa
+	.byte	0x63
+	.byte	0xd
+	.long	0x58
+	.uleb128 0x12
+	.long	.LASF42
+	.byte	0xa
+	.byte	0x61
+	.long	0x2c1
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF43
+	.byte	0xb
+	.byte	0x15
+	.long	0x2ce
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0xc
+	.byte	0x74
+	.long	0x2db
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF45
+	.byte	0xd
+	.byte	0x7
+	.long	0x2e8
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF46
+	.byte	0xc
+	.byte	0x6a
+	.long	0x2f5
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF47
+	.byte	0xe
+	.value	0x164
+	.byte	0xc
+	.long	0x58
+	.long	0x30d
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xc
+	.long	0x58
+	.long	0x323
+	.uleb128 0x2
+	.long	0x323
+	.byte	0
+	.uleb128 0x9
+	.long	0x13a
+	.uleb128 0x5
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x11
+	.byte	0x6
+	.long	0xde
+	.long	0x348
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF52
+	.byte	0x9
+	.byte	0xf
+	.long	0x359
+	.uleb128 0x2
+	.long	0x1b0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x1a
+	.long	0x366
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF51
+	.byte	0xc
+	.byte	0x27
+	.byte	0x6
+	.long	0xde
+	.long	0x37c
+	.uleb128 0x2
+	.long	0x7e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0xc
+	.byte	0x2d
+	.long	0x38d
+	.uleb128 0x2
+	.long	0x7e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF54
+	.byte	0xc
+	.byte	0x32
+	.long	0x39a
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0xa
+	.byte	0x4
+	.byte	0xa
+	.long	0x209
+	.long	0x3bf
+	.uleb128 0x2
+	.long	0x209
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0x3bf
+	.byte	0
+	.uleb128 0x9
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x17
+	.byte	0x6
+	.long	0xde
+	.long	0x3e9
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0x3e9
+	.uleb128 0x2
+	.long	0x3e9
+	.byte	0
+	.uleb128 0x9
+	.long	0xcd
+	.uleb128 0x5
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x19
+	.byte	0xa
+	.long	0x209
+	.long	0x413
+	.uleb128 0x2
+	.long	0x209
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0x3bf
+	.uleb128 0x2
+	.long	0x3e9
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x26
+	.byte	0x6
+	.long	0xde
+	.long	0x433
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x9
+	.long	0x215
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xa
+	.byte	0x20
+	.byte	0x7
+	.long	0x215
+	.long	0x458
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0x2
+	.long	0x58
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x12
+	.byte	0x6
+	.long	0xde
+	.long	0x478
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x28
+	.byte	0x6
+	.long	0xde
+	.long	0x49d
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x263
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x1b
+	.byte	0xa
+	.long	0x209
+	.long	0x4b8
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x55
+	.long	0x4dd
+	.uleb128 0x2
+	.long	0x28b
+	.uleb128 0x2
+	.long	0x4dd
+	.uleb128 0x2
+	.long	0x3c
+	.uleb128 0x2
+	.long	0x4e2
+	.uleb128 0x2
+	.long	0x3c
+	.byte	0
+	.uleb128 0x9
+	.long	0x3e9
+	.uleb128 0x9
+	.long	0x433
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x23
+	.byte	0x7
+	.long	0x215
+	.long	0x502
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x58
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x6
+	.long	0xde
+	.long	0x51d
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x2
+	.byte	0x7
+	.long	0xcd
+	.long	0x533
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x6
+	.byte	0xa
+	.long	0x209
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x209
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.long	0x209
+	.long	0x573
+	.uleb128 0x2
+	.long	0x209
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0x3bf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x13
+	.byte	0x7
+	.long	0xcd
+	.long	0x58e
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xa
+	.byte	0x7
+	.byte	0x7
+	.long	0xcd
+	.long	0x5a4
+	.uleb128 0x2
+	.long	0x58
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x6
+	.long	0xde
+	.long	0x5c4
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x263
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0xa
+	.byte	0x15
+	.byte	0xa
+	.long	0x209
+	.long	0x5e4
+	.uleb128 0x2
+	.long	0x209
+	.uleb128 0x2
+	.long	0xcd
+	.uleb128 0x2
+	.long	0x3bf
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF73
+	.byte	0xa
+	.byte	0x5a
+	.byte	0xc
+	.long	0x28b
+	.long	0x5f6
+	.uleb128 0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF74
+	.byte	0xa
+	.byte	0x4f
+	.byte	0x7
+	.long	0x215
+	.long	0x60c
+	.uleb128 0x2
+	.long	0x58
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF77
+	.value	0x265
+	.byte	0x1
+	.long	0x58
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x65f
+	.uleb128 0x6
+	.long	.LASF75
+	.value	0x265
+	.byte	0x1
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -228
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x265
+	.byte	0x1
+	.long	0x65f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x3
+	.long	.LASF81
+	.value	0x265
+	.byte	0x1
+	.long	0x1ec
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0x9
+	.long	0x6d
+	.uleb128 0xe
+	.long	.LASF78
+	.value	0x24b
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x713
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x24b
+	.byte	0x2b
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x6
+	.long	.LASF80
+	.value	0x24b
+	.byte	0x37
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x3
+	.long	.LASF82
+	.value	0x24d
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF83
+	.value	0x24e
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF84
+	.value	0x24f
+	.byte	0x14
+	.long	0x297
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x251
+	.quad	.L156
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x260
+	.quad	.L158
+	.uleb128 0xf
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.uleb128 0x3
+	.long	.LASF87
+	.value	0x255
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF88
+	.value	0x230
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d1
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x230
+	.byte	0x20
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x6
+	.long	.LASF80
+	.value	0x230
+	.byte	0x2c
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x3
+	.long	.LASF82
+	.value	0x232
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF89
+	.value	0x233
+	.byte	0x9
+	.long	0x2a8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF90
+	.value	0x234
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF84
+	.value	0x235
+	.byte	0x14
+	.long	0x297
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x237
+	.quad	.L149
+	.uleb128 0x4
+	.long	.LASF91
+	.value	0x246
+	.quad	.L151
+	.uleb128 0xf
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x3
+	.long	.LASF87
+	.value	0x23b
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF92
+	.value	0x219
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b6
+	.uleb128 0x6
+	.long	.LASF93
+	.value	0x219
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF94
+	.value	0x21b
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF95
+	.value	0x21c
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x21e
+	.quad	.L140
+	.uleb128 0x4
+	.long	.LASF96
+	.value	0x226
+	.quad	.L142
+	.uleb128 0x15
+	.long	.LASF105
+	.long	0x8c6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__func__.17
+	.uleb128 0x13
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.long	0x876
+	.uleb128 0x3
+	.long	.LASF97
+	.value	0x21f
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.uleb128 0x3
+	.long	.LASF98
+	.value	0x227
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x3
+	.long	.LASF99
+	.value	0x229
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF100
+	.value	0x22a
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x79
+	.long	0x8c6
+	.uleb128 0x11
+	.long	0x43
+	.byte	0xa
+	.byte	0
+	.uleb128 0xd
+	.long	0x8b6
+	.uleb128 0xe
+	.long	.LASF101
+	.value	0x1fc
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9da
+	.uleb128 0x6
+	.long	.LASF94
+	.value	0x1fc
+	.byte	0x28
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x1fc
+	.byte	0x32
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF93
+	.value	0x1fc
+	.byte	0x3c
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.long	.LASF102
+	.value	0x1fe
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x3
+	.long	.LASF103
+	.value	0x1ff
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF104
+	.value	0x200
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x16
+	.long	.LASF111
+	.value	0x201
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x203
+	.quad	.L130
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x20c
+	.quad	.L132
+	.uleb128 0x15
+	.long	.LASF105
+	.long	0x9ea
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__func__.18
+	.uleb128 0x13
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x9a9
+	.uleb128 0x3
+	.long	.LASF98
+	.value	0x205
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0x3
+	.long	.LASF95
+	.value	0x20e
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF106
+	.value	0x20f
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x79
+	.long	0x9ea
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x1e
+	.byte	0
+	.uleb128 0xd
+	.long	0x9da
+	.uleb128 0xe
+	.long	.LASF107
+	.value	0x1c7
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbac
+	.uleb128 0x6
+	.long	.LASF94
+	.value	0x1c7
+	.byte	0x23
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x1c7
+	.byte	0x2d
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x6
+	.long	.LASF93
+	.value	0x1c7
+	.byte	0x37
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x3
+	.long	.LASF102
+	.value	0x1c9
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF103
+	.value	0x1ca
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF104
+	.value	0x1cb
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF108
+	.value	0x1cc
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF109
+	.value	0x1cd
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF110
+	.value	0x1ce
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x16
+	.long	.LASF112
+	.value	0x1cf
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF113
+	.value	0x1d0
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x16
+	.long	.LASF114
+	.value	0x1d1
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x1d3
+	.quad	.L114
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x1dc
+	.quad	.L116
+	.uleb128 0x15
+	.long	.LASF105
+	.long	0xbbc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__func__.19
+	.uleb128 0x4
+	.long	.LASF115
+	.value	0x1ee
+	.quad	.L121
+	.uleb128 0x13
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.long	0xb27
+	.uleb128 0x3
+	.long	.LASF98
+	.value	0x1d5
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.long	0xb6a
+	.uleb128 0x3
+	.long	.LASF95
+	.value	0x1de
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x3
+	.long	.LASF116
+	.value	0x1e4
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF117
+	.value	0x1e5
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.uleb128 0x3
+	.long	.LASF118
+	.value	0x1ef
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF119
+	.value	0x1f1
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x3
+	.long	.LASF120
+	.value	0x1f2
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x79
+	.long	0xbbc
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x19
+	.byte	0
+	.uleb128 0xd
+	.long	0xbac
+	.uleb128 0xe
+	.long	.LASF121
+	.value	0x1ad
+	.byte	0x5
+	.long	0x58
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc8d
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x1ad
+	.byte	0x22
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x6
+	.long	.LASF93
+	.value	0x1ad
+	.byte	0x2c
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF122
+	.value	0x1af
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF83
+	.value	0x1b0
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF100
+	.value	0x1b1
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x16
+	.long	.LASF95
+	.value	0x1b1
+	.byte	0xd
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x1b3
+	.quad	.L101
+	.uleb128 0x4
+	.long	.LASF123
+	.value	0x1bc
+	.quad	.L103
+	.uleb128 0x15
+	.long	.LASF105
+	.long	0xc9d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__func__.20
+	.uleb128 0xf
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x3
+	.long	.LASF124
+	.value	0x1b5
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x79
+	.long	0xc9d
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x18
+	.byte	0
+	.uleb128 0xd
+	.long	0xc8d
+	.uleb128 0xe
+	.long	.LASF125
+	.value	0x17b
+	.byte	0xa
+	.long	0x209
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe7a
+	.uleb128 0x6
+	.long	.LASF122
+	.value	0x17b
+	.byte	0x24
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -228
+	.uleb128 0x6
+	.long	.LASF126
+	.value	0x17b
+	.byte	0x33
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x6
+	.long	.LASF127
+	.value	0x17b
+	.byte	0x40
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x6
+	.long	.LASF128
+	.value	0x17b
+	.byte	0x50
+	.long	0xe7a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.uleb128 0x6
+	.long	.LASF129
+	.value	0x17b
+	.byte	0x62
+	.long	0x3e9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x3
+	.long	.LASF102
+	.value	0x17d
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF130
+	.value	0x17e
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF131
+	.value	0x17e
+	.byte	0xf
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF132
+	.value	0x17f
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str7.16
+	.uleb128 0x3
+	.long	.LASF133
+	.value	0x180
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF134
+	.value	0x181
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF135
+	.value	0x182
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF136
+	.value	0x183
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x3
+	.long	.LASF137
+	.value	0x184
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x3
+	.long	.LASF138
+	.value	0x185
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF118
+	.value	0x185
+	.byte	0x13
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF139
+	.value	0x186
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x3
+	.long	.LASF140
+	.value	0x187
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x3
+	.long	.LASF84
+	.value	0x188
+	.byte	0x14
+	.long	0x297
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x18a
+	.quad	.L81
+	.uleb128 0x4
+	.long	.LASF141
+	.value	0x196
+	.quad	.L83
+	.uleb128 0x4
+	.long	.LASF142
+	.value	0x1a6
+	.quad	.L92
+	.uleb128 0x13
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.long	0xe57
+	.uleb128 0x3
+	.long	.LASF143
+	.value	0x18f
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x3
+	.long	.LASF144
+	.value	0x190
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x3
+	.long	.LASF145
+	.value	0x19c
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x29c
+	.uleb128 0x23
+	.long	.LASF146
+	.byte	0x1
+	.byte	0x18
+	.byte	0xa
+	.long	0x209
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15bb
+	.uleb128 0x1b
+	.long	.LASF97
+	.byte	0x18
+	.byte	0x24
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1156
+	.uleb128 0x1b
+	.long	.LASF80
+	.byte	0x18
+	.byte	0x30
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x1a
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str4.0
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x1b
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x1c
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x1d
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x1e
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str10.1
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x1f
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x20
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str15.2
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x21
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x22
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x23
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x23
+	.byte	0x10
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x24
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -260
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x25
+	.byte	0xc
+	.long	0x29c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x26
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x26
+	.byte	0x13
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x27
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str30.3
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x28
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x29
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -308
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x29
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -312
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x29
+	.byte	0x15
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x2a
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x2b
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str43.4
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x2d
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x2e
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -372
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x2e
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x2e
+	.byte	0x15
+	.long	0x58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x2f
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x30
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x31
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str56.5
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x32
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x33
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -436
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x33
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x33
+	.byte	0x15
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x34
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -464
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x35
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x36
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str69.6
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x37
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x38
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -500
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x38
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -504
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x38
+	.byte	0x15
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -508
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x39
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -544
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x3a
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x3b
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str82.7
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x3c
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x3d
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -580
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x3d
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x3d
+	.byte	0x15
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x3e
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x3f
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x40
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str95.8
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x41
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x42
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -644
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x42
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x42
+	.byte	0x16
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x43
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x44
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x45
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x46
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str109.9
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x47
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x48
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x49
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -704
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x4a
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x4b
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str121.10
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x4c
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x4d
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x4e
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x4f
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str131.11
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x50
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x51
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -768
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x52
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x53
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str141.12
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x54
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x55
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -800
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x56
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0x57
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str150.13
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0x58
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -832
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0x59
+	.byte	0x9
+	.long	0x2a8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -836
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0x59
+	.byte	0x11
+	.long	0x2a8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -840
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0x5a
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -864
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x5b
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x5c
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str163.14
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x5d
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -896
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x5e
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x5f
+	.byte	0xf
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str172.15
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0x60
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -928
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0x61
+	.byte	0x9
+	.long	0x2a8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -932
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x62
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -960
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x63
+	.byte	0x14
+	.long	0x297
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -976
+	.uleb128 0xc
+	.long	.LASF85
+	.byte	0x65
+	.quad	.L6
+	.uleb128 0x4
+	.long	.LASF231
+	.value	0x176
+	.quad	.L8
+	.uleb128 0xc
+	.long	.LASF232
+	.byte	0x81
+	.quad	.L10
+	.uleb128 0xc
+	.long	.LASF142
+	.byte	0x95
+	.quad	.L14
+	.uleb128 0xc
+	.long	.LASF233
+	.byte	0xa9
+	.quad	.L18
+	.uleb128 0xc
+	.long	.LASF234
+	.byte	0xbd
+	.quad	.L22
+	.uleb128 0xc
+	.long	.LASF235
+	.byte	0xd3
+	.quad	.L27
+	.uleb128 0xc
+	.long	.LASF236
+	.byte	0xe7
+	.quad	.L31
+	.uleb128 0xc
+	.long	.LASF237
+	.byte	0xfb
+	.quad	.L33
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x10d
+	.quad	.L35
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x11e
+	.quad	.L38
+	.uleb128 0x4
+	.long	.LASF240
+	.value	0x12f
+	.quad	.L40
+	.uleb128 0x4
+	.long	.LASF241
+	.value	0x140
+	.quad	.L42
+	.uleb128 0x4
+	.long	.LASF242
+	.value	0x153
+	.quad	.L46
+	.uleb128 0x4
+	.long	.LASF243
+	.value	0x163
+	.quad	.L48
+	.uleb128 0x24
+	.long	.LLRL0
+	.long	0x15a4
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x66
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0x6a
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -992
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x6b
+	.byte	0x9
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1008
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x6c
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0x6d
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0x6e
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0x6f
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0x76
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1040
+	.byte	0
+	.uleb128 0x25
+	.long	.LLRL1
+	.uleb128 0x3
+	.long	.LASF249
+	.value	0x100
+	.byte	0x7
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF255
+	.byte	0x1
+	.byte	0xd
+	.byte	0xa
+	.long	0x209
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1b
+	.long	.LASF250
+	.byte	0xd
+	.byte	0x1e
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xf
+	.byte	0xd
+	.long	0x5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xc
+	.long	.LASF85
+	.byte	0x11
+	.quad	.L2
+	.uleb128 0xf
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0x12
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x13
+	.byte	0xc
+	.long	0x209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF209:
+	.string	"sym130"
+.LASF163:
+	.string	"lst39"
+.LASF92:
+	.string	"tests_fact"
+.LASF11:
+	.string	"size_t"
+.LASF30:
+	.string	"quiet"
+.LASF196:
+	.string	"int100"
+.LASF197:
+	.string	"int101"
+.LASF198:
+	.string	"int102"
+.LASF185:
+	.string	"sym81"
+.LASF14:
+	.string	"seg_t"
+.LASF20:
+	.string	"__jmp_buf_tag"
+.LASF51:
+	.string	"log_add_last"
+.LASF166:
+	.string	"lst46"
+.LASF213:
+	.string	"sym140"
+.LASF174:
+	.string	"int60"
+.LASF175:
+	.string	"int61"
+.LASF176:
+	.string	"int62"
+.LASF217:
+	.string	"sym149"
+.LASF169:
+	.string	"int49"
+.LASF249:
+	.string	"int112"
+.LASF202:
+	.string	"int113"
+.LASF203:
+	.string	"int114"
+.LASF105:
+	.string	"__func__"
+.LASF192:
+	.string	"sym94"
+.LASF170:
+	.string	"lst52"
+.LASF173:
+	.string	"lst59"
+.LASF181:
+	.string	"int73"
+.LASF182:
+	.string	"int74"
+.LASF183:
+	.string	"int75"
+.LASF60:
+	.string	"__primitive_div_iii"
+.LASF237:
+	.string	"block108"
+.LASF207:
+	.string	"int124"
+.LASF69:
+	.string	"__primitive_strcat_sss"
+.LASF29:
+	.string	"type"
+.LASF66:
+	.string	"__primitive_strtrim_ss"
+.LASF91:
+	.string	"block10"
+.LASF141:
+	.string	"block15"
+.LASF93:
+	.string	"int1"
+.LASF79:
+	.string	"int2"
+.LASF94:
+	.string	"int3"
+.LASF83:
+	.string	"int4"
+.LASF103:
+	.string	"int5"
+.LASF87:
+	.string	"int6"
+.LASF90:
+	.string	"int7"
+.LASF99:
+	.string	"int8"
+.LASF100:
+	.string	"int9"
+.LASF188:
+	.string	"int86"
+.LASF189:
+	.string	"int87"
+.LASF190:
+	.string	"int88"
+.LASF211:
+	.string	"int134"
+.LASF177:
+	.string	"lst65"
+.LASF115:
+	.string	"block20"
+.LASF180:
+	.string	"lst72"
+.LASF232:
+	.string	"block29"
+.LASF184:
+	.string	"lst78"
+.LASF195:
+	.string	"int99"
+.LASF238:
+	.string	"block120"
+.LASF31:
+	.string	"error_t"
+.LASF38:
+	.string	"strings"
+.LASF252:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF44:
+	.string	"log_init"
+.LASF215:
+	.string	"int144"
+.LASF128:
+	.string	"out_intf0"
+.LASF187:
+	.string	"lst85"
+.LASF77:
+	.string	"main"
+.LASF239:
+	.string	"block130"
+.LASF81:
+	.string	"error"
+.LASF129:
+	.string	"out_str1"
+.LASF27:
+	.string	"ERROR_TYPE_LIMITATION"
+.LASF142:
+	.string	"block42"
+.LASF191:
+	.string	"lst91"
+.LASF194:
+	.string	"lst98"
+.LASF6:
+	.string	"signed char"
+.LASF240:
+	.string	"block140"
+.LASF201:
+	.string	"str109"
+.LASF241:
+	.string	"block149"
+.LASF37:
+	.string	"elem"
+.LASF89:
+	.string	"any4"
+.LASF2:
+	.string	"unsigned char"
+.LASF233:
+	.string	"block55"
+.LASF98:
+	.string	"sym6"
+.LASF15:
+	.string	"_Bool"
+.LASF121:
+	.string	"algorithm_gcd_cl_iterate"
+.LASF72:
+	.string	"__primitive_open_yyso"
+.LASF234:
+	.string	"block68"
+.LASF9:
+	.string	"char"
+.LASF206:
+	.string	"str121"
+.LASF143:
+	.string	"str10"
+.LASF242:
+	.string	"block162"
+.LASF150:
+	.string	"str15"
+.LASF137:
+	.string	"str17"
+.LASF152:
+	.string	"str19"
+.LASF34:
+	.string	"capacity"
+.LASF210:
+	.string	"str131"
+.LASF145:
+	.string	"str20"
+.LASF153:
+	.string	"str21"
+.LASF126:
+	.string	"intf2"
+.LASF53:
+	.string	"log_add_first"
+.LASF235:
+	.string	"block81"
+.LASF133:
+	.string	"intf8"
+.LASF214:
+	.string	"str141"
+.LASF158:
+	.string	"str30"
+.LASF231:
+	.string	"block182"
+.LASF71:
+	.string	"__primitive_ap01"
+.LASF61:
+	.string	"__primitive_ap02"
+.LASF33:
+	.string	"array"
+.LASF47:
+	.string	"printf"
+.LASF223:
+	.string	"sym162"
+.LASF236:
+	.string	"block94"
+.LASF218:
+	.string	"str150"
+.LASF165:
+	.string	"str43"
+.LASF39:
+	.string	"mem_mark_t"
+.LASF57:
+	.string	"__primitive_read_yyoos"
+.LASF224:
+	.string	"str163"
+.LASF172:
+	.string	"str56"
+.LASF5:
+	.string	"long unsigned int"
+.LASF199:
+	.string	"lst105"
+.LASF67:
+	.string	"__primitive_close_yyo"
+.LASF226:
+	.string	"sym171"
+.LASF227:
+	.string	"str172"
+.LASF179:
+	.string	"str69"
+.LASF204:
+	.string	"lst117"
+.LASF22:
+	.string	"__mask_was_saved"
+.LASF250:
+	.string	"sym1"
+.LASF97:
+	.string	"sym2"
+.LASF122:
+	.string	"sym3"
+.LASF102:
+	.string	"sym4"
+.LASF124:
+	.string	"sym5"
+.LASF75:
+	.string	"argc"
+.LASF84:
+	.string	"mark"
+.LASF76:
+	.string	"argv"
+.LASF208:
+	.string	"lst127"
+.LASF12:
+	.string	"long long int"
+.LASF186:
+	.string	"str82"
+.LASF212:
+	.string	"lst137"
+.LASF16:
+	.string	"double"
+.LASF68:
+	.string	"__primitive_write_yyoso"
+.LASF54:
+	.string	"log_add_context"
+.LASF193:
+	.string	"str95"
+.LASF216:
+	.string	"lst146"
+.LASF4:
+	.string	"unsigned int"
+.LASF56:
+	.string	"__primitive_strsplit_ssss"
+.LASF10:
+	.string	"intptr_t"
+.LASF219:
+	.string	"lst153"
+.LASF222:
+	.string	"lst159"
+.LASF32:
+	.string	"symbol_t"
+.LASF35:
+	.string	"offset"
+.LASF42:
+	.string	"init_primitives"
+.LASF43:
+	.string	"io_init"
+.LASF8:
+	.string	"long int"
+.LASF243:
+	.string	"block171"
+.LASF23:
+	.string	"__saved_mask"
+.LASF225:
+	.string	"lst168"
+.LASF21:
+	.string	"__jmpbuf"
+.LASF127:
+	.string	"str1"
+.LASF148:
+	.string	"intf5"
+.LASF147:
+	.string	"str4"
+.LASF130:
+	.string	"str5"
+.LASF131:
+	.string	"str6"
+.LASF132:
+	.string	"str7"
+.LASF244:
+	.string	"str8"
+.LASF134:
+	.string	"str9"
+.LASF80:
+	.string	"lst1"
+.LASF17:
+	.string	"__jmp_buf"
+.LASF82:
+	.string	"lst3"
+.LASF149:
+	.string	"lst6"
+.LASF228:
+	.string	"lst175"
+.LASF13:
+	.string	"long double"
+.LASF230:
+	.string	"lst179"
+.LASF28:
+	.string	"error_type_t"
+.LASF49:
+	.string	"__primitive_mod_iii"
+.LASF85:
+	.string	"entry"
+.LASF41:
+	.string	"any_t"
+.LASF55:
+	.string	"__primitive_unread_yyoso"
+.LASF45:
+	.string	"static_alloc_init"
+.LASF125:
+	.string	"io_getline__loop"
+.LASF251:
+	.string	"lst2"
+.LASF36:
+	.string	"size"
+.LASF52:
+	.string	"return_error"
+.LASF253:
+	.string	"error_type_e"
+.LASF140:
+	.string	"str35"
+.LASF24:
+	.string	"jmp_buf"
+.LASF64:
+	.string	"__primitive_pushr1"
+.LASF59:
+	.string	"__primitive_pushr2"
+.LASF25:
+	.string	"ERROR_TYPE_NONE"
+.LASF135:
+	.string	"intf12"
+.LASF151:
+	.string	"intf16"
+.LASF101:
+	.string	"tests_fibl_cl_times_cl_iterate"
+.LASF155:
+	.string	"intf24"
+.LASF74:
+	.string	"__primitive_quote0_li"
+.LASF139:
+	.string	"intf28"
+.LASF70:
+	.string	"__primitive_to_string_si"
+.LASF255:
+	.string	"tests_calc"
+.LASF144:
+	.string	"sym11"
+.LASF108:
+	.string	"sym12"
+.LASF245:
+	.string	"sym13"
+.LASF246:
+	.string	"sym14"
+.LASF136:
+	.string	"sym16"
+.LASF247:
+	.string	"sym17"
+.LASF138:
+	.string	"sym18"
+.LASF254:
+	.string	"current_error"
+.LASF220:
+	.string	"any154"
+.LASF221:
+	.string	"any157"
+.LASF62:
+	.string	"__primitive_eq_str_yss"
+.LASF7:
+	.string	"short int"
+.LASF118:
+	.string	"sym21"
+.LASF156:
+	.string	"sym25"
+.LASF157:
+	.string	"sym29"
+.LASF48:
+	.string	"_setjmp"
+.LASF63:
+	.string	"mem_release"
+.LASF18:
+	.string	"__val"
+.LASF96:
+	.string	"block6"
+.LASF88:
+	.string	"list_length_cl_iterate"
+.LASF123:
+	.string	"block8"
+.LASF86:
+	.string	"block9"
+.LASF95:
+	.string	"int10"
+.LASF104:
+	.string	"int11"
+.LASF106:
+	.string	"int12"
+.LASF111:
+	.string	"int13"
+.LASF109:
+	.string	"int14"
+.LASF116:
+	.string	"int15"
+.LASF117:
+	.string	"int16"
+.LASF110:
+	.string	"int17"
+.LASF112:
+	.string	"int18"
+.LASF229:
+	.string	"any176"
+.LASF164:
+	.string	"sym42"
+.LASF40:
+	.string	"opaque_t"
+.LASF26:
+	.string	"ERROR_TYPE_UNEXPECTED"
+.LASF154:
+	.string	"int22"
+.LASF119:
+	.string	"int23"
+.LASF120:
+	.string	"int24"
+.LASF113:
+	.string	"int25"
+.LASF114:
+	.string	"int26"
+.LASF58:
+	.string	"__primitive_ap02_lli0"
+.LASF65:
+	.string	"__primitive_from_string_is"
+.LASF171:
+	.string	"sym55"
+.LASF159:
+	.string	"lst33"
+.LASF3:
+	.string	"short unsigned int"
+.LASF50:
+	.string	"breakpoint"
+.LASF160:
+	.string	"int34"
+.LASF161:
+	.string	"int35"
+.LASF162:
+	.string	"int36"
+.LASF78:
+	.string	"algorithm_sum_cl_foldr_cl_iterate"
+.LASF178:
+	.string	"sym68"
+.LASF248:
+	.string	"lst26"
+.LASF205:
+	.string	"sym120"
+.LASF200:
+	.string	"sym108"
+.LASF107:
+	.string	"algorithm__ct__cl_iterate"
+.LASF167:
+	.string	"int47"
+.LASF168:
+	.string	"int48"
+.LASF19:
+	.string	"__sigset_t"
+.LASF46:
+	.string	"print_last_log_msg"
+.LASF146:
+	.string	"tests_calc__loop"
+.LASF73:
+	.string	"mem_mark"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"poprc_out/tests_calc.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
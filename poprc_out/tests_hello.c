@@ -0,0 +1,87 @@
+#include "cgen/main.h"
+
+symbol_t tests_hello(symbol_t sym1);
+symbol_t io_getline__loop(symbol_t sym3, opaque_t intf2, seg_t str1, opaque_t *out_intf0, seg_t *out_str1);
+
+symbol_t tests_hello(symbol_t sym1)
+{
+  const seg_t str3 = { .s = "stream,out:std", .n = 14 };
+  opaque_t intf4;
+  const seg_t str6 = { .s = "What's your name? ", .n = 18 };
+  opaque_t intf8;
+  const seg_t str11 = { .s = "stream,in:std", .n = 13 };
+  opaque_t intf12;
+  const seg_t str15 = { .s = "", .n = 0 };
+  opaque_t intf16, intf19;
+  seg_t str20;
+  const seg_t str22 = { .s = "Hello ", .n = 6 };
+  const seg_t str24 = { .s = "!\n", .n = 2 };
+  opaque_t intf26;
+
+entry: {
+  symbol_t sym2 = __primitive_open_yySo(sym1, str3, &intf4);
+  symbol_t sym5 = __primitive_write_yyoso(sym2, intf4, str6, &intf8);
+  symbol_t sym9 = __primitive_close_yyo(sym5, intf8);
+  symbol_t sym10 = __primitive_open_yyso(sym9, str11, &intf12);
+  symbol_t sym13 = io_getline__loop(sym10, intf12, str15, &intf16, &str20);
+  symbol_t sym17 = __primitive_close_yyo(sym13, intf16);
+  symbol_t sym18 = __primitive_open_yyso(sym17, str3, &intf19);
+  seg_t str21 = __primitive_strcat_sss(str22, str20);
+  seg_t str23 = __primitive_strcat_sss(str21, str24);
+  symbol_t sym25 = __primitive_write_yyoso(sym18, intf19, str23, &intf26);
+  symbol_t sym27 = __primitive_close_yyo(sym25, intf26);
+  return sym27;
+}
+} // end tests_hello
+
+symbol_t io_getline__loop(symbol_t sym3, opaque_t intf2, seg_t str1, opaque_t *out_intf0, seg_t *out_str1)
+{
+  symbol_t sym4;
+  seg_t str5, str6;
+  const seg_t str7 = { .s = "\n", .n = 1 };
+  opaque_t intf8;
+  seg_t str9;
+  opaque_t intf12;
+  symbol_t sym16;
+  const seg_t str17 = { .s = "", .n = 0 };
+  symbol_t sym18, sym21;
+  opaque_t intf28;
+  seg_t str35;
+  const mem_mark_t mark = mem_mark();
+
+entry: {
+  sym4 = __primitive_read_yyooS(sym3, intf2, &intf8, &str5);
+  if(__primitive_strsplit_sSsS(str5, str7, &str6, &str9)) {
+    goto block15;
+  }
+  seg_t str10 = __primitive_strcat_sss(str1, str9);
+  symbol_t sym11 = __primitive_unread_yyoso(sym4, intf8, str10, &intf12);
+  if(out_intf0) *out_intf0 = intf12;
+  if(out_str1) *out_str1 = str6;
+  return sym11;
+}
+
+block15: {
+  sym16 = __primitive_eq_str_ySs(str5, str17);
+  sym18 = __primitive_not_yy(sym16);
+  if(!sym18) { // assert
+    goto block42;
+  }
+  seg_t str20 = __primitive_strcat_sSs(str1, str5);
+  sym21 = io_getline__loop(sym4, intf8, str20, &intf28, &str35);
+  if(!sym16) { // assert
+    goto block42;
+  }
+  if(out_intf0) *out_intf0 = intf28;
+  if(out_str1) *out_str1 = str35;
+  return sym21;
+}
+
+block42: {
+  if(out_intf0) *out_intf0 = intf8;
+  if(out_str1) *out_str1 = str1;
+  return sym4;
+}
+} // end io_getline__loop
+
+MAIN(tests_hello)
@@ -0,0 +1,2099 @@
+	.file	"tests_hello.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "poprc_out/tests_hello.c"
+	.section	.rodata
+.LC0:
+	.string	""
+	.text
+	.globl	tests_hello
+	.type	tests_hello, @function
+tests_hello:
+.LFB0:
+	.file 1 "poprc_out/tests_hello.c"
+	.loc 1 7 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$176, %rsp
+	movl	%edi, -164(%rbp)
+	.loc 1 14 15
+	leaq	.LC0(%rip), %rax
+	movq	%rax, -80(%rbp)
+	movq	$0, -72(%rbp)
+.L2:
+.LBB2:
+	.loc 1 22 19
+	leaq	-48(%rbp), %rcx
+	movq	str3.0(%rip), %rsi
+	movq	8+str3.0(%rip), %rdx
+	movl	-164(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_open_yyso@PLT
+	movl	%eax, -4(%rbp)
+	.loc 1 23 19
+	movq	-48(%rbp), %rsi
+	leaq	-56(%rbp), %rcx
+	movq	str6.1(%rip), %rax
+	movq	8+str6.1(%rip), %rdx
+	movl	-4(%rbp), %edi
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_write_yyoso@PLT
+	movl	%eax, -8(%rbp)
+	.loc 1 24 19
+	movq	-56(%rbp), %rdx
+	movl	-8(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -12(%rbp)
+	.loc 1 25 20
+	leaq	-64(%rbp), %rcx
+	movq	str11.2(%rip), %rsi
+	movq	8+str11.2(%rip), %rdx
+	movl	-12(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_open_yyso@PLT
+	movl	%eax, -16(%rbp)
+	.loc 1 26 20
+	movq	-64(%rbp), %rsi
+	leaq	-112(%rbp), %r8
+	leaq	-88(%rbp), %rcx
+	movq	-80(%rbp), %rax
+	movq	-72(%rbp), %rdx
+	movl	-16(%rbp), %edi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	io_getline__loop
+	movl	%eax, -20(%rbp)
+	.loc 1 27 20
+	movq	-88(%rbp), %rdx
+	movl	-20(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -24(%rbp)
+	.loc 1 28 20
+	leaq	-96(%rbp), %rcx
+	movq	str3.0(%rip), %rsi
+	movq	8+str3.0(%rip), %rdx
+	movl	-24(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_open_yyso@PLT
+	movl	%eax, -28(%rbp)
+	.loc 1 29 17
+	movq	-112(%rbp), %rax
+	movq	-104(%rbp), %rdx
+	movq	str22.3(%rip), %rdi
+	movq	8+str22.3(%rip), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -144(%rbp)
+	movq	%rdx, -136(%rbp)
+	.loc 1 30 17
+	movq	str24.4(%rip), %rax
+	movq	8+str24.4(%rip), %rdx
+	movq	-144(%rbp), %rdi
+	movq	-136(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -160(%rbp)
+	movq	%rdx, -152(%rbp)
+	.loc 1 31 20
+	movq	-96(%rbp), %rsi
+	leaq	-120(%rbp), %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movl	-28(%rbp), %edi
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_write_yyoso@PLT
+	movl	%eax, -32(%rbp)
+	.loc 1 32 20
+	movq	-120(%rbp), %rdx
+	movl	-32(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	__primitive_close_yyo@PLT
+	movl	%eax, -36(%rbp)
+	.loc 1 33 10
+	movl	-36(%rbp), %eax
+.LBE2:
+	.loc 1 35 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	tests_hello, .-tests_hello
+	.globl	io_getline__loop
+	.type	io_getline__loop, @function
+io_getline__loop:
+.LFB1:
+	.loc 1 38 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$256, %rsp
+	movl	%edi, -212(%rbp)
+	movq	%rsi, -224(%rbp)
+	movq	%rdx, -240(%rbp)
+	movq	%rcx, -232(%rbp)
+	movq	%r8, -248(%rbp)
+	movq	%r9, -256(%rbp)
+	.loc 1 46 15
+	leaq	.LC0(%rip), %rax
+	movq	%rax, -128(%rbp)
+	movq	$0, -120(%rbp)
+	.loc 1 50 27
+	movl	$0, %eax
+	call	mem_mark@PLT
+	movq	%rax, -176(%rbp)
+	movq	%rdx, -168(%rbp)
+.L5:
+.LBB3:
+	.loc 1 53 10
+	leaq	-48(%rbp), %rcx
+	leaq	-72(%rbp), %rdx
+	movq	-224(%rbp), %rsi
+	movl	-212(%rbp), %eax
+	movl	%eax, %edi
+	call	__primitive_read_yyoos@PLT
+	movl	%eax, -4(%rbp)
+	.loc 1 54 6
+	leaq	-96(%rbp), %r8
+	leaq	-64(%rbp), %rcx
+	movq	str7.5(%rip), %rax
+	movq	8+str7.5(%rip), %rdx
+	movq	-48(%rbp), %rdi
+	movq	-40(%rbp), %rsi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strsplit_ssss@PLT
+	.loc 1 54 5
+	testb	%al, %al
+	jne	.L21
+	.loc 1 57 17
+	movq	-96(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -192(%rbp)
+	movq	%rdx, -184(%rbp)
+	.loc 1 58 20
+	movq	-72(%rbp), %rsi
+	leaq	-104(%rbp), %rcx
+	movq	-192(%rbp), %rax
+	movq	-184(%rbp), %rdx
+	movl	-4(%rbp), %edi
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_unread_yyoso@PLT
+	movl	%eax, -8(%rbp)
+	.loc 1 59 5
+	cmpq	$0, -248(%rbp)
+	je	.L8
+	.loc 1 59 28 discriminator 1
+	movq	-104(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L8:
+	.loc 1 60 5
+	cmpq	$0, -256(%rbp)
+	je	.L9
+	.loc 1 60 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-64(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L9:
+	.loc 1 61 10
+	movl	-8(%rbp), %eax
+	jmp	.L19
+.L21:
+	.loc 1 55 5
+	nop
+.L7:
+.LBE3:
+.LBB4:
+	.loc 1 65 11
+	movq	-128(%rbp), %rax
+	movq	-120(%rbp), %rdx
+	movq	-48(%rbp), %rdi
+	movq	-40(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_eq_str_yss@PLT
+	movl	%eax, -12(%rbp)
+	.loc 1 66 11
+	cmpl	$0, -12(%rbp)
+	sete	%al
+	.loc 1 66 9
+	movzbl	%al, %eax
+	movl	%eax, -16(%rbp)
+	.loc 1 67 5
+	cmpl	$0, -16(%rbp)
+	je	.L22
+	.loc 1 70 17
+	movq	-48(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	movq	-240(%rbp), %rdi
+	movq	-232(%rbp), %rsi
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	__primitive_strcat_sss@PLT
+	movq	%rax, -208(%rbp)
+	movq	%rdx, -200(%rbp)
+	.loc 1 71 11
+	movq	-72(%rbp), %rsi
+	leaq	-160(%rbp), %r8
+	leaq	-136(%rbp), %rcx
+	movq	-208(%rbp), %rax
+	movq	-200(%rbp), %rdx
+	movl	-4(%rbp), %edi
+	movq	%r8, %r9
+	movq	%rcx, %r8
+	movq	%rdx, %rcx
+	movq	%rax, %rdx
+	call	io_getline__loop
+	movl	%eax, -20(%rbp)
+	.loc 1 72 5
+	cmpl	$0, -12(%rbp)
+	je	.L23
+	.loc 1 75 5
+	cmpq	$0, -248(%rbp)
+	je	.L14
+	.loc 1 75 28 discriminator 1
+	movq	-136(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L14:
+	.loc 1 76 5
+	cmpq	$0, -256(%rbp)
+	je	.L15
+	.loc 1 76 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-160(%rbp), %rax
+	movq	-152(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L15:
+	.loc 1 77 10
+	movl	-20(%rbp), %eax
+	jmp	.L19
+.L22:
+	.loc 1 68 5
+	nop
+	jmp	.L16
+.L23:
+	.loc 1 73 5
+	nop
+.L16:
+.LBE4:
+	.loc 1 81 5
+	cmpq	$0, -248(%rbp)
+	je	.L17
+	.loc 1 81 28 discriminator 1
+	movq	-72(%rbp), %rdx
+	movq	-248(%rbp), %rax
+	movq	%rdx, (%rax)
+.L17:
+	.loc 1 82 5
+	cmpq	$0, -256(%rbp)
+	je	.L18
+	.loc 1 82 26 discriminator 1
+	movq	-256(%rbp), %rcx
+	movq	-240(%rbp), %rax
+	movq	-232(%rbp), %rdx
+	movq	%rax, (%rcx)
+	movq	%rdx, 8(%rcx)
+.L18:
+	.loc 1 83 10
+	movl	-4(%rbp), %eax
+.L19:
+	.loc 1 85 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	io_getline__loop, .-io_getline__loop
+	.section	.rodata
+.LC1:
+	.string	"\033[37;44mERROR\033[0m "
+	.text
+	.globl	main
+	.type	main, @function
+main:
+.LFB2:
+	.loc 1 87 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$224, %rsp
+	movl	%edi, -212(%rbp)
+	movq	%rsi, -224(%rbp)
+	.loc 1 87 1
+	leaq	-208(%rbp), %rax
+	movq	%rax, current_error(%rip)
+	movq	current_error(%rip), %rax
+	movb	$1, 204(%rax)
+	leaq	-208(%rbp), %rax
+	movq	%rax, %rdi
+	call	_setjmp@PLT
+	testl	%eax, %eax
+	je	.L26
+	.loc 1 87 1 is_stmt 0 discriminator 3
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rdi
+	movl	$0, %eax
+	call	printf@PLT
+	movl	$0, %eax
+	call	print_last_log_msg@PLT
+	movl	-8(%rbp), %eax
+	negl	%eax
+	jmp	.L28
+.L26:
+	.loc 1 87 1 discriminator 4
+	movl	$0, %eax
+	call	static_alloc_init@PLT
+	movl	$0, %eax
+	call	log_init@PLT
+	movl	$0, %eax
+	call	io_init@PLT
+	movl	$0, %eax
+	call	init_primitives@PLT
+	movl	$2, %edi
+	call	tests_hello
+	movl	$0, %eax
+.L28:
+	.loc 1 87 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	main, .-main
+	.section	.rodata
+.LC2:
+	.string	"stream,out:std"
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	str3.0, @object
+	.size	str3.0, 16
+str3.0:
+	.quad	.LC2
+	.quad	14
+	.section	.rodata
+.LC3:
+	.string	"What's your name? "
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str6.1, @object
+	.size	str6.1, 16
+str6.1:
+	.quad	.LC3
+	.quad	18
+	.section	.rodata
+.LC4:
+	.string	"stream,in:std"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str11.2, @object
+	.size	str11.2, 16
+str11.2:
+	.quad	.LC4
+	.quad	13
+	.section	.rodata
+.LC5:
+	.string	"Hello "
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str22.3, @object
+	.size	str22.3, 16
+str22.3:
+	.quad	.LC5
+	.quad	6
+	.section	.rodata
+.LC6:
+	.string	"!\n"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str24.4, @object
+	.size	str24.4, 16
+str24.4:
+	.quad	.LC6
+	.quad	2
+	.section	.rodata
+.LC7:
+	.string	"\n"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	str7.5, @object
+	.size	str7.5, 16
+str7.5:
+	.quad	.LC7
+	.quad	1
+	.text
+.Letext0:
+	.file 2 "./startle/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.file 7 "/usr/include/setjmp.h"
+	.file 8 ".gen/startle/error.h"
+	.file 9 ".gen/cgen/primitives.h"
+	.file 10 ".gen/io.h"
+	.file 11 ".gen/startle/log.h"
+	.file 12 ".gen/startle/static_alloc.h"
+	.file 13 "/usr/include/stdio.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7bc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF100
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x5
+	.long	0x6d
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0xd
+	.long	0x6d
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x43
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF11
+	.uleb128 0x5
+	.long	0x74
+	.uleb128 0x12
+	.long	.LASF13
+	.byte	0x10
+	.byte	0x2
+	.byte	0x1f
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x2
+	.byte	0x20
+	.byte	0xf
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x2
+	.byte	0x21
+	.byte	0xa
+	.long	0x79
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x22
+	.byte	0x3
+	.long	0x98
+	.uleb128 0xd
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF14
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF15
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x12
+	.long	0xe7
+	.uleb128 0xe
+	.long	0x5f
+	.long	0xf7
+	.uleb128 0xf
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x10
+	.byte	0x80
+	.byte	0x5
+	.byte	0x5
+	.long	0x10d
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0x10d
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x43
+	.long	0x11d
+	.uleb128 0xf
+	.long	0x43
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x8
+	.byte	0x3
+	.long	0xf7
+	.uleb128 0x12
+	.long	.LASF19
+	.byte	0xc8
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x8
+	.long	0x15e
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x20
+	.byte	0xf
+	.long	0xdb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x21
+	.byte	0x9
+	.long	0x58
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x22
+	.byte	0x10
+	.long	0x11d
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x20
+	.byte	0x1e
+	.long	0x16a
+	.uleb128 0xe
+	.long	0x129
+	.long	0x17a
+	.uleb128 0xf
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x8
+	.byte	0x8
+	.byte	0x6
+	.long	0x19f
+	.uleb128 0x11
+	.long	.LASF24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF25
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF26
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x8
+	.byte	0xe
+	.byte	0x1b
+	.long	0x17a
+	.uleb128 0x10
+	.byte	0xd0
+	.byte	0x8
+	.byte	0x10
+	.long	0x1db
+	.uleb128 0xb
+	.string	"env"
+	.byte	0x8
+	.byte	0x11
+	.byte	0xb
+	.long	0x15e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x12
+	.byte	0x10
+	.long	0x19f
+	.byte	0xc8
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x13
+	.byte	0x8
+	.long	0xcd
+	.byte	0xcc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x14
+	.byte	0x2
+	.long	0x1ab
+	.uleb128 0x19
+	.long	.LASF102
+	.byte	0x8
+	.byte	0x15
+	.byte	0x1e
+	.long	0x1f3
+	.uleb128 0x5
+	.long	0x1db
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x3
+	.byte	0xd
+	.long	0x58
+	.uleb128 0x5
+	.long	0x58
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x9
+	.byte	0x51
+	.long	0x22c
+	.uleb128 0xb
+	.string	"mem"
+	.byte	0x9
+	.byte	0x52
+	.byte	0x8
+	.long	0x204
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x53
+	.byte	0x9
+	.long	0x68
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x54
+	.byte	0x2
+	.long	0x209
+	.uleb128 0xd
+	.long	0x22c
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x62
+	.byte	0xf
+	.long	0x66
+	.uleb128 0xa
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x61
+	.long	0x256
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF36
+	.byte	0xa
+	.byte	0x15
+	.long	0x263
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF37
+	.byte	0xb
+	.byte	0x74
+	.long	0x270
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF38
+	.byte	0xc
+	.byte	0x7
+	.long	0x27d
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF39
+	.byte	0xb
+	.byte	0x6a
+	.long	0x28a
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF40
+	.byte	0xd
+	.value	0x164
+	.byte	0xc
+	.long	0x58
+	.long	0x2a2
+	.uleb128 0x2
+	.long	0x93
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xc
+	.long	0x58
+	.long	0x2b8
+	.uleb128 0x2
+	.long	0x2b8
+	.byte	0
+	.uleb128 0x5
+	.long	0x129
+	.uleb128 0x6
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xa
+	.long	0x1f8
+	.long	0x2d8
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x4
+	.byte	0xa
+	.long	0x1f8
+	.long	0x2fd
+	.uleb128 0x2
+	.long	0x1f8
+	.uleb128 0x2
+	.long	0x66
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0x2fd
+	.byte	0
+	.uleb128 0x5
+	.long	0x66
+	.uleb128 0x6
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x17
+	.byte	0x6
+	.long	0xcd
+	.long	0x327
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0x327
+	.uleb128 0x2
+	.long	0x327
+	.byte	0
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x6
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x19
+	.byte	0xa
+	.long	0x1f8
+	.long	0x351
+	.uleb128 0x2
+	.long	0x1f8
+	.uleb128 0x2
+	.long	0x66
+	.uleb128 0x2
+	.long	0x2fd
+	.uleb128 0x2
+	.long	0x327
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF103
+	.byte	0x9
+	.byte	0x5a
+	.byte	0xc
+	.long	0x22c
+	.long	0x363
+	.uleb128 0x9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x13
+	.byte	0x7
+	.long	0xbc
+	.long	0x37e
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x6
+	.byte	0xa
+	.long	0x1f8
+	.long	0x399
+	.uleb128 0x2
+	.long	0x1f8
+	.uleb128 0x2
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x5
+	.byte	0xa
+	.long	0x1f8
+	.long	0x3be
+	.uleb128 0x2
+	.long	0x1f8
+	.uleb128 0x2
+	.long	0x66
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0x2fd
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x15
+	.byte	0xa
+	.long	0x1f8
+	.long	0x3de
+	.uleb128 0x2
+	.long	0x1f8
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0x2fd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF52
+	.byte	0x57
+	.byte	0x1
+	.long	0x58
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x42d
+	.uleb128 0x7
+	.long	.LASF50
+	.byte	0x57
+	.byte	0x1
+	.long	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -228
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x57
+	.byte	0x1
+	.long	0x42d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x57
+	.byte	0x1
+	.long	0x1db
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0x5
+	.long	0x68
+	.uleb128 0x13
+	.long	.LASF53
+	.byte	0x25
+	.byte	0xa
+	.long	0x1f8
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f0
+	.uleb128 0x7
+	.long	.LASF54
+	.byte	0x25
+	.byte	0x24
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -228
+	.uleb128 0x7
+	.long	.LASF55
+	.byte	0x25
+	.byte	0x33
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x7
+	.long	.LASF56
+	.byte	0x25
+	.byte	0x40
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x7
+	.long	.LASF57
+	.byte	0x25
+	.byte	0x50
+	.long	0x5f0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x25
+	.byte	0x62
+	.long	0x327
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x27
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x28
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x28
+	.byte	0xf
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x29
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str7.5
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x2a
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x2b
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x2c
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x2d
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x2e
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x2f
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x2f
+	.byte	0x13
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x30
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x31
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x32
+	.byte	0x14
+	.long	0x238
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0xc
+	.long	.LASF74
+	.byte	0x34
+	.quad	.L5
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x40
+	.quad	.L7
+	.uleb128 0xc
+	.long	.LASF76
+	.byte	0x50
+	.quad	.L16
+	.uleb128 0x1c
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.long	0x5ce
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x39
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x3a
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x14
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x46
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x23d
+	.uleb128 0x1d
+	.long	.LASF104
+	.byte	0x1
+	.byte	0x6
+	.byte	0xa
+	.long	0x1f8
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x7
+	.long	.LASF80
+	.byte	0x6
+	.byte	0x1f
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x8
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str3.0
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x9
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xa
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str6.1
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xb
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xc
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str11.2
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xd
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xe
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xf
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xf
+	.byte	0x14
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x10
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x11
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str22.3
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x12
+	.byte	0xf
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	str24.4
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x13
+	.byte	0xc
+	.long	0x23d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0xc
+	.long	.LASF74
+	.byte	0x15
+	.quad	.L2
+	.uleb128 0x14
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x16
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x17
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x18
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0x19
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x1a
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x1b
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x1c
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0x1d
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0x1e
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0x1f
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0x20
+	.byte	0xc
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF38:
+	.string	"static_alloc_init"
+.LASF42:
+	.string	"__primitive_eq_str_yss"
+.LASF77:
+	.string	"str10"
+.LASF83:
+	.string	"str11"
+.LASF32:
+	.string	"strings"
+.LASF84:
+	.string	"str15"
+.LASF68:
+	.string	"str17"
+.LASF39:
+	.string	"print_last_log_msg"
+.LASF35:
+	.string	"init_primitives"
+.LASF50:
+	.string	"argc"
+.LASF48:
+	.string	"__primitive_write_yyoso"
+.LASF37:
+	.string	"log_init"
+.LASF52:
+	.string	"main"
+.LASF16:
+	.string	"__jmp_buf"
+.LASF79:
+	.string	"str20"
+.LASF41:
+	.string	"_setjmp"
+.LASF10:
+	.string	"long long int"
+.LASF70:
+	.string	"sym21"
+.LASF104:
+	.string	"tests_hello"
+.LASF88:
+	.string	"str24"
+.LASF98:
+	.string	"sym25"
+.LASF56:
+	.string	"str1"
+.LASF99:
+	.string	"sym27"
+.LASF81:
+	.string	"str3"
+.LASF7:
+	.string	"short int"
+.LASF61:
+	.string	"str5"
+.LASF62:
+	.string	"str6"
+.LASF63:
+	.string	"str7"
+.LASF66:
+	.string	"intf12"
+.LASF65:
+	.string	"str9"
+.LASF85:
+	.string	"intf16"
+.LASF86:
+	.string	"intf19"
+.LASF30:
+	.string	"error_t"
+.LASF47:
+	.string	"__primitive_close_yyo"
+.LASF80:
+	.string	"sym1"
+.LASF90:
+	.string	"sym2"
+.LASF54:
+	.string	"sym3"
+.LASF60:
+	.string	"sym4"
+.LASF91:
+	.string	"sym5"
+.LASF96:
+	.string	"str21"
+.LASF87:
+	.string	"str22"
+.LASF97:
+	.string	"str23"
+.LASF92:
+	.string	"sym9"
+.LASF28:
+	.string	"type"
+.LASF20:
+	.string	"__jmpbuf"
+.LASF8:
+	.string	"long int"
+.LASF55:
+	.string	"intf2"
+.LASF103:
+	.string	"mem_mark"
+.LASF53:
+	.string	"io_getline__loop"
+.LASF102:
+	.string	"current_error"
+.LASF27:
+	.string	"error_type_t"
+.LASF74:
+	.string	"entry"
+.LASF11:
+	.string	"long double"
+.LASF26:
+	.string	"ERROR_TYPE_LIMITATION"
+.LASF2:
+	.string	"unsigned char"
+.LASF89:
+	.string	"intf26"
+.LASF71:
+	.string	"intf28"
+.LASF36:
+	.string	"io_init"
+.LASF33:
+	.string	"mem_mark_t"
+.LASF6:
+	.string	"signed char"
+.LASF44:
+	.string	"__primitive_strsplit_ssss"
+.LASF73:
+	.string	"mark"
+.LASF4:
+	.string	"unsigned int"
+.LASF59:
+	.string	"error"
+.LASF31:
+	.string	"symbol_t"
+.LASF57:
+	.string	"out_intf0"
+.LASF51:
+	.string	"argv"
+.LASF19:
+	.string	"__jmp_buf_tag"
+.LASF3:
+	.string	"short unsigned int"
+.LASF46:
+	.string	"__primitive_strcat_sss"
+.LASF34:
+	.string	"opaque_t"
+.LASF9:
+	.string	"char"
+.LASF40:
+	.string	"printf"
+.LASF75:
+	.string	"block15"
+.LASF22:
+	.string	"__saved_mask"
+.LASF21:
+	.string	"__mask_was_saved"
+.LASF12:
+	.string	"size_t"
+.LASF82:
+	.string	"intf4"
+.LASF14:
+	.string	"_Bool"
+.LASF45:
+	.string	"__primitive_read_yyoos"
+.LASF25:
+	.string	"ERROR_TYPE_UNEXPECTED"
+.LASF64:
+	.string	"intf8"
+.LASF72:
+	.string	"str35"
+.LASF17:
+	.string	"__val"
+.LASF5:
+	.string	"long unsigned int"
+.LASF15:
+	.string	"double"
+.LASF29:
+	.string	"quiet"
+.LASF43:
+	.string	"__primitive_unread_yyoso"
+.LASF58:
+	.string	"out_str1"
+.LASF49:
+	.string	"__primitive_open_yyso"
+.LASF76:
+	.string	"block42"
+.LASF93:
+	.string	"sym10"
+.LASF78:
+	.string	"sym11"
+.LASF94:
+	.string	"sym13"
+.LASF67:
+	.string	"sym16"
+.LASF95:
+	.string	"sym17"
+.LASF69:
+	.string	"sym18"
+.LASF24:
+	.string	"ERROR_TYPE_NONE"
+.LASF100:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"seg_t"
+.LASF101:
+	.string	"error_type_e"
+.LASF23:
+	.string	"jmp_buf"
+.LASF18:
+	.string	"__sigset_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"poprc_out/tests_hello.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1131 @@
+#include "cgen/main.h"
+
+double tests_quadratic(any_t any3, any_t any2, any_t any1);
+array list_dropl_cl_iterate(array lst2, int int1);
+array list_dropl_cl_iterate(array lst2, int int1);
+array list_dropl_cl_iterate(array lst2, int int1);
+
+double tests_quadratic(any_t any3, any_t any2, any_t any1)
+{
+  array lst4, lst5;
+  const int int6 = 1;
+  const int int8 = 0;
+  array lst9;
+  const int int10 = 2;
+  double flt12, flt13;
+  const double flt14 = [37;44mBREAKPOINT[0m [37;41m!!![0m gen/cgen.c:210: gen_value_rhs: Assertion `false' failed:  [38;5;8mjmatp[0m
+[37;44mERROR[0m [37;41m!!![0m gen/cgen.c:210: gen_value_rhs: Assertion `false' failed:  [38;5;8mjmatp[0m
+ir/trace.c:1495: branch 0: 7682
+  list.c:97: list: 7682
+    primitive/core.c:394: ap: 7685
+      primitive/core.c:394: ap: 7688
+        special.c:74: value: 7684
+[37;44mBREAKPOINT[0m [37;41m!!![0m rt.c:691: arg: Assertion `!closure_is_ready(c)' failed:  [38;5;8majgxq[0m
+[37;44mERROR[0m [37;41m!!![0m rt.c:691: arg: Assertion `!closure_is_ready(c)' failed:  [38;5;8majgxq[0m
+  - while compiling stack.pull4 (427)
+
+Exiting on error.
+
+___ LOG ___
+ir/trace.c:1495: branch 1: 9588
+  list.c:97: list: 9588
+    ir/trace.c:967: trace_partial unless, arg[1] = 9599 [38;5;8ml35fl[0m
+      ir/trace.c:811: trace_alloc foldr:iterate[12] size = 2 [38;5;8mbgx3x[0m
+    special.c:74: value: 9571
+      special.c:124: expected 9571 to be True, but got False [38;5;8movj7m[0m
+    ir/trace.c:1259: updated var 9571 (foldr:iterate[12]) to T_SYMBOL[0, 0] [38;5;8mbnnw5[0m
+    ir/trace.c:1259: updated var 9571 (foldr:iterate[0]) to T_SYMBOL[0, 0] [38;5;8mo594q[0m
+primitive/core.c:114: symbolic assert fail 9582 [38;5;8memhno[0m
+rt.c:457: [37;41mFAIL[0m: assert 9583 (__primitive.assert) primitive/core.c:115 [37;44m@abort[0m [38;5;8mmn66x[0m
+rt.c:457: [37;41mFAIL[0m: id 9584 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8mj6pam[0m
+rt.c:457: [37;41mFAIL[0m: dep 9587 (__primitive.dep) special.c:439 [37;44m@abort[0m [38;5;8mewije[0m
+ir/trace.c:1491: priority = 4
+  ir/trace.c:1495: branch 1: 9555
+    list.c:97: list: 9555
+      special.c:429: dep: 9557
+        primitive/core.c:394: ap: 9552
+          primitive/core.c:293: id: 9551
+            primitive/core.c:101: assert: 9550
+              primitive/arithmetic.c:274: op1: 9549
+                primitive/core.c:153: seq: 9548
+                  primitive/core.c:293: id: 9538
+                    primitive/core.c:231: unless: 9535
+                      primitive/core.c:233: delay (priority 4) 9535 [38;5;8mniurh[0m
+      list.c:164: log_ptrs for 9555 [38;5;8maedji[0m
+        list.c:170: ptr[0] = 9557 (skip delayed) [37;44m#abort[0m [38;5;8mk4rto[0m
+ir/trace.c:1491: priority = 5
+  ir/trace.c:1495: branch 1: 9555
+    list.c:97: list: 9555
+      special.c:429: dep: 9557
+        primitive/core.c:394: ap: 9552
+          primitive/core.c:293: id: 9551
+            primitive/core.c:101: assert: 9550
+              primitive/arithmetic.c:274: op1: 9549
+                primitive/core.c:153: seq: 9548
+                  primitive/core.c:293: id: 9538
+                    primitive/core.c:231: unless: 9535
+                      ir/trace.c:967: trace_partial unless, arg[1] = 9593 [38;5;8miwprl[0m
+                        ir/trace.c:811: trace_alloc foldr:iterate[13] size = 2 [38;5;8modmfx[0m
+                      ir/trace.c:1259: updated var 9536 (foldr:iterate[13]) to T_SYMBOL[0, 0] [38;5;8ma5p9g[0m
+                ir/trace.c:1259: updated var X (foldr:iterate[13]) to T_SYMBOL[0, 1] [38;5;8mglxse[0m
+                ir/trace.c:1259: updated var X (foldr:iterate[0]) to T_SYMBOL[0, 1] [38;5;8md4jv3[0m
+              var.c:211: copy condition in foldr:iterate: 13 -> 13 [38;5;8mouc8r[0m
+          primitive/core.c:518: removing type from ???, res = 9640 #type [38;5;8moxn7d[0m
+      primitive/core.c:293: id: 9557
+        primitive/core.c:153: seq: 9641
+          var.c:211: copy condition in foldr:iterate: 13 -> 13 [38;5;8mg6ok8[0m
+          var.c:211: copy condition in foldr:iterate: 13 -> 13 [38;5;8mmjk9k[0m
+          var.c:232: condition foldr:iterate 13 ... 13 unless arg <- 7 [38;5;8mbwhtw[0m
+      list.c:164: log_ptrs for 9555 [38;5;8mmqa6o[0m
+        list.c:168: ptr[0] = 9557 [38;5;8mhgpgu[0m
+    ir/trace.c:811: trace_alloc foldr:iterate[14] size = 3 [38;5;8mj8tad[0m
+    ir/trace.c:1472: trace_return: foldr:iterate[14] <- 9555 [38;5;8mplpup[0m
+    ir/trace.c:1534: branch 1 finished 9555 [38;5;8me2mi5[0m
+user_func.c:656: flat call 9502 (foldr -> foldr:iterate)
+  user_func.c:682: arg[2] -> foldr[2] [38;5;8mkit53[0m
+  user_func.c:682: arg[1] -> foldr[3] [38;5;8mckjlc[0m
+  user_func.c:682: arg[0] -> foldr[1] [38;5;8mkl84l[0m
+ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in foldr:iterate [38;5;8mp25ox[0m
+ir/compile.c:246: drop foldr:iterate[4] seq [38;5;8mff2dd[0m
+ir/compile.c:246: drop foldr:iterate[12] unless [38;5;8mksuxp[0m
+ir/compile.c:292: move var 1 -> 2 [38;5;8mp9rl5[0m
+ir/compile.c:302: collapse 4 [38;5;8mibg5e[0m
+ir/compile.c:292: move var 6 -> 3 [38;5;8mcxvfk[0m
+ir/compile.c:292: move var 7 -> 1 [38;5;8mk3kut[0m
+ir/compile.c:302: collapse 12 [38;5;8mc5ad6[0m
+ir/analysis.c:519: calculate_bit_width (null).(null)(8506) [38;5;8mnrooc[0m
+ir/analysis.c:519: calculate_bit_width (null).(null)(8506) [38;5;8mih62i[0m
+ir/trace.c:811: trace_alloc foldr[4] size = 4 [38;5;8mc8lco[0m
+user_func.c:737: wrap_vars 1 9650 [38;5;8milhw4[0m
+ir/trace.c:889: trace_store_expr: foldr[4] <- exec 9645 9649 [38;5;8mam7gd[0m
+primitive/core.c:153: seq: 9652
+  primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9652 [38;5;8mn84ik[0m
+list.c:164: log_ptrs for 9495 [38;5;8maw8b3[0m
+  list.c:168: ptr[0] = 9649 [38;5;8mlnml9[0m
+ir/trace.c:811: trace_alloc foldr[5] size = 3 [38;5;8mofqfo[0m
+ir/trace.c:1472: trace_return: foldr[5] <- 9495 [38;5;8mdsm34[0m
+ir/trace.c:1534: branch 0 finished 9495 [38;5;8mi9jog[0m
+ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in foldr [38;5;8mjcum2[0m
+ir/analysis.c:519: calculate_bit_width list.foldr(314) [38;5;8moprbe[0m
+ir/analysis.c:519: calculate_bit_width list.foldr(314) [38;5;8mjf9lk[0m
+ir/compile.c:691: compiling scatter [38;5;8mbhu4t[0m
+  ir/trace.c:811: trace_alloc scatter[1] size = 2 [38;5;8ml8de3[0m
+  ir/trace.c:811: trace_alloc scatter[2] size = 2 [38;5;8mbk93f[0m
+  ir/trace.c:1485: trace_reduce scatter 9679
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 9679
+        list.c:97: list: 9679
+          user_func.c:1118: exec: 9682 foldr:iterate
+            rt.c:490: simplify 9670
+              special.c:74: value: 9680
+                special.c:89: delay (priority 0) 9680 [38;5;8mjwwee[0m
+            user_func.c:1108: not dynamic: 9682 foldr:iterate arg[0] = 9674 [38;5;8mmo37t[0m
+            user_func.c:1146: delay (priority 0) 9682 [38;5;8mpg7xc[0m
+          list.c:164: log_ptrs for 9679 [38;5;8met4lo[0m
+            list.c:170: ptr[0] = 9682 (skip delayed) [37;44m#abort[0m [38;5;8mpkivu[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 9679
+        list.c:97: list: 9679
+          user_func.c:1118: exec: 9682 foldr:iterate
+            rt.c:490: simplify 9680
+              special.c:74: value: 9680
+                special.c:89: delay (priority 0) 9680 [38;5;8mhv9at[0m
+            user_func.c:1108: not dynamic: 9682 foldr:iterate arg[0] = 9674 [38;5;8mkoc4c[0m
+            user_func.c:1146: delay (priority 1) 9682 [38;5;8mnggtr[0m
+          list.c:164: log_ptrs for 9679 [38;5;8mctdh7[0m
+            list.c:170: ptr[0] = 9682 (skip delayed) [37;44m#abort[0m [38;5;8mnjrsd[0m
+    ir/trace.c:1491: priority = 2
+      ir/trace.c:1495: branch 0: 9679
+        list.c:97: list: 9679
+          user_func.c:1118: exec: 9682 foldr:iterate
+            rt.c:490: simplify 9680
+              special.c:74: value: 9680
+                special.c:89: delay (priority 0) 9680 [38;5;8mfvh7c[0m
+            user_func.c:1108: not dynamic: 9682 foldr:iterate arg[0] = 9674 [38;5;8minlwr[0m
+            user_func.c:1146: delay (priority 2) 9682 [38;5;8mlfpqa[0m
+          list.c:164: log_ptrs for 9679 [38;5;8masmem[0m
+            list.c:170: ptr[0] = 9682 (skip delayed) [37;44m#abort[0m [38;5;8mli4os[0m
+    ir/trace.c:1491: priority = 3
+      ir/trace.c:1495: branch 0: 9679
+        list.c:97: list: 9679
+          user_func.c:1118: exec: 9682 foldr:iterate
+            rt.c:490: simplify 9680
+              special.c:74: value: 9680
+                special.c:89: delay (priority 0) 9680 [38;5;8mduq3r[0m
+            user_func.c:1108: not dynamic: 9682 foldr:iterate arg[0] = 9674 [38;5;8mgmuta[0m
+            user_func.c:1146: delay (priority 3) 9682 [38;5;8mje2mp[0m
+          list.c:164: log_ptrs for 9679 [38;5;8morva5[0m
+            list.c:170: ptr[0] = 9682 (skip delayed) [37;44m#abort[0m [38;5;8mjidlb[0m
+    ir/trace.c:1491: priority = 4
+      ir/trace.c:1495: branch 0: 9679
+        list.c:97: list: 9679
+          user_func.c:1118: exec: 9682 foldr:iterate
+            rt.c:490: simplify 9680
+              special.c:74: value: 9680
+                special.c:89: delay (priority 0) 9680 [38;5;8mbt3wa[0m
+            user_func.c:1108: not dynamic: 9682 foldr:iterate arg[0] = 9674 [38;5;8mel7pp[0m
+            user_func.c:800: exec_specialize: 9682 foldr:iterate 0x0 #specialize
+              user_func.c:839: created entry for scatter:foldr:iterate [38;5;8mmq77k[0m
+              ir/compile.c:730: barrier scatter:foldr:iterate 9686[0]: 9674 [37;44m#barrier[0m [38;5;8mhhmhq[0m
+              ir/compile.c:730: barrier scatter:foldr:iterate 9686[1]: 9680 [37;44m#barrier[0m [38;5;8mj9qa9[0m
+              ir/trace.c:711: switch_entry scatter:foldr:iterate 9680
+                ir/trace.c:811: trace_alloc scatter:foldr:iterate[1] size = 2 [38;5;8me3jjx[0m
+                ir/trace.c:729: switch scatter[1] <- ??? from scatter[1] [38;5;8mkgf8d[0m
+              ir/compile.c:730: barrier scatter:foldr:iterate 9686[2]: 9675 [37;44m#barrier[0m [38;5;8mm8jxs[0m
+              rt.c:490: simplify 9680
+                special.c:74: value: 9680
+                  special.c:89: delay (priority 0) 9680 [38;5;8mfdkfn[0m
+              rt.c:490: simplify 9675
+                special.c:74: value: 9675
+                  special.c:166: nil 9675 [38;5;8mnikti[0m
+                  ir/trace.c:811: trace_alloc scatter[3] size = 2 [38;5;8mh827o[0m
+                  ir/trace.c:811: trace_alloc scatter:foldr:iterate[2] size = 2 [38;5;8mnlvr4[0m
+                  ir/trace.c:729: switch scatter[3] <- ??? from scatter[3] [38;5;8mc2sgg[0m
+              user_func.c:442: exec_expand foldr:iterate: 9686 0x0
+                user_func.c:538: replaced self call 9686 list.foldr:iterate(320) -> (null).(null)(8525) [38;5;8mii33e[0m
+                rt.c:927: allocated alt ids 0...0 [38;5;8mnvwnq[0m
+              ir/trace.c:1485: trace_reduce scatter:foldr:iterate 9687
+                ir/trace.c:1491: priority = 0
+                  ir/trace.c:1495: branch 0: 9687
+                    list.c:97: list: 9687
+                      primitive/core.c:293: id: 9695
+                        primitive/core.c:153: seq: 9690
+                          special.c:429: dep: 9689
+                            primitive/core.c:394: ap: 9688
+                              special.c:74: value: 9680
+                                special.c:89: delay (priority 0) 9680 [38;5;8mlojm5[0m
+                          user_func.c:1118: exec: 9693 scatter:foldr:iterate
+                            ir/trace.c:1709: delay branch 9687 3 [38;5;8mdtj4w[0m
+                            user_func.c:1131: delay (priority 0) 9693 [38;5;8mlu9j9[0m
+                      list.c:164: log_ptrs for 9687 [38;5;8ml2kir[0m
+                        list.c:170: ptr[0] = 9695 (skip delayed) [37;44m#abort[0m [38;5;8mgo2sx[0m
+                  ir/trace.c:1495: branch 0: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          special.c:429: dep: 9689
+                            primitive/core.c:394: ap: 9688
+                              special.c:74: value: 9680
+                                special.c:89: delay (priority 0) 9680 [38;5;8mmfwc3[0m
+                          special.c:74: value: 9675
+                            special.c:89: delay (priority 0) 9675 [38;5;8mg9plr[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8mhc4kd[0m
+                        list.c:170: ptr[0] = 9696 (skip delayed) [37;44m#abort[0m [38;5;8mb3iuj[0m
+                ir/trace.c:1491: priority = 1
+                  ir/trace.c:1495: branch 0: 9687
+                    list.c:97: list: 9687
+                      list.c:99: delay (priority 1) 9687 [38;5;8mmwm5t[0m
+                  ir/trace.c:1495: branch 0: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          primitive/core.c:233: delay (priority 1) 9694 [38;5;8mhtrc7[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8mklu6m[0m
+                        list.c:170: ptr[0] = 9696 (skip delayed) [37;44m#abort[0m [38;5;8mfcdgs[0m
+                ir/trace.c:1491: priority = 2
+                  ir/trace.c:1495: branch 0: 9687
+                    list.c:97: list: 9687
+                      list.c:99: delay (priority 2) 9687 [38;5;8mp9hn6[0m
+                  ir/trace.c:1495: branch 0: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          primitive/core.c:233: delay (priority 2) 9694 [38;5;8mk6lvg[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8mnupov[0m
+                        list.c:170: ptr[0] = 9696 (skip delayed) [37;44m#abort[0m [38;5;8mik725[0m
+                ir/trace.c:1491: priority = 3
+                  ir/trace.c:1495: branch 0: 9687
+                    list.c:97: list: 9687
+                      primitive/core.c:293: id: 9695
+                        primitive/core.c:153: seq: 9690
+                          special.c:429: dep: 9689
+                            primitive/core.c:394: ap: 9688
+                              special.c:74: value: 9680
+                                var.c:80: var_create_list 9680 9698 0 1 0 0 [38;5;8mgdq2g[0m
+                          primitive/core.c:153: seq: 9702
+                            special.c:429: dep: 9700
+                              special.c:466: placeholder: 9699
+                                ir/trace.c:811: trace_alloc scatter:foldr:iterate[3] size = 2 [38;5;8mlxdjw[0m
+                                ir/trace.c:889: trace_store_expr: scatter:foldr:iterate[3] <- placeholder 9699 9703 [38;5;8mbd98c[0m
+                                ir/trace.c:1259: updated var 9703 (scatter:foldr:iterate[3]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mossbx[0m
+                              ir/trace.c:811: trace_alloc scatter:foldr:iterate[4] size = 1 [38;5;8mjmlkp[0m
+                              ir/trace.c:1132: trace_dep: 4 <- 9700 3[1] [38;5;8mo3h85[0m
+                          ir/trace.c:967: trace_partial seq, arg[1] = 9702 [38;5;8mmh4cq[0m
+                            ir/trace.c:811: trace_alloc scatter:foldr:iterate[5] size = 2 [38;5;8mbuww6[0m
+                          user_func.c:1118: exec: 9693 scatter:foldr:iterate
+                            ir/trace.c:1709: delay branch 9687 3 [38;5;8mmop9u[0m
+                            user_func.c:320: unify_exec: 9693 #specialize
+                              user_func.c:155: bind_pattern null 9688 9680 [37;44m@barrier[0m
+                                user_func.c:175: bound scatter:foldr:iterate[1] = 9688 [38;5;8metqnp[0m
+                              rt.c:490: simplify 9692
+                                primitive/core.c:153: seq: 9707
+                                  primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9707 [38;5;8mm2q5k[0m
+                                primitive/core.c:394: compose: 9708
+                                  special.c:74: value: 9675
+                                    special.c:89: delay (priority 0) 9675 [38;5;8mci2oi[0m
+                              user_func.c:155: bind_pattern null 9708 9675 [37;44m@barrier[0m
+                                user_func.c:175: bound scatter:foldr:iterate[2] = 9708 [38;5;8mh3abg[0m
+                              user_func.c:155: bind_pattern null 9688 9680 [37;44m@barrier[0m
+                                user_func.c:175: bound scatter:foldr:iterate[1] = 9688 [38;5;8mp8apb[0m
+                              user_func.c:155: bind_pattern null 9708 9675 [37;44m@barrier[0m
+                                user_func.c:175: bound scatter:foldr:iterate[2] = 9708 [38;5;8mida66[0m
+                              user_func.c:379: unified scatter:foldr:iterate 9693 with initial 9682 [38;5;8mk5ewl[0m
+                            user_func.c:972: exec_trace: 9711 scatter:foldr:iterate 0x60
+                              user_func.c:624: reassign input order 9686 (scatter -> scatter:foldr:iterate)
+                                user_func.c:608: remove var 9681 [38;5;8minb2s[0m
+                              primitive/core.c:394: compose: 9708
+                                var.c:80: var_create_list 9675 9712 0 0 0 1 [38;5;8miqmxe[0m
+                                rt.c:622: composing rows 9709 9712 [38;5;8mf8843[0m
+                              user_func.c:1025: [37;41mHACK[0m forced cells[9711].expr.arg[0] [38;5;8mll5pf[0m
+                              list.c:97: list: 9708
+                                special.c:466: placeholder: 9713
+                                  ir/trace.c:1259: updated var 9715 (scatter:foldr:iterate[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mi4ns4[0m
+                                primitive/core.c:394: compose: 9709
+                                  var.c:80: var_create_list 9702 9716 0 0 0 1 [38;5;8mlv6k5[0m
+                                  rt.c:622: composing rows 9671 9716 [38;5;8mjeooq[0m
+                                list.c:164: log_ptrs for 9708 [38;5;8morlc6[0m
+                                  list.c:168: ptr[0] = 9713 [38;5;8mjh3nc[0m
+                                  list.c:168: ptr[1] = 9709 [38;5;8mbjo6l[0m
+                                list.c:97: list: 9709
+                                  special.c:466: placeholder: 9717
+                                    ir/trace.c:1259: updated var 9719 (scatter:foldr:iterate[4]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mmdifd[0m
+                                  list.c:164: log_ptrs for 9709 [38;5;8mg7bn5[0m
+                                    list.c:168: ptr[0] = 9717 [38;5;8mbtp2b[0m
+                                    list.c:168: ptr[1] = 9681 [38;5;8mjvfhk[0m
+                              ir/trace.c:1316: trace_build_quote (null).(null)(8525) 9708 [38;5;8mj2qf6[0m
+                              ir/trace.c:1344: inline quote 9708 [38;5;8mb4fvf[0m
+                              ir/trace.c:811: trace_alloc scatter:foldr:iterate[6] size = 2 [38;5;8mmqt9l[0m
+                              ir/trace.c:811: trace_alloc scatter:foldr:iterate[7] size = 2 [38;5;8mb7qtx[0m
+                              ir/trace.c:711: switch_entry scatter:foldr:iterate 9681
+                                ir/trace.c:811: trace_alloc scatter:foldr:iterate[8] size = 2 [38;5;8mpmcxm[0m
+                                ir/trace.c:729: switch scatter[2] <- ??? from scatter[2] [38;5;8me29l2[0m
+                              user_func.c:1025: [37;41mHACK[0m forced cells[9711].expr.arg[1] [38;5;8mhrdfh[0m
+                              list.c:97: list: 9688
+                                list.c:164: log_ptrs for 9688 [38;5;8mkjg8w[0m
+                                  list.c:168: ptr[0] = 9699 [38;5;8me9vi6[0m
+                              ir/trace.c:1316: trace_build_quote (null).(null)(8525) 9688 [38;5;8mhx3cl[0m
+                              ir/trace.c:1259: updated var 9681 (scatter[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mp3oru[0m
+                              ir/trace.c:1259: updated var 9681 (scatter:foldr:iterate[8]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mniavj[0m
+                              ir/trace.c:1259: updated var 9680 (scatter[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mkws28[0m
+                              ir/trace.c:1259: updated var 9680 (scatter:foldr:iterate[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mife6t[0m
+                              ir/trace.c:811: trace_alloc scatter:foldr:iterate[9] size = 4 [38;5;8mftxai[0m
+                              ir/trace.c:889: trace_store_expr: scatter:foldr:iterate[9] <- exec 9711 9722 [38;5;8mlatuu[0m
+                              ir/trace.c:1259: updated var 9720 (scatter:foldr:iterate[6]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mipf2j[0m
+                      list.c:164: log_ptrs for 9687 [38;5;8mlkuqk[0m
+                        list.c:168: ptr[0] = 9695 [38;5;8mgbc4q[0m
+                    ir/trace.c:811: trace_alloc scatter:foldr:iterate[10] size = 3 [38;5;8mi3gt9[0m
+                    ir/trace.c:1472: trace_return: scatter:foldr:iterate[10] <- 9687 [38;5;8mogdil[0m
+                    ir/trace.c:1534: branch 0 finished 9687 [38;5;8mds96x[0m
+                  ir/trace.c:1495: branch 1: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          primitive/core.c:233: delay (priority 3) 9694 [38;5;8mbe688[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8md7a2n[0m
+                        list.c:170: ptr[0] = 9696 (skip delayed) [37;44m#abort[0m [38;5;8motpct[0m
+                ir/trace.c:1491: priority = 4
+                  ir/trace.c:1495: branch 1: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          primitive/core.c:233: delay (priority 4) 9694 [38;5;8mo7p8j[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8mbvtx2[0m
+                        list.c:170: ptr[0] = 9696 (skip delayed) [37;44m#abort[0m [38;5;8mmmcb8[0m
+                ir/trace.c:1491: priority = 5
+                  ir/trace.c:1495: branch 1: 9697
+                    list.c:97: list: 9697
+                      primitive/core.c:293: id: 9696
+                        primitive/core.c:231: unless: 9694
+                          ir/trace.c:967: trace_partial unless, arg[1] = 9702 [38;5;8mmwc7u[0m
+                            ir/trace.c:811: trace_alloc scatter:foldr:iterate[11] size = 2 [38;5;8mcc9sa[0m
+                          ir/trace.c:1259: updated var 9725 (scatter:foldr:iterate[11]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8me5dlp[0m
+                      list.c:164: log_ptrs for 9697 [38;5;8mnad3k[0m
+                        list.c:168: ptr[0] = 9696 [38;5;8mhwsdq[0m
+                    ir/trace.c:811: trace_alloc scatter:foldr:iterate[12] size = 3 [38;5;8mkov69[0m
+                    ir/trace.c:1472: trace_return: scatter:foldr:iterate[12] <- 9697 [38;5;8mp5srl[0m
+                    ir/trace.c:1534: branch 1 finished 9697 [38;5;8mfipfx[0m
+              rt.c:490: simplify 9680
+                special.c:74: value: 9680
+                  special.c:89: delay (priority 0) 9680 [38;5;8mk2w2v[0m
+              rt.c:490: simplify 9675
+                special.c:74: value: 9675
+                  special.c:89: delay (priority 0) 9675 [38;5;8mc7xgq[0m
+              user_func.c:656: flat call 9686 (scatter -> scatter:foldr:iterate)
+                user_func.c:682: arg[2] -> scatter[2] [38;5;8mlcxul[0m
+                user_func.c:682: arg[1] -> scatter[1] [38;5;8mdendu[0m
+                user_func.c:682: arg[0] -> scatter[3] [38;5;8mlgcs7[0m
+              ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in scatter:foldr:iterate [38;5;8mas9hj[0m
+              ir/compile.c:292: move var 1 -> 2 [38;5;8mf955v[0m
+              ir/compile.c:292: move var 2 -> 3 [38;5;8mobrk8[0m
+              ir/compile.c:292: move var 8 -> 1 [38;5;8mgdg4h[0m
+              ir/analysis.c:519: calculate_bit_width (null).(null)(8525) [38;5;8moe6jq[0m
+              ir/analysis.c:519: calculate_bit_width (null).(null)(8525) [38;5;8mi5ktw[0m
+              ir/trace.c:811: trace_alloc scatter[4] size = 4 [38;5;8mdr276[0m
+              ir/trace.c:889: trace_store_expr: scatter[4] <- exec 9727 9731 [38;5;8mi8vsi[0m
+              ir/trace.c:1259: updated var 9731 (scatter[4]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mgnhv7[0m
+          list.c:164: log_ptrs for 9679 [38;5;8mosid2[0m
+            list.c:168: ptr[0] = 9682 [38;5;8mjiwn8[0m
+        ir/trace.c:811: trace_alloc scatter[5] size = 3 [38;5;8mma4hn[0m
+        ir/trace.c:1472: trace_return: scatter[5] <- 9679 [38;5;8mbnw53[0m
+        ir/trace.c:1534: branch 0 finished 9679 [38;5;8mg4tqf[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in scatter [38;5;8mg78ox[0m
+  ir/analysis.c:519: calculate_bit_width control.scatter(333) [38;5;8mmk5dd[0m
+  ir/analysis.c:519: calculate_bit_width control.scatter(333) [38;5;8mhbjnj[0m
+ir/compile.c:691: compiling quadratic [38;5;8mpc86s[0m
+  ir/trace.c:811: trace_alloc quadratic[1] size = 2 [38;5;8mj3ng2[0m
+  ir/trace.c:811: trace_alloc quadratic[2] size = 2 [38;5;8mpgj5e[0m
+  ir/trace.c:811: trace_alloc quadratic[3] size = 2 [38;5;8metgpq[0m
+  ir/trace.c:1485: trace_reduce quadratic 9777
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 9777
+        list.c:97: list: 9777
+          special.c:429: dep: 9782
+            primitive/core.c:394: ap: 9781
+              user_func.c:1118: exec: 9785 scatter:foldr:iterate
+                user_func.c:442: exec_expand scatter:foldr:iterate: 9785 0x0
+                  rt.c:927: allocated alt ids 0...0 [38;5;8mpxat8[0m
+              primitive/core.c:293: id: 9794
+                primitive/core.c:153: seq: 9789
+                  user_func.c:1118: exec: 9792 scatter:foldr:iterate
+                    user_func.c:442: exec_expand scatter:foldr:iterate: 9792 0x20
+                      rt.c:927: allocated alt ids 1...1 [38;5;8mfktfo[0m
+                  primitive/core.c:293: id: 9813
+                    primitive/core.c:153: seq: 9808
+                      user_func.c:1118: exec: 9811 scatter:foldr:iterate
+                        user_func.c:442: exec_expand scatter:foldr:iterate: 9811 0x20
+                          rt.c:927: allocated alt ids 2...2 [38;5;8mk8fw8[0m
+                      primitive/core.c:293: id: 9838
+                        primitive/core.c:153: seq: 9833
+                          user_func.c:1118: exec: 9836 scatter:foldr:iterate
+                            user_func.c:442: exec_expand scatter:foldr:iterate: 9836 0x20
+                              rt.c:927: allocated alt ids 3...3 [38;5;8mar2io[0m
+                          primitive/core.c:293: id: 9862
+                            primitive/core.c:153: seq: 9857
+                              user_func.c:1118: exec: 9860 scatter:foldr:iterate
+                                user_func.c:442: exec_expand scatter:foldr:iterate: 9860 0x20
+                                  rt.c:927: allocated alt ids 4...4 [38;5;8mgfk38[0m
+                              primitive/core.c:293: id: 9887
+                                primitive/core.c:153: seq: 9882
+                                  primitive/core.c:153: seq: 9890
+                                    primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9890 [38;5;8mja3r9[0m
+                                  user_func.c:1118: exec: 9885 scatter:foldr:iterate
+                                    primitive/core.c:394: compose: 9883
+                                      primitive/core.c:394: compose: 9884
+                                        primitive/core.c:153: seq: 9890
+                                          primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9890 [38;5;8moumdp[0m
+                                    user_func.c:442: exec_expand scatter:foldr:iterate: 9885 0x20
+                                      rt.c:927: allocated alt ids 5...5 [38;5;8mbp45q[0m
+                                  primitive/core.c:293: id: 9904
+                                    primitive/core.c:153: seq: 9899
+                                      special.c:429: dep: 9898
+                                        primitive/core.c:394: ap: 9897
+                                          primitive/core.c:493: null quote output: arg[1] = 9898 [38;5;8mmm9c4[0m
+                                      special.c:74: value: 9898
+                                        rt.c:1005: check_type: requested T_ANY, but expected T_FAIL [38;5;8mj5rgp[0m
+                                      rt.c:457: [37;41mFAIL[0m: value 9898 (__primitive.dep) special.c:117 [37;44m@abort[0m [38;5;8mpin45[0m
+                                    rt.c:457: [37;41mFAIL[0m: seq 9899 (__primitive.seq) primitive/core.c:160 [37;44m@abort[0m [38;5;8mmw98q[0m
+                                  primitive/core.c:293: id: 9905
+                                    primitive/core.c:231: unless: 9903
+                                      special.c:74: value: 9898
+                                        rt.c:1005: check_type: requested T_ANY, but expected T_FAIL [38;5;8mki7ax[0m
+                                      rt.c:457: [37;41mFAIL[0m: value 9898 (__primitive.value) special.c:117 [37;44m@abort[0m [38;5;8mpv3vd[0m
+          primitive/core.c:293: id: 9782
+            primitive/core.c:293: id: 9915
+              primitive/core.c:153: seq: 9918
+                primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9918 [38;5;8mk3t3r[0m
+              primitive/arithmetic.c:302: op2_float: 9895
+                primitive/arithmetic.c:302: op2_float: 9894
+                  primitive/arithmetic.c:302: op2_float: 9892
+                    special.c:429: dep: 9922
+                      primitive/core.c:394: ap: 9921
+                        user_func.c:1118: exec: 9920 dropl:iterate
+                          user_func.c:972: exec_trace: 9920 dropl:iterate 0x0
+                            user_func.c:1025: [37;41mHACK[0m forced cells[9920].expr.arg[0] [38;5;8mn52ow[0m
+                            list.c:97: list: 9924
+                              list.c:164: log_ptrs for 9924 [38;5;8mat6if[0m
+                                list.c:168: ptr[0] = 9778 [38;5;8mlkksl[0m
+                                list.c:168: ptr[1] = 9779 [38;5;8mdmabu[0m
+                                list.c:168: ptr[2] = 9780 [38;5;8mlnvq7[0m
+                            ir/trace.c:1316: trace_build_quote tests.quadratic(352) 9924 [38;5;8mof3km[0m
+                            ir/trace.c:1344: inline quote 9924 [38;5;8mgho3v[0m
+                            ir/trace.c:811: trace_alloc quadratic[4] size = 3 [38;5;8ma77d5[0m
+                            ir/trace.c:811: trace_alloc quadratic[5] size = 3 [38;5;8mgk32h[0m
+                            ir/trace.c:889: trace_store_expr: quadratic[5] <- exec 9920 9927 [38;5;8mlxwmt[0m
+                              ir/trace.c:811: trace_alloc quadratic[6] size = 3 [38;5;8ml5blf[0m
+                            ir/trace.c:1259: updated var 9926 (quadratic[4]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8motfeu[0m
+                            ir/trace.c:1259: updated var 9927 (quadratic[5]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mmbxij[0m
+                        var.c:80: var_create_list 9920 9928 0 1 0 0 [38;5;8megxwe[0m
+                    primitive/core.c:153: seq: 9932
+                      special.c:429: dep: 9930
+                        special.c:466: placeholder: 9929
+                          special.c:74: value: 9920
+                            special.c:89: delay (priority 0) 9920 [38;5;8mhfrmx[0m
+                    special.c:74: value: 9741
+                      special.c:102: convert integer constant -1 [38;5;8mpkr4s[0m
+                  primitive/core.c:75: alt: 9876
+                    rt.c:927: allocated alt ids 6...6 [38;5;8mpn63e[0m
+                  primitive/core.c:293: id: 9935
+                    primitive/arithmetic.c:325: op1_float: 9872
+                      primitive/arithmetic.c:302: op2_float: 9871
+                        primitive/arithmetic.c:302: op2_float: 9869
+                          special.c:429: dep: 9938
+                            primitive/core.c:394: ap: 9937
+                              user_func.c:1118: exec: 9936 dropl:iterate
+                                user_func.c:972: exec_trace: 9936 dropl:iterate 0x0
+                                  user_func.c:1025: [37;41mHACK[0m forced cells[9936].expr.arg[0] [38;5;8mp5itm[0m
+                                  list.c:97: list: 9924
+                                    list.c:164: log_ptrs for 9924 [38;5;8mctmm5[0m
+                                      list.c:168: ptr[0] = 9778 [38;5;8mnj4xb[0m
+                                      list.c:168: ptr[1] = 9779 [38;5;8mflqgk[0m
+                                      list.c:168: ptr[2] = 9780 [38;5;8mnnfvt[0m
+                                  ir/trace.c:1316: trace_build_quote tests.quadratic(352) 9924 [38;5;8mafjpc[0m
+                                  ir/trace.c:1344: inline quote 9924 [38;5;8mig88l[0m
+                                  ir/trace.c:811: trace_alloc quadratic[7] size = 3 [38;5;8mc7nir[0m
+                                  ir/trace.c:811: trace_alloc quadratic[8] size = 3 [38;5;8mikj67[0m
+                                  ir/trace.c:889: trace_store_expr: quadratic[8] <- exec 9936 9941 [38;5;8mnxgrj[0m
+                                    ir/trace.c:959: dedup quadratic[8] (9941) -> quadratic[5] [38;5;8mn4rp5[0m
+                                  ir/trace.c:1259: updated var 9940 (quadratic[7]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8masvjk[0m
+                              var.c:80: var_create_list 9936 9942 0 1 0 0 [38;5;8mixvxf[0m
+                          primitive/core.c:153: seq: 9946
+                            special.c:429: dep: 9944
+                              special.c:466: placeholder: 9943
+                                special.c:74: value: 9936
+                                  special.c:89: delay (priority 0) 9936 [38;5;8mlwpn2[0m
+                          primitive/core.c:153: seq: 9946
+                            special.c:429: dep: 9944
+                              special.c:466: placeholder: 9943
+                                special.c:74: value: 9936
+                                  special.c:89: delay (priority 0) 9936 [38;5;8md844f[0m
+                        primitive/arithmetic.c:302: op2_float: 9845
+                          primitive/arithmetic.c:302: op2_float: 9844
+                            special.c:429: dep: 9949
+                              primitive/core.c:394: ap: 9948
+                                user_func.c:1118: exec: 9947 dropl:iterate
+                                  user_func.c:972: exec_trace: 9947 dropl:iterate 0x0
+                                    user_func.c:1025: [37;41mHACK[0m forced cells[9947].expr.arg[0] [38;5;8memgun[0m
+                                    list.c:97: list: 9924
+                                      list.c:164: log_ptrs for 9924 [38;5;8mhekn6[0m
+                                        list.c:168: ptr[0] = 9778 [38;5;8mb422c[0m
+                                        list.c:168: ptr[1] = 9779 [38;5;8mj6ohl[0m
+                                        list.c:168: ptr[2] = 9780 [38;5;8mb8dwu[0m
+                                    ir/trace.c:1316: trace_build_quote tests.quadratic(352) 9924 [38;5;8mewhqd[0m
+                                    ir/trace.c:1344: inline quote 9924 [38;5;8mmx69m[0m
+                                    ir/trace.c:811: trace_alloc quadratic[9] size = 3 [38;5;8mholjs[0m
+                                    ir/trace.c:811: trace_alloc quadratic[10] size = 3 [38;5;8mm5h78[0m
+                                    ir/trace.c:889: trace_store_expr: quadratic[10] <- exec 9947 9952 [38;5;8mciesk[0m
+                                      ir/trace.c:811: trace_alloc quadratic[11] size = 3 [38;5;8mclpq6[0m
+                                    ir/trace.c:1259: updated var 9951 (quadratic[9]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mfdtkl[0m
+                                    ir/trace.c:1259: updated var 9952 (quadratic[10]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mcsfoa[0m
+                                var.c:80: var_create_list 9947 9953 0 1 0 0 [38;5;8mkxf55[0m
+                            primitive/core.c:153: seq: 9957
+                              special.c:429: dep: 9955
+                                special.c:466: placeholder: 9954
+                                  special.c:74: value: 9947
+                                    special.c:89: delay (priority 0) 9947 [38;5;8mnv9so[0m
+                            special.c:429: dep: 9960
+                              primitive/core.c:394: ap: 9959
+                                user_func.c:1118: exec: 9958 dropl:iterate
+                                  user_func.c:972: exec_trace: 9958 dropl:iterate 0x0
+                                    user_func.c:1025: [37;41mHACK[0m forced cells[9958].expr.arg[0] [38;5;8mllhth[0m
+                                    list.c:97: list: 9924
+                                      list.c:164: log_ptrs for 9924 [38;5;8modlmw[0m
+                                        list.c:168: ptr[0] = 9778 [38;5;8mi33w6[0m
+                                        list.c:168: ptr[1] = 9779 [38;5;8ma5pgf[0m
+                                        list.c:168: ptr[2] = 9780 [38;5;8mi7evo[0m
+                                    ir/trace.c:1316: trace_build_quote tests.quadratic(352) 9924 [38;5;8mlvio7[0m
+                                    ir/trace.c:1344: inline quote 9924 [38;5;8mdw78g[0m
+                                    ir/trace.c:811: trace_alloc quadratic[12] size = 3 [38;5;8monmim[0m
+                                    ir/trace.c:811: trace_alloc quadratic[13] size = 3 [38;5;8md4i62[0m
+                                    ir/trace.c:889: trace_store_expr: quadratic[13] <- exec 9958 9963 [38;5;8mjhfre[0m
+                                      ir/trace.c:811: trace_alloc quadratic[14] size = 3 [38;5;8mjkqpw[0m
+                                    ir/trace.c:1259: updated var 9962 (quadratic[12]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mmcujf[0m
+                                    ir/trace.c:1259: updated var 9963 (quadratic[13]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mjrgm4[0m
+                                var.c:80: var_create_list 9958 9964 0 1 0 0 [38;5;8mbwg4v[0m
+                            primitive/core.c:153: seq: 9968
+                              special.c:429: dep: 9966
+                                special.c:466: placeholder: 9965
+                                  special.c:74: value: 9958
+                                    special.c:89: delay (priority 0) 9958 [38;5;8mevari[0m
+                          special.c:74: value: 9756
+                            special.c:102: convert integer constant 4 [38;5;8mkfieg[0m
+                primitive/arithmetic.c:302: op2_float: 9803
+                  special.c:429: dep: 9975
+                    primitive/core.c:394: ap: 9974
+                      user_func.c:1118: exec: 9973 dropl:iterate
+                        user_func.c:972: exec_trace: 9973 dropl:iterate 0x0
+                          user_func.c:1025: [37;41mHACK[0m forced cells[9973].expr.arg[0] [38;5;8mp6fui[0m
+                          list.c:97: list: 9924
+                            list.c:164: log_ptrs for 9924 [38;5;8mcujnx[0m
+                              list.c:168: ptr[0] = 9778 [38;5;8mnkxx7[0m
+                              list.c:168: ptr[1] = 9779 [38;5;8mfmnhg[0m
+                              list.c:168: ptr[2] = 9780 [38;5;8mnocwp[0m
+                          ir/trace.c:1316: trace_build_quote tests.quadratic(352) 9924 [38;5;8maggp8[0m
+                          ir/trace.c:1344: inline quote 9924 [38;5;8mih59h[0m
+                          ir/trace.c:811: trace_alloc quadratic[15] size = 3 [38;5;8mc8kjn[0m
+                          ir/trace.c:811: trace_alloc quadratic[16] size = 3 [38;5;8milg73[0m
+                          ir/trace.c:889: trace_store_expr: quadratic[16] <- exec 9973 9978 [38;5;8mn2dsf[0m
+                            ir/trace.c:959: dedup quadratic[16] (9978) -> quadratic[13] [38;5;8mn5oqx[0m
+                          ir/trace.c:1259: updated var 9977 (quadratic[15]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8matskg[0m
+                      var.c:80: var_create_list 9973 9979 0 1 0 0 [38;5;8mi2s2b[0m
+                  primitive/core.c:153: seq: 9983
+                    special.c:429: dep: 9981
+                      special.c:466: placeholder: 9980
+                        special.c:74: value: 9973
+                          special.c:89: delay (priority 0) 9973 [38;5;8mlxmou[0m
+                  special.c:74: value: 9769
+                    special.c:102: convert integer constant 2 [38;5;8md6m6p[0m
+          list.c:164: log_ptrs for 9777 [38;5;8mbk9ae[0m
+            list.c:170: ptr[0] = 9782 (skip delayed) [37;44m#abort[0m [38;5;8mmbnkk[0m
+      ir/trace.c:1495: branch 0: 9987
+        list.c:97: list: 9987
+          primitive/core.c:293: id: 9986
+            primitive/core.c:293: id: 9985
+              primitive/arithmetic.c:302: op2_float: 9972
+                primitive/arithmetic.c:302: op2_float: 9971
+                  primitive/arithmetic.c:302: op2_float: 9892
+                    primitive/core.c:153: seq: 9932
+                      special.c:429: dep: 9930
+                        special.c:466: placeholder: 9929
+                          special.c:74: value: 9920
+                            special.c:89: delay (priority 0) 9920 [38;5;8mpg68b[0m
+                  primitive/core.c:293: id: 9934
+                    primitive/arithmetic.c:302: op2_float: 9875
+                      primitive/arithmetic.c:325: op1_float: 9872
+                        primitive/arithmetic.c:302: op2_float: 9871
+                          primitive/arithmetic.c:302: op2_float: 9869
+                            primitive/core.c:153: seq: 9946
+                              special.c:429: dep: 9944
+                                special.c:466: placeholder: 9943
+                                  special.c:74: value: 9936
+                                    special.c:89: delay (priority 0) 9936 [38;5;8mkkxcp[0m
+                            primitive/core.c:153: seq: 9946
+                              special.c:429: dep: 9944
+                                special.c:466: placeholder: 9943
+                                  special.c:74: value: 9936
+                                    special.c:89: delay (priority 0) 9936 [38;5;8mctco6[0m
+                          primitive/arithmetic.c:302: op2_float: 9845
+                            primitive/arithmetic.c:302: op2_float: 9844
+                              primitive/core.c:153: seq: 9957
+                                special.c:429: dep: 9955
+                                  special.c:466: placeholder: 9954
+                                    special.c:74: value: 9947
+                                      special.c:89: delay (priority 0) 9947 [38;5;8mntru2[0m
+                              primitive/core.c:153: seq: 9968
+                                special.c:429: dep: 9966
+                                  special.c:466: placeholder: 9965
+                                    special.c:74: value: 9958
+                                      special.c:89: delay (priority 0) 9958 [38;5;8mf57bf[0m
+                      special.c:74: value: 9762
+                        special.c:102: convert integer constant -1 [38;5;8mdn4dm[0m
+                primitive/arithmetic.c:302: op2_float: 9803
+                  primitive/core.c:153: seq: 9983
+                    special.c:429: dep: 9981
+                      special.c:466: placeholder: 9980
+                        special.c:74: value: 9973
+                          special.c:89: delay (priority 0) 9973 [38;5;8mjbmu6[0m
+          list.c:164: log_ptrs for 9987 [38;5;8ml65m7[0m
+            list.c:170: ptr[0] = 9986 (skip delayed) [37;44m#abort[0m [38;5;8mgtjxd[0m
+      ir/trace.c:1495: branch 0: 9989
+        list.c:97: list: 9989
+          special.c:429: dep: 9916
+            primitive/core.c:394: ap: 9914
+              primitive/core.c:293: id: 9913
+                primitive/core.c:153: seq: 9912
+                  primitive/core.c:293: id: 9911
+                    primitive/core.c:153: seq: 9910
+                      primitive/core.c:293: id: 9909
+                        primitive/core.c:153: seq: 9908
+                          primitive/core.c:293: id: 9907
+                            primitive/core.c:153: seq: 9906
+                              primitive/core.c:293: id: 9888
+                                primitive/core.c:231: unless: 9886
+                                  primitive/core.c:153: seq: 9890
+                                    primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 9890 [38;5;8mb732v[0m
+                                rt.c:457: [37;41mFAIL[0m: unless 9886 (__primitive.unless) primitive/core.c:247 [37;44m@abort[0m [38;5;8mcbexh[0m
+                              rt.c:457: [37;41mFAIL[0m: id 9888 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8mppw46[0m
+                            rt.c:457: [37;41mFAIL[0m: seq 9906 (__primitive.seq) primitive/core.c:177 [37;44m@abort[0m [38;5;8mm8i8r[0m
+                          primitive/core.c:293: id: 9863
+                            rt.c:457: [37;41mFAIL[0m: unless 9861 (__primitive.unless) primitive/core.c:247 [37;44m@abort[0m [38;5;8mfdjmm[0m
+                          rt.c:457: [37;41mFAIL[0m: id 9863 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8mcr5qb[0m
+                        rt.c:457: [37;41mFAIL[0m: seq 9908 (__primitive.seq) primitive/core.c:177 [37;44m@abort[0m [38;5;8maantw[0m
+                      primitive/core.c:293: id: 9839
+                        rt.c:457: [37;41mFAIL[0m: unless 9837 (__primitive.unless) primitive/core.c:247 [37;44m@abort[0m [38;5;8mifobr[0m
+                      rt.c:457: [37;41mFAIL[0m: id 9839 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8mfuafg[0m
+                    rt.c:457: [37;41mFAIL[0m: seq 9910 (__primitive.seq) primitive/core.c:177 [37;44m@abort[0m [38;5;8mdcsi5[0m
+                  primitive/core.c:293: id: 9814
+                    rt.c:457: [37;41mFAIL[0m: unless 9812 (__primitive.unless) primitive/core.c:247 [37;44m@abort[0m [38;5;8mlhsww[0m
+                  rt.c:457: [37;41mFAIL[0m: id 9814 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8miwe4l[0m
+                rt.c:457: [37;41mFAIL[0m: seq 9912 (__primitive.seq) primitive/core.c:177 [37;44m@abort[0m [38;5;8mgew8a[0m
+              primitive/core.c:293: id: 9795
+                rt.c:457: [37;41mFAIL[0m: unless 9793 (__primitive.unless) primitive/core.c:247 [37;44m@abort[0m [38;5;8mojxl5[0m
+              rt.c:457: [37;41mFAIL[0m: id 9795 (__primitive.id) primitive/core.c:298 [37;44m@abort[0m [38;5;8ml2jpq[0m
+          rt.c:457: [37;41mFAIL[0m: dep 9916 (__primitive.dep) special.c:439 [37;44m@abort[0m [38;5;8mgsc2i[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 9777
+        list.c:97: list: 9777
+          primitive/core.c:293: id: 9915
+            primitive/arithmetic.c:302: op2_float: 9895
+              primitive/arithmetic.c:302: op2_float: 9894
+                primitive/arithmetic.c:302: op2_float: 9892
+                  primitive/core.c:153: seq: 9932
+                    special.c:429: dep: 9930
+                      special.c:466: placeholder: 9929
+                        ir/trace.c:811: trace_alloc quadratic[17] size = 2 [38;5;8mhc3rc[0m
+                        ir/trace.c:889: trace_store_expr: quadratic[17] <- placeholder 9929 9990 [38;5;8mmpwfo[0m
+                        ir/trace.c:1259: updated var 9990 (quadratic[17]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mj8ijd[0m
+                      ir/trace.c:811: trace_alloc quadratic[18] size = 1 [38;5;8me2br5[0m
+                      ir/trace.c:1132: trace_dep: 18 <- 9930 17[1] [38;5;8mke8gh[0m
+                    ir/trace.c:1259: updated var 9930 (quadratic[18]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mkije3[0m
+                  ir/trace.c:811: trace_alloc quadratic[19] size = 2 [38;5;8mfccnr[0m
+                  ir/trace.c:889: trace_store_expr: quadratic[19] <- mul_float 9892 9991 [38;5;8mko9b7[0m
+                    ir/trace.c:811: trace_alloc quadratic[20] size = 3 [38;5;8mkskap[0m
+                  ir/trace.c:1259: updated var 9991 (quadratic[19]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mnkn38[0m
+                primitive/core.c:293: id: 9970
+                  primitive/arithmetic.c:325: op1_float: 9872
+                    primitive/arithmetic.c:302: op2_float: 9871
+                      primitive/arithmetic.c:302: op2_float: 9869
+                        primitive/core.c:153: seq: 9946
+                          special.c:429: dep: 9944
+                            special.c:466: placeholder: 9943
+                              ir/trace.c:811: trace_alloc quadratic[21] size = 2 [38;5;8mdblka[0m
+                              ir/trace.c:889: trace_store_expr: quadratic[21] <- placeholder 9943 9992 [38;5;8mioh8m[0m
+                              ir/trace.c:1259: updated var 9992 (quadratic[21]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mf64cb[0m
+                            ir/trace.c:811: trace_alloc quadratic[22] size = 1 [38;5;8mawtk3[0m
+                            ir/trace.c:1132: trace_dep: 22 <- 9944 21[1] [38;5;8mgdp9f[0m
+                          ir/trace.c:1259: updated var 9944 (quadratic[22]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mgg47x[0m
+                        ir/trace.c:811: trace_alloc quadratic[23] size = 2 [38;5;8mbaugp[0m
+                        ir/trace.c:889: trace_store_expr: quadratic[23] <- mul_float 9869 9993 [38;5;8mgnq45[0m
+                        ir/trace.c:1259: updated var 9993 (quadratic[23]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8md6c8q[0m
+                      primitive/arithmetic.c:302: op2_float: 9845
+                        primitive/arithmetic.c:302: op2_float: 9844
+                          primitive/core.c:153: seq: 9957
+                            special.c:429: dep: 9955
+                              special.c:466: placeholder: 9954
+                                ir/trace.c:811: trace_alloc quadratic[24] size = 2 [38;5;8megd4g[0m
+                                ir/trace.c:889: trace_store_expr: quadratic[24] <- placeholder 9954 9994 [38;5;8mjtaos[0m
+                                ir/trace.c:1259: updated var 9994 (quadratic[24]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mhbssh[0m
+                              ir/trace.c:811: trace_alloc quadratic[25] size = 1 [38;5;8mb5l49[0m
+                              ir/trace.c:1132: trace_dep: 25 <- 9955 24[1] [38;5;8mhiipl[0m
+                            ir/trace.c:1259: updated var 9955 (quadratic[25]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mhltn7[0m
+                          primitive/core.c:153: seq: 9968
+                            special.c:429: dep: 9966
+                              special.c:466: placeholder: 9965
+                                ir/trace.c:811: trace_alloc quadratic[26] size = 2 [38;5;8mcixvh[0m
+                                ir/trace.c:889: trace_store_expr: quadratic[26] <- placeholder 9965 9995 [38;5;8mhvujt[0m
+                                ir/trace.c:1259: updated var 9995 (quadratic[26]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mfegni[0m
+                              ir/trace.c:811: trace_alloc quadratic[27] size = 1 [38;5;8mp79wa[0m
+                              ir/trace.c:1132: trace_dep: 27 <- 9966 26[1] [38;5;8mfk6km[0m
+                            ir/trace.c:1259: updated var 9966 (quadratic[27]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mfohi8[0m
+                          ir/trace.c:811: trace_alloc quadratic[28] size = 2 [38;5;8maiarw[0m
+                          ir/trace.c:889: trace_store_expr: quadratic[28] <- mul_float 9844 9996 [38;5;8mfu7gc[0m
+                          ir/trace.c:1259: updated var 9996 (quadratic[28]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mddpjx[0m
+                        ir/trace.c:811: trace_alloc quadratic[29] size = 2 [38;5;8mn7isp[0m
+                        ir/trace.c:889: trace_store_expr: quadratic[29] <- mul_float 9845 9997 [38;5;8mdkfg5[0m
+                          ir/trace.c:811: trace_alloc quadratic[30] size = 3 [38;5;8mdnqfn[0m
+                        ir/trace.c:1259: updated var 9997 (quadratic[29]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mgft86[0m
+                      ir/trace.c:811: trace_alloc quadratic[31] size = 2 [38;5;8ma9nhu[0m
+                      ir/trace.c:889: trace_store_expr: quadratic[31] <- sub_float 9871 9998 [38;5;8mgmj6a[0m
+                      ir/trace.c:1259: updated var 9998 (quadratic[31]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8md459v[0m
+                    ir/trace.c:811: trace_alloc quadratic[32] size = 1 [38;5;8mouvin[0m
+                    ir/trace.c:889: trace_store_expr: quadratic[32] <- sqrt 9872 9999 [38;5;8mebr63[0m
+                    ir/trace.c:1259: updated var 9999 (quadratic[32]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mbqeao[0m
+                ir/trace.c:811: trace_alloc quadratic[33] size = 2 [38;5;8mjveoj[0m
+                ir/trace.c:889: trace_store_expr: quadratic[33] <- add_float 9894 10001 [38;5;8mpcbcv[0m
+                ir/trace.c:1259: updated var 10001 (quadratic[33]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mmqtgk[0m
+              primitive/arithmetic.c:302: op2_float: 9803
+                primitive/core.c:153: seq: 9983
+                  special.c:429: dep: 9981
+                    special.c:466: placeholder: 9980
+                      ir/trace.c:811: trace_alloc quadratic[34] size = 2 [38;5;8mcefx4[0m
+                      ir/trace.c:889: trace_store_expr: quadratic[34] <- placeholder 9980 10002 [38;5;8mhrcmg[0m
+                      ir/trace.c:1259: updated var 10002 (quadratic[34]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8me9up5[0m
+                    ir/trace.c:811: trace_alloc quadratic[35] size = 1 [38;5;8mp3n2t[0m
+                    ir/trace.c:1132: trace_dep: 35 <- 9981 34[1] [38;5;8mfgkm9[0m
+                  ir/trace.c:1259: updated var 9981 (quadratic[35]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mfjvlr[0m
+                ir/trace.c:811: trace_alloc quadratic[36] size = 2 [38;5;8madouj[0m
+                ir/trace.c:889: trace_store_expr: quadratic[36] <- mul_float 9803 10003 [38;5;8mfqliv[0m
+                  ir/trace.c:811: trace_alloc quadratic[37] size = 3 [38;5;8mftwhh[0m
+                ir/trace.c:1259: updated var 10003 (quadratic[36]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mil4aw[0m
+              ir/trace.c:811: trace_alloc quadratic[38] size = 2 [38;5;8mdftjo[0m
+              ir/trace.c:889: trace_store_expr: quadratic[38] <- div_float 9895 10004 [38;5;8misp74[0m
+              ir/trace.c:1259: updated var 10004 (quadratic[38]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mgbcbp[0m
+          list.c:164: log_ptrs for 9777 [38;5;8mogcpk[0m
+            list.c:168: ptr[0] = 9915 [38;5;8mi6q3q[0m
+        ir/trace.c:811: trace_alloc quadratic[39] size = 3 [38;5;8mluus9[0m
+        ir/trace.c:1472: trace_return: quadratic[39] <- 9777 [38;5;8mbbrhl[0m
+        ir/trace.c:1534: branch 0 finished 9777 [38;5;8mgon5x[0m
+      ir/trace.c:1495: branch 1: 9987
+        list.c:97: list: 9987
+          primitive/core.c:293: id: 9985
+            primitive/arithmetic.c:302: op2_float: 9972
+              primitive/arithmetic.c:302: op2_float: 9971
+                primitive/core.c:293: id: 9934
+                  primitive/arithmetic.c:302: op2_float: 9875
+                    ir/trace.c:811: trace_alloc quadratic[40] size = 2 [38;5;8medv6q[0m
+                    ir/trace.c:889: trace_store_expr: quadratic[40] <- mul_float 9875 10006 [38;5;8mjqsq6[0m
+                    ir/trace.c:1259: updated var 10006 (quadratic[40]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mg9eur[0m
+                ir/trace.c:811: trace_alloc quadratic[41] size = 2 [38;5;8mpefcm[0m
+                ir/trace.c:889: trace_store_expr: quadratic[41] <- add_float 9971 10007 [38;5;8merbw2[0m
+                ir/trace.c:1259: updated var 10007 (quadratic[41]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mb9t4n[0m
+              ir/trace.c:811: trace_alloc quadratic[42] size = 2 [38;5;8mm3ndf[0m
+              ir/trace.c:889: trace_store_expr: quadratic[42] <- div_float 9972 10008 [38;5;8mcgjxr[0m
+              ir/trace.c:1259: updated var 10008 (quadratic[42]) to T_FLOAT[-9223372036854775808, 9223372036854775807] [38;5;8mpu55g[0m
+          list.c:164: log_ptrs for 9987 [38;5;8mh36jb[0m
+            list.c:168: ptr[0] = 9985 [38;5;8mcqkth[0m
+        ir/trace.c:811: trace_alloc quadratic[43] size = 3 [38;5;8mfiomw[0m
+        ir/trace.c:1472: trace_return: quadratic[43] <- 9987 [38;5;8mkvlbc[0m
+        ir/trace.c:1534: branch 1 finished 9987 [38;5;8machvo[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in quadratic [38;5;8mafsua[0m
+  ir/compile.c:467: cse quadratic[7] -> 4 [38;5;8mfspim[0m
+  ir/compile.c:467: cse quadratic[8] -> 5 [38;5;8mk9l62[0m
+  ir/compile.c:467: cse quadratic[9] -> 4 [38;5;8mamire[0m
+  ir/compile.c:467: cse quadratic[12] -> 4 [38;5;8mf3ffq[0m
+  ir/compile.c:467: cse quadratic[15] -> 4 [38;5;8mlgb36[0m
+  ir/compile.c:467: cse quadratic[16] -> 13 [38;5;8mas8oi[0m
+  ir/compile.c:246: drop quadratic[7] quote [38;5;8mf95cu[0m
+  ir/compile.c:246: drop quadratic[8] exec [38;5;8mlmxxa[0m
+  ir/compile.c:246: drop quadratic[9] quote [38;5;8ma3ulm[0m
+  ir/compile.c:246: drop quadratic[12] quote [38;5;8mggq92[0m
+  ir/compile.c:246: drop quadratic[15] quote [38;5;8mltnue[0m
+  ir/compile.c:246: drop quadratic[16] exec [38;5;8mbakiq[0m
+  ir/compile.c:302: collapse 7 [38;5;8mgng66[0m
+  ir/compile.c:302: collapse 8 [38;5;8mbdvhc[0m
+  ir/compile.c:302: collapse 9 [38;5;8ml4dri[0m
+  ir/compile.c:302: collapse 12 [38;5;8mgqr5o[0m
+  ir/compile.c:302: collapse 15 [38;5;8mbhafu[0m
+  ir/compile.c:302: collapse 16 [38;5;8ml7op4[0m
+  ir/analysis.c:519: calculate_bit_width tests.quadratic(352) [38;5;8mgt64a[0m
+  ir/analysis.c:519: calculate_bit_width tests.quadratic(352) [38;5;8mbkleg[0m
+[37;41m!!![0m gen/cgen.c:210: gen_value_rhs: Assertion `false' failed:  [38;5;8mjmatp[0m
+
+ir/compile.c:691: compiling tail [38;5;8mbnwc2[0m
+  ir/trace.c:811: trace_alloc tail[1] size = 2 [38;5;8mmeem8[0m
+  ir/trace.c:1485: trace_reduce tail 7424
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7424
+        list.c:97: list: 7424
+          primitive/core.c:394: ap: 7421
+            special.c:74: value: 7425
+              special.c:89: delay (priority 0) 7425 [38;5;8mj3mnx[0m
+          list.c:164: log_ptrs for 7424 [38;5;8mmrqhg[0m
+            list.c:170: ptr[0] = 7421 (skip delayed) [37;44m#abort[0m [38;5;8mhh8rm[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7424
+        list.c:97: list: 7424
+          primitive/core.c:394: ap: 7421
+            special.c:74: value: 7425
+              var.c:80: var_create_list 7425 7426 0 1 0 0 [38;5;8me7gsf[0m
+          list.c:164: log_ptrs for 7424 [38;5;8mnchaa[0m
+            list.c:168: ptr[0] = 7421 [38;5;8mh2vkg[0m
+        special.c:466: placeholder: 7427
+          ir/trace.c:811: trace_alloc tail[2] size = 2 [38;5;8mfhhn5[0m
+          special.c:511: dropped placeholder[7427] output [38;5;8mkuech[0m
+          ir/trace.c:889: trace_store_expr: tail[2] <- placeholder 7427 7430 [38;5;8mfksmn[0m
+          ir/trace.c:1259: updated var 7425 (tail[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mc3eqc[0m
+          ir/trace.c:1259: updated var 7430 (tail[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mahwtx[0m
+        ir/trace.c:811: trace_alloc tail[3] size = 3 [38;5;8mlbp6p[0m
+        ir/trace.c:1472: trace_return: tail[3] <- 7424 [38;5;8maomq5[0m
+        ir/trace.c:1534: branch 0 finished 7424 [38;5;8mf5jfh[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in tail [38;5;8mf8ud3[0m
+  ir/analysis.c:519: calculate_bit_width stack.tail(390) [38;5;8mllq2f[0m
+  ir/analysis.c:519: calculate_bit_width stack.tail(390) [38;5;8mgb9cl[0m
+ir/compile.c:691: compiling pull [38;5;8moduru[0m
+  ir/trace.c:811: trace_alloc pull[1] size = 2 [38;5;8mi4c54[0m
+  ir/trace.c:1485: trace_reduce pull 7484
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7484
+        list.c:97: list: 7484
+          primitive/core.c:394: ap: 7480
+            special.c:74: value: 7485
+              special.c:89: delay (priority 0) 7485 [38;5;8mgpk6t[0m
+          special.c:429: dep: 7481
+            primitive/core.c:394: ap: 7480
+              special.c:74: value: 7485
+                special.c:89: delay (priority 0) 7485 [38;5;8mgwa3x[0m
+          list.c:164: log_ptrs for 7484 [38;5;8mg3l2j[0m
+            list.c:170: ptr[0] = 7480 (skip delayed) [37;44m#abort[0m [38;5;8mbp4cp[0m
+            list.c:170: ptr[1] = 7481 (skip delayed) [37;44m#abort[0m [38;5;8mjrpr2[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7484
+        list.c:97: list: 7484
+          primitive/core.c:394: ap: 7480
+            special.c:74: value: 7485
+              var.c:80: var_create_list 7485 7486 0 1 0 0 [38;5;8mhgxsr[0m
+          primitive/core.c:153: seq: 7490
+            special.c:429: dep: 7488
+              special.c:466: placeholder: 7487
+                ir/trace.c:811: trace_alloc pull[2] size = 2 [38;5;8mppc88[0m
+                ir/trace.c:889: trace_store_expr: pull[2] <- placeholder 7487 7491 [38;5;8me59tk[0m
+                ir/trace.c:1259: updated var 7485 (pull[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mckrw9[0m
+                ir/trace.c:1259: updated var 7491 (pull[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mp3d4u[0m
+              ir/trace.c:811: trace_alloc pull[3] size = 1 [38;5;8mks7dm[0m
+              ir/trace.c:1132: trace_dep: 3 <- 7488 2[1] [38;5;8mp93x2[0m
+          list.c:164: log_ptrs for 7484 [38;5;8mnol5n[0m
+            list.c:168: ptr[0] = 7480 [38;5;8mie4ft[0m
+            list.c:168: ptr[1] = 7490 [38;5;8magpu6[0m
+        ir/trace.c:811: trace_alloc pull[4] size = 4 [38;5;8mc8tol[0m
+        ir/trace.c:1472: trace_return: pull[4] <- 7484 [38;5;8milqcx[0m
+        ir/trace.c:1534: branch 0 finished 7484 [38;5;8mn2mxd[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in pull [38;5;8mn5xvv[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull(394) [38;5;8mdiukb[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull(394) [38;5;8mn9cuh[0m
+ir/compile.c:691: compiling pull2 [38;5;8mga2dq[0m
+  ir/trace.c:811: trace_alloc pull2[1] size = 2 [38;5;8maxgnw[0m
+  ir/trace.c:1485: trace_reduce pull2 7503
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7503
+        list.c:97: list: 7503
+          primitive/core.c:394: ap: 7506
+            primitive/core.c:394: ap: 7509
+              primitive/core.c:397: compose ap 7509 7506 [38;5;8mlxvts[0m
+              special.c:74: value: 7505
+                special.c:89: delay (priority 0) 7505 [38;5;8mop3nb[0m
+          special.c:429: dep: 7507
+            primitive/core.c:394: ap: 7506
+              primitive/core.c:394: ap: 7509
+                primitive/core.c:397: compose ap 7509 7506 [38;5;8mjm7ul[0m
+                special.c:74: value: 7505
+                  special.c:89: delay (priority 0) 7505 [38;5;8mmfbn4[0m
+          special.c:429: dep: 7510
+            primitive/core.c:394: ap: 7509
+              special.c:74: value: 7505
+                special.c:89: delay (priority 0) 7505 [38;5;8mhcfve[0m
+          list.c:164: log_ptrs for 7503 [38;5;8mhfqtw[0m
+            list.c:170: ptr[0] = 7506 (skip delayed) [37;44m#abort[0m [38;5;8mb5876[0m
+            list.c:170: ptr[1] = 7507 (skip delayed) [37;44m#abort[0m [38;5;8mj7unf[0m
+            list.c:170: ptr[2] = 7510 (skip delayed) [37;44m#abort[0m [38;5;8mb9j6o[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7503
+        list.c:97: list: 7503
+          primitive/core.c:394: ap: 7506
+            primitive/core.c:394: ap: 7509
+              primitive/core.c:397: compose ap 7509 7506 [38;5;8mm93ck[0m
+              special.c:74: value: 7505
+                var.c:80: var_create_list 7505 7512 0 2 0 0 [38;5;8mpx653[0m
+          primitive/core.c:153: seq: 7520
+            special.c:429: dep: 7516
+              special.c:466: placeholder: 7514
+                ir/trace.c:811: trace_alloc pull2[2] size = 3 [38;5;8mflpnj[0m
+                ir/trace.c:889: trace_store_expr: pull2[2] <- placeholder 7514 7521 [38;5;8mk2mbv[0m
+                ir/trace.c:1259: updated var 7505 (pull2[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mig8fk[0m
+                ir/trace.c:1259: updated var 7521 (pull2[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mfvqi9[0m
+              ir/trace.c:811: trace_alloc pull2[3] size = 1 [38;5;8mapjrx[0m
+              ir/trace.c:1132: trace_dep: 3 <- 7516 2[1] [38;5;8mf6ggd[0m
+          primitive/core.c:153: seq: 7518
+            special.c:74: value: 7515
+              ir/trace.c:811: trace_alloc pull2[4] size = 1 [38;5;8mixu8e[0m
+              ir/trace.c:1132: trace_dep: 4 <- 7515 2[2] [38;5;8moersq[0m
+          list.c:164: log_ptrs for 7503 [38;5;8mltdwf[0m
+            list.c:168: ptr[0] = 7506 [38;5;8mgjsal[0m
+            list.c:168: ptr[1] = 7520 [38;5;8molhpu[0m
+            list.c:168: ptr[2] = 7518 [38;5;8mgm687[0m
+        ir/trace.c:811: trace_alloc pull2[5] size = 5 [38;5;8mjfa2m[0m
+        ir/trace.c:1472: trace_return: pull2[5] <- 7503 [38;5;8mor7m2[0m
+        ir/trace.c:1534: branch 0 finished 7503 [38;5;8md84be[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in pull2 [38;5;8mece9w[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull2(399) [38;5;8mjpbuc[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull2(399) [38;5;8mefp8i[0m
+ir/compile.c:691: compiling pull3 [38;5;8mmhfnr[0m
+  ir/trace.c:811: trace_alloc pull3[1] size = 2 [38;5;8mg7txx[0m
+  ir/trace.c:1485: trace_reduce pull3 7537
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7537
+        list.c:97: list: 7537
+          primitive/core.c:394: ap: 7540
+            primitive/core.c:394: ap: 7543
+              primitive/core.c:397: compose ap 7543 7540 [38;5;8mb8c7t[0m
+              special.c:74: value: 7539
+                special.c:89: delay (priority 0) 7539 [38;5;8mewgxc[0m
+          special.c:429: dep: 7541
+            primitive/core.c:394: ap: 7540
+              primitive/core.c:394: ap: 7543
+                primitive/core.c:397: compose ap 7543 7540 [38;5;8mptk8m[0m
+                special.c:74: value: 7539
+                  special.c:89: delay (priority 0) 7539 [38;5;8mclox5[0m
+          special.c:429: dep: 7544
+            primitive/core.c:394: ap: 7543
+              special.c:74: value: 7539
+                special.c:89: delay (priority 0) 7539 [38;5;8mnis9f[0m
+          special.c:429: dep: 7545
+            primitive/core.c:394: ap: 7543
+              special.c:74: value: 7539
+                special.c:89: delay (priority 0) 7539 [38;5;8mk4qbm[0m
+          list.c:164: log_ptrs for 7537 [38;5;8mk7498[0m
+            list.c:170: ptr[0] = 7540 (skip delayed) [37;44m#abort[0m [38;5;8mfujke[0m
+            list.c:170: ptr[1] = 7541 (skip delayed) [37;44m#abort[0m [38;5;8mnv83n[0m
+            list.c:170: ptr[2] = 7544 (skip delayed) [37;44m#abort[0m [38;5;8mfxuiw[0m
+            list.c:170: ptr[3] = 7545 (skip delayed) [37;44m#abort[0m [38;5;8mn3jx9[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7537
+        list.c:97: list: 7537
+          primitive/core.c:394: ap: 7540
+            primitive/core.c:394: ap: 7543
+              primitive/core.c:397: compose ap 7543 7540 [38;5;8mi3275[0m
+              special.c:74: value: 7539
+                var.c:80: var_create_list 7539 7547 0 3 0 0 [38;5;8mlr6xk[0m
+          primitive/core.c:153: seq: 7557
+            special.c:429: dep: 7552
+              special.c:466: placeholder: 7549
+                ir/trace.c:811: trace_alloc pull3[2] size = 4 [38;5;8mbfpi4[0m
+                ir/trace.c:889: trace_store_expr: pull3[2] <- placeholder 7549 7558 [38;5;8mgsl7g[0m
+                ir/trace.c:1259: updated var 7539 (pull3[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mea8a5[0m
+                ir/trace.c:1259: updated var 7558 (pull3[2]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mbpqeq[0m
+              ir/trace.c:811: trace_alloc pull3[3] size = 1 [38;5;8mmjjni[0m
+              ir/trace.c:1132: trace_dep: 3 <- 7552 2[1] [38;5;8mbwgbu[0m
+          primitive/core.c:153: seq: 7555
+            special.c:74: value: 7551
+              ir/trace.c:811: trace_alloc pull3[4] size = 1 [38;5;8meru3v[0m
+              ir/trace.c:1132: trace_dep: 4 <- 7551 2[2] [38;5;8mj8rob[0m
+          primitive/core.c:153: seq: 7554
+            special.c:74: value: 7550
+              ir/trace.c:811: trace_alloc pull3[5] size = 1 [38;5;8mm4agc[0m
+              ir/trace.c:1132: trace_dep: 5 <- 7550 2[3] [38;5;8mcg64o[0m
+          list.c:164: log_ptrs for 7537 [38;5;8mpvo8d[0m
+            list.c:168: ptr[0] = 7540 [38;5;8mkl7ij[0m
+            list.c:168: ptr[1] = 7557 [38;5;8mcnsxs[0m
+            list.c:168: ptr[2] = 7555 [38;5;8mkpig5[0m
+            list.c:168: ptr[3] = 7554 [38;5;8mcq7we[0m
+        ir/trace.c:811: trace_alloc pull3[6] size = 6 [38;5;8mfjbpt[0m
+        ir/trace.c:1472: trace_return: pull3[6] <- 7537 [38;5;8mkv8d9[0m
+        ir/trace.c:1534: branch 0 finished 7537 [38;5;8mac42l[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in pull3 [38;5;8magfw7[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull3(406) [38;5;8mftclj[0m
+  ir/analysis.c:519: calculate_bit_width stack.pull3(406) [38;5;8majqvp[0m
+ir/compile.c:691: compiling swap2 [38;5;8milge2[0m
+  ir/trace.c:811: trace_alloc swap2[1] size = 2 [38;5;8mdbuo8[0m
+  ir/trace.c:811: trace_alloc swap2[2] size = 2 [38;5;8miordk[0m
+  ir/trace.c:811: trace_alloc swap2[3] size = 2 [38;5;8mn5nxw[0m
+  ir/trace.c:1485: trace_reduce swap2 7584
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7584
+        list.c:97: list: 7584
+          special.c:429: dep: 7590
+            primitive/core.c:394: ap: 7589
+              primitive/core.c:394: ap: 7577
+                primitive/core.c:397: compose ap 7577 7589 [38;5;8mdslh2[0m
+                primitive/core.c:394: compose: 7576
+                  primitive/core.c:397: compose ap 7576 7577 [38;5;8mdvwgk[0m
+          primitive/core.c:153: seq: 7603
+            primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 7603 [38;5;8ml4wuf[0m
+          special.c:74: value: 7588
+            special.c:89: delay (priority 0) 7588 [38;5;8mjjix4[0m
+          primitive/core.c:153: seq: 7602
+            primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 7602 [38;5;8mjmtwm[0m
+          special.c:74: value: 7586
+            special.c:89: delay (priority 0) 7586 [38;5;8mg5f4b[0m
+          primitive/core.c:153: seq: 7601
+            primitive/core.c:170: [0mTWEAK(1)[0m to keep seq 7601 [38;5;8mg8q2t[0m
+          special.c:74: value: 7587
+            special.c:89: delay (priority 0) 7587 [38;5;8menc6i[0m
+          list.c:164: log_ptrs for 7584 [38;5;8mj39qu[0m
+            list.c:168: ptr[0] = 7588 [38;5;8meqn44[0m
+            list.c:168: ptr[1] = 7586 [38;5;8mmsdkd[0m
+            list.c:168: ptr[2] = 7587 [38;5;8met23m[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7584
+        list.c:97: list: 7584
+          list.c:164: log_ptrs for 7584 [38;5;8mpq7aw[0m
+            list.c:168: ptr[0] = 7588 [38;5;8mkhlk6[0m
+            list.c:168: ptr[1] = 7586 [38;5;8mcja4f[0m
+            list.c:168: ptr[2] = 7587 [38;5;8mkkwjo[0m
+        ir/trace.c:811: trace_alloc swap2[4] size = 5 [38;5;8mnc4c7[0m
+        ir/trace.c:1472: trace_return: swap2[4] <- 7584 [38;5;8mcpwxj[0m
+        ir/trace.c:1534: branch 0 finished 7584 [38;5;8mh6tlv[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in swap2 [38;5;8mh98kh[0m
+  ir/analysis.c:519: calculate_bit_width stack.swap2(414) [38;5;8mnm48t[0m
+  ir/analysis.c:519: calculate_bit_width stack.swap2(414) [38;5;8midji3[0m
+ir/compile.c:691: compiling dip11 [38;5;8mae82c[0m
+  ir/trace.c:811: trace_alloc dip11[1] size = 2 [38;5;8mk5nci[0m
+  ir/trace.c:811: trace_alloc dip11[2] size = 2 [38;5;8maijwu[0m
+  ir/trace.c:811: trace_alloc dip11[3] size = 2 [38;5;8mfvgla[0m
+  ir/trace.c:1485: trace_reduce dip11 7623
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7623
+        list.c:97: list: 7623
+          special.c:429: dep: 7617
+            primitive/core.c:394: ap: 7615
+              primitive/core.c:394: compose: 7614
+                primitive/core.c:397: compose ap 7614 7615 [38;5;8mlmd5c[0m
+                special.c:74: value: 7624
+                  special.c:89: delay (priority 0) 7624 [38;5;8moehur[0m
+          special.c:429: dep: 7616
+            primitive/core.c:394: ap: 7615
+              primitive/core.c:394: compose: 7614
+                primitive/core.c:397: compose ap 7614 7615 [38;5;8mgmta8[0m
+                special.c:74: value: 7624
+                  special.c:89: delay (priority 0) 7624 [38;5;8mjew4n[0m
+          list.c:164: log_ptrs for 7623 [38;5;8mgti8c[0m
+            list.c:170: ptr[0] = 7617 (skip delayed) [37;44m#abort[0m [38;5;8mbjxii[0m
+            list.c:170: ptr[1] = 7616 (skip delayed) [37;44m#abort[0m [38;5;8mjlmxr[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7623
+        list.c:97: list: 7623
+          special.c:429: dep: 7617
+            primitive/core.c:394: ap: 7615
+              primitive/core.c:394: compose: 7614
+                primitive/core.c:397: compose ap 7614 7615 [38;5;8mpckht[0m
+                special.c:74: value: 7624
+                  var.c:80: var_create_list 7624 7629 1 1 0 0 [38;5;8mb4obc[0m
+          primitive/core.c:153: seq: 7640
+            special.c:429: dep: 7635
+              special.c:466: placeholder: 7634
+                ir/trace.c:811: trace_alloc dip11[4] size = 3 [38;5;8me3hxv[0m
+                ir/trace.c:889: trace_store_expr: dip11[4] <- placeholder 7634 7641 [38;5;8mkgemb[0m
+                ir/trace.c:1259: updated var 7624 (dip11[1]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mhuwpw[0m
+                ir/trace.c:1259: updated var 7641 (dip11[4]) to T_LIST[-9223372036854775808, 9223372036854775807] [38;5;8mfditl[0m
+              ir/trace.c:811: trace_alloc dip11[5] size = 1 [38;5;8mp7b6d[0m
+              ir/trace.c:1132: trace_dep: 5 <- 7635 4[2] [38;5;8mfj8qp[0m
+          list.c:164: log_ptrs for 7623 [38;5;8mc2que[0m
+            list.c:168: ptr[0] = 7639 [38;5;8mno88k[0m
+            list.c:168: ptr[1] = 7640 [38;5;8mfqunt[0m
+        ir/trace.c:811: trace_alloc dip11[6] size = 4 [38;5;8mii2hc[0m
+        ir/trace.c:1472: trace_return: dip11[6] <- 7623 [38;5;8mnvu5o[0m
+        ir/trace.c:1534: branch 0 finished 7623 [38;5;8mdcrp4[0m
+  ir/compile.c:582: [0mTWEAK(1)[0m to disable condense/move_vars in dip11 [38;5;8mdf6om[0m
+  ir/analysis.c:519: calculate_bit_width control.dip11(420) [38;5;8mis3c2[0m
+  ir/analysis.c:519: calculate_bit_width control.dip11(420) [38;5;8mdjhm8[0m
+ir/compile.c:691: compiling pull4 [38;5;8mlk66h[0m
+  ir/trace.c:811: trace_alloc pull4[1] size = 2 [38;5;8mgblgn[0m
+  ir/trace.c:1485: trace_reduce pull4 7682
+    ir/trace.c:1491: priority = 0
+      ir/trace.c:1495: branch 0: 7682
+        list.c:97: list: 7682
+          primitive/core.c:394: ap: 7685
+            primitive/core.c:394: ap: 7688
+              primitive/core.c:397: compose ap 7688 7685 [38;5;8mbb4mj[0m
+              special.c:74: value: 7684
+                special.c:89: delay (priority 0) 7684 [38;5;8md38f2[0m
+          special.c:429: dep: 7686
+            primitive/core.c:394: ap: 7685
+              primitive/core.c:394: ap: 7688
+                primitive/core.c:397: compose ap 7688 7685 [38;5;8moxcnc[0m
+                special.c:74: value: 7684
+                  special.c:89: delay (priority 0) 7684 [38;5;8mbpggr[0m
+          special.c:429: dep: 7689
+            primitive/core.c:394: ap: 7688
+              special.c:74: value: 7684
+                special.c:89: delay (priority 0) 7684 [38;5;8mmmkn5[0m
+          special.c:429: dep: 7690
+            primitive/core.c:394: ap: 7688
+              special.c:74: value: 7684
+                special.c:89: delay (priority 0) 7684 [38;5;8mj8hqc[0m
+          special.c:429: dep: 7691
+            primitive/core.c:394: ap: 7688
+              special.c:74: value: 7684
+                special.c:89: delay (priority 0) 7684 [38;5;8mhqesj[0m
+          list.c:164: log_ptrs for 7682 [38;5;8mhtpq5[0m
+            list.c:170: ptr[0] = 7685 (skip delayed) [37;44m#abort[0m [38;5;8mcj75b[0m
+            list.c:170: ptr[1] = 7686 (skip delayed) [37;44m#abort[0m [38;5;8mkltkk[0m
+            list.c:170: ptr[2] = 7689 (skip delayed) [37;44m#abort[0m [38;5;8mcni3t[0m
+            list.c:170: ptr[3] = 7690 (skip delayed) [37;44m#abort[0m [38;5;8mko8i6[0m
+            list.c:170: ptr[4] = 7691 (skip delayed) [37;44m#abort[0m [38;5;8mcqt2f[0m
+    ir/trace.c:1491: priority = 1
+      ir/trace.c:1495: branch 0: 7682
+        list.c:97: list: 7682
+          primitive/core.c:394: ap: 7685
+            primitive/core.c:394: ap: 7688
+              primitive/core.c:397: compose ap 7688 7685 [38;5;8mnrc8b[0m
+              special.c:74: value: 7684
+                [37;41m!!![0m rt.c:691: arg: Assertion `!closure_is_ready(c)' failed:  [38;5;8majgxq[0m
+
+MAIN(tests_quadratic)
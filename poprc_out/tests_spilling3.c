@@ -0,0 +1,21 @@
+#include "cgen/main.h"
+
+array tests_spilling3(symbol_t sym1, array *out_lst0, array *out_lst1);
+
+array tests_spilling3(symbol_t sym1, array *out_lst0, array *out_lst1)
+{
+  symbol_t sym3;
+
+entry: {
+  symbol_t sym2 = __primitive_not_yy(sym1);
+  sym3 = __primitive_not_yy(sym2);
+  array lst4 = __primitive_quote0_ly(sym3);
+  array lst5 = __primitive_quote0_ly(sym3);
+  array lst6 = __primitive_quote0_ly(sym3);
+  if(out_lst0) *out_lst0 = lst5;
+  if(out_lst1) *out_lst1 = lst4;
+  return lst6;
+}
+} // end tests_spilling3
+
+MAIN(tests_spilling3)
@@ -38,28 +38,31 @@ range_t infer_bound(range_t (*range_op)(range_t, range_t),
   return range_op(get_range(x), get_range(y));
 }
 
+// constant results are built in imm, see imm_val()
 cell_t *_op2(cell_t *c, type_t arg_type, type_t res_type,
              val_t (*op)(val_t, val_t), range_t (*range_op)(range_t, range_t),
-             cell_t *x, cell_t *y) {
+             cell_t *x, cell_t *y, cell_t *imm) {
   if(ANY(is_var, x, y)) {
     cell_t *v = var(res_type, c);
     v->value.range = infer_bound(range_op, x, y);
     return v;
   } else {
-    return val(res_type, op(arg_type == T_INT ? x->value.integer : x->value.symbol,
-                            arg_type == T_INT ? y->value.integer : y->value.symbol));
+    return imm_val(imm, res_type,
+                   op(arg_type == T_INT ? x->value.integer : x->value.symbol,
+                      arg_type == T_INT ? y->value.integer : y->value.symbol));
   }
 }
 
 cell_t *_op1(cell_t *c, type_t arg_type, type_t res_type,
-             val_t (*op)(val_t), cell_t *x) {
+             val_t (*op)(val_t), cell_t *x, cell_t *imm) {
   assert_error(ONEOF(arg_type, T_INT, T_SYMBOL));
   if(is_var(x)) {
     return var(res_type, c);
   } else {
-    return val(res_type, op(arg_type == T_INT ?
-                            x->value.integer :
-                            x->value.symbol));
+    return imm_val(imm, res_type,
+                   op(arg_type == T_INT ?
+                      x->value.integer :
+                      x->value.symbol));
   }
 }
 
@@ -225,7 +228,7 @@ response func_op2(cell_t **cp, context_t *ctx,
                   bool nonzero,
                   bool (*bound_contexts)(cell_t *, context_t *, context_t *),
                   cell_t *(*identity)(cell_t *, cell_t *)) {
-  cell_t *res = 0;
+  cell_t *res = 0, imm;
   PRE(op2);
 
   CHECK_IF(!check_type(ctx->t, res_type), FAIL);
@@ -253,7 +256,7 @@ response func_op2(cell_t **cp, context_t *ctx,
       ABORT(RETRY);
     }
   } else {
-    res = _op2(c, arg_type, res_type, op, range_op, p, q);
+    res = _op2(c, arg_type, res_type, op, range_op, p, q, &imm);
     if(nonzero) FLAG_SET(*c, expr, PARTIAL);
   }
   add_conditions(res, p, q);
@@ -267,7 +270,7 @@ response func_op2(cell_t **cp, context_t *ctx,
 response func_op1(cell_t **cp, context_t *ctx,
                   int arg_type, int res_type,
                   val_t (*op)(val_t), val_t (*inv_op)(val_t)) {
-  cell_t *res = 0;
+  cell_t *res = 0, imm;
   PRE(op1);
 
   CHECK_IF(!check_type(ctx->t, res_type), FAIL);
@@ -276,7 +279,7 @@ response func_op1(cell_t **cp, context_t *ctx,
   CHECK_DELAY();
   ARGS(p);
 
-  res = _op1(c, arg_type, res_type, op, p);
+  res = _op1(c, arg_type, res_type, op, p, &imm);
   add_conditions(res, p);
   store_reduced(cp, ctx, res);
   return SUCCESS;
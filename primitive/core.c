@@ -74,10 +74,11 @@ OP(alt) {
   PRE(alt);
   alt_set_t as0 = 0, as1 = 0;
   if(!is_linear(ctx)) {
-    uint8_t a = new_alt_id(1);
+    unsigned int a = new_alt_id(1);
     as0 = as_single(a, 0);
     as1 = as_single(a, 1);
   }
+  alt_fork(c, ctx);
   cell_t *r1 = set_alt(c->expr.arg[1], as1, c->alt);
   cell_t *r0 = set_alt(c->expr.arg[0], as0, r1);
   store_lazy(cp, r0, 0);
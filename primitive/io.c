@@ -16,10 +16,13 @@
 */
 
 #include <string.h>
+#include <stdlib.h>
+#include <time.h>
 
 #include "rt_types.h"
 
 #include "startle/error.h"
+#include "startle/test.h"
 #include "startle/support.h"
 #include "startle/log.h"
 #include "startle/static_alloc.h"
@@ -209,19 +212,83 @@ OP(read) {
 #define ADDR_BITS (KEY_BITS - ID_BITS)
 #define ADDR_MASK ((1l << ADDR_BITS) - 1)
 #define ID_MAX ((1l << ID_BITS) - 1)
-static MAP(arrays, 1 << 16);
+static THREAD_LOCAL HMAP(arrays, 1 << 17);
 
-val_t next_array_id = 1;
+THREAD_LOCAL val_t next_array_id = 1;
 
 STATIC_ALLOC(mmap_array, mmap_array_t, 8);
-static unsigned int mmap_array_count = 0;
+static THREAD_LOCAL unsigned int mmap_array_count = 0;
+
+// Dense arrays
+// Elements of the first arrays are stored densely by address, as long as
+// at least 1/ARRAY_DENSE_RATIO of the storage is used.
+// Other elements are kept in `arrays`.
+#define ARRAY_DENSE_MIN 256
+#define ARRAY_DENSE_RATIO 4
+
+typedef struct {
+  val_t *data;
+  uint8_t *written; // bitset of valid elements
+  size_t size; // elements allocated
+  size_t cnt; // elements written to data
+  size_t sparse_cnt; // elements written to `arrays`
+} dense_array_t;
+
+static THREAD_LOCAL dense_array_t dense_arrays[64];
+
+static
+uintptr_t array_key(uintptr_t arr, uintptr_t addr) {
+  return arr << ADDR_BITS | addr;
+}
 
 void array_init() {
-  map_clear(arrays);
+  FOREACH(i, dense_arrays) {
+    dense_array_t *da = &dense_arrays[i];
+    if(da->cnt) memset(da->written, 0, da->size / 8);
+    da->cnt = 0;
+    da->sparse_cnt = 0;
+  }
+  hmap_clear(arrays);
   next_array_id = 1;
   mmap_array_count = 0;
 }
 
+static
+dense_array_t *lookup_dense_array(uintptr_t arr) {
+  return arr < LENGTH(dense_arrays) ? &dense_arrays[arr] : NULL;
+}
+
+// grow da to hold addr if it would be dense enough
+static
+bool dense_array_fit(dense_array_t *da, uintptr_t arr, uintptr_t addr) {
+  if(addr < da->size) return true;
+  size_t n = max(ARRAY_DENSE_MIN, (size_t)1 << int_log2l(addr + 1));
+  if(n > ARRAY_DENSE_MIN &&
+     n > ARRAY_DENSE_RATIO * (da->cnt + da->sparse_cnt + 1)) return false;
+  val_t *data = realloc(da->data, n * sizeof(val_t));
+  assert_throw(data, "could not grow dense array %d", (int)arr);
+  da->data = data;
+  uint8_t *written = realloc(da->written, n / 8);
+  assert_throw(written, "could not grow dense array %d", (int)arr);
+  da->written = written;
+  memset(da->written + da->size / 8, 0, (n - da->size) / 8);
+
+  // move elements from `arrays`
+  for(size_t i = da->size; da->sparse_cnt && i < n; i++) {
+    uintptr_t key = array_key(arr, i);
+    pair_t *p = hmap_find(arrays, key);
+    if(p) {
+      da->data[i] = p->second;
+      set_bit(da->written, i);
+      hmap_remove(arrays, key);
+      da->cnt++;
+      da->sparse_cnt--;
+    }
+  }
+  da->size = n;
+  return true;
+}
+
 static
 mmap_array_t *lookup_mmap_array(uintptr_t arr) {
   COUNTUP(i, mmap_array_count) {
@@ -250,7 +317,13 @@ bool array_read(uintptr_t arr, uintptr_t addr, val_t *out) {
   if(!ma) {
     addr &= ADDR_MASK;
     if(!INRANGE(arr, 1, ID_MAX)) return false;
-    pair_t *p = map_find(arrays, arr << 16 | addr);
+    dense_array_t *da = lookup_dense_array(arr);
+    if(da && addr < da->size) {
+      if(!check_bit(da->written, addr)) return false;
+      *out = da->data[addr];
+      return true;
+    }
+    pair_t *p = hmap_find(arrays, array_key(arr, addr));
     if(!p) return false;
     *out = p->second;
     return true;
@@ -269,7 +342,18 @@ bool array_write(uintptr_t arr, uintptr_t addr, val_t in) {
   if(!ma) {
     addr &= ADDR_MASK;
     if(!INRANGE(arr, 1, ID_MAX)) return false;
-    map_replace_insert(arrays, (pair_t) {arr << 16 | addr, in});
+    dense_array_t *da = lookup_dense_array(arr);
+    if(da && dense_array_fit(da, arr, addr)) {
+      if(!check_bit(da->written, addr)) {
+        set_bit(da->written, addr);
+        da->cnt++;
+      }
+      da->data[addr] = in;
+      return true;
+    }
+    size_t cnt = *map_cnt(arrays);
+    if(!hmap_replace_insert(arrays, (pair_t) {array_key(arr, addr), in})) return false;
+    if(da) da->sparse_cnt += *map_cnt(arrays) - cnt;
     return true;
   } else {
     if(!FLAG(*ma, file, OUT)) return false;
@@ -280,6 +364,68 @@ bool array_write(uintptr_t arr, uintptr_t addr, val_t in) {
   }
 }
 
+TEST(array) {
+  array_init();
+  uintptr_t sparse = LENGTH(dense_arrays);
+  val_t x;
+  int ret = 0;
+  if(array_read(1, 5, &x)) ret = -1;
+
+  // high addresses are sparse at first
+  COUNTUP(i, 40000) {
+    if(!array_write(1, i * 4 % 100003, i) ||
+       !array_write(sparse, i * 4 % 100003, i)) ret = -2;
+  }
+
+  // now dense enough to move everything into dense storage
+  array_write(1, 100002, 0);
+  if(dense_arrays[1].sparse_cnt ||
+     dense_arrays[1].size != 1 << 17) ret = -3;
+  COUNTUP(i, 40000) {
+    val_t y;
+    if(!array_read(1, i * 4 % 100003, &x) ||
+       !array_read(sparse, i * 4 % 100003, &y) ||
+       x != (val_t)i || y != (val_t)i) ret = -4;
+  }
+  if(array_read(1, 2, &x) || array_read(sparse, 2, &x)) ret = -5;
+  array_init();
+  if(array_read(1, 0, &x)) ret = -6;
+  return ret;
+}
+
+// random reads and writes to a dense and a sparse array
+TEST(bench_array) {
+  const int n = 1000000;
+  const uintptr_t span = 1 << 16;
+  uintptr_t arrs[] = {1, LENGTH(dense_arrays)};
+  val_t sums[LENGTH(arrs)];
+  clock_t times[LENGTH(arrs)];
+  FOREACH(j, arrs) {
+    array_init();
+    uint32_t seed = 1;
+    val_t sum = 0;
+    clock_t start = clock();
+    COUNTUP(i, n) {
+      seed = seed * 1103515245 + 12345;
+      uintptr_t addr = (seed >> 8) % span;
+      val_t x;
+      if(seed & 0x80) {
+        array_write(arrs[j], addr, i);
+      } else if(array_read(arrs[j], addr, &x)) {
+        sum += x;
+      }
+    }
+    times[j] = clock() - start;
+    sums[j] = sum;
+  }
+  array_init();
+  printf("bench_array: %d random reads/writes: dense %.3f sec, sparse %.3f sec\n",
+          n,
+          times[0] / (double)CLOCKS_PER_SEC,
+          times[1] / (double)CLOCKS_PER_SEC);
+  return sums[0] == sums[1] ? 0 : -1;
+}
+
 WORD("read_array", read_array, 2, 2)
 OP(read_array) {
   cell_t *res = 0;
@@ -84,7 +84,7 @@ OP(eq_str) {
   return abort_op(rsp, cp, ctx);
 }
 
-static char tmp_string_buf[1024];
+static THREAD_LOCAL char tmp_string_buf[1024];
 
 seg_t int_to_string(uintptr_t x) {
   int n = snprintf(tmp_string_buf, sizeof(tmp_string_buf), "%lld", (long long)x);
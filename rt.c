@@ -15,10 +15,23 @@
     along with PoprC.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#define _GNU_SOURCE
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <signal.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#include <ucontext.h>
+#endif
+#ifdef THREAD_LOCAL_STATE
+#include <pthread.h>
+#endif
 #include "rt_types.h"
 
 #include "startle/error.h"
@@ -46,23 +59,24 @@
 #include "primitive/string.h"
 #include "var.h"
 #include "mutate.h"
+#include "parameters.h"
 
 #if INTERFACE
 #define MAX_ALTS 256
-#define MAX_CALL_DEPTH 255
+#define MAX_CALL_DEPTH 255 // used if the stack size is unknown
 #endif
 
 // Counter of used alt ids
-uint8_t alt_cnt = 0;
+THREAD_LOCAL unsigned int alt_cnt = 0;
 
 STATIC_ALLOC(rt_roots, cell_t **, 257);
 
 STATIC_ALLOC(watched_cells, cell_t *, 4);
-static op watched_op = OP_null;
-bool watch_enabled = false;
+static THREAD_LOCAL op watched_op = OP_null;
+THREAD_LOCAL bool watch_enabled = false;
 
 STATIC_ALLOC(fail_location, seg_t, 64);
-size_t fail_location_n = 0;
+THREAD_LOCAL size_t fail_location_n = 0;
 
 #if INTERFACE
 #define ASSERT_REF() if(ctx->priority > PRIORITY_SIMPLIFY) assert_error(assert_ref(rt_roots, rt_roots_size))
@@ -109,21 +123,377 @@ int get_watch(const cell_t *c) {
   return 0;
 }
 
+// Reduction recurses on the C stack. When the stack runs low, reduce() continues
+// on a new stack segment from the heap, so nesting depth is limited only by memory.
+// Segments are kept for reuse, and an error is caught on the segment it was thrown on,
+// then thrown again from the stack that switched to it.
+#if defined(__linux__)
+#define STACK_SEGMENTS
+#endif
+#define STACK_RESERVE ((size_t)256 << 10) // left for everything else
+#define STACK_SEGMENT_SIZE ((size_t)8 << 20)
+#define STACK_DEFAULT_SIZE ((size_t)8 << 20) // if the size of the stack is unlimited
+
+typedef struct stack_segment stack_segment_t;
+struct stack_segment {
+  stack_segment_t *next; // used from this one
+  uintptr_t lo, hi;
+#ifdef STACK_SEGMENTS
+  ucontext_t uc, ret;
+#endif
+  cell_t **cp;
+  context_t *ctx;
+  response rsp;
+  bool failed;
+  error_type_t error;
+};
+
+static THREAD_LOCAL uintptr_t thread_stack_lo = 0, thread_stack_hi = 0;
+static THREAD_LOCAL uintptr_t stack_lo = 0, stack_hi = 0; // the stack in use
+static THREAD_LOCAL stack_segment_t *stack_segments = NULL;
+
+// call with the address of something near the base of the stack
+void stack_init(void *base) {
+  size_t size = 0;
+#if defined(THREAD_LOCAL_STATE) && defined(__linux__)
+  // threads may have any size of stack
+  pthread_attr_t attr;
+  if(!pthread_getattr_np(pthread_self(), &attr)) {
+    void *addr;
+    if(!pthread_attr_getstack(&attr, &addr, &size)) {
+      base = (char *)addr + size;
+    }
+    pthread_attr_destroy(&attr);
+  }
+#endif
+  if(!size) {
+    struct rlimit rl;
+    if(getrlimit(RLIMIT_STACK, &rl)) return;
+    size = rl.rlim_cur == RLIM_INFINITY ? STACK_DEFAULT_SIZE : rl.rlim_cur;
+  }
+  if(size > STACK_RESERVE * 2) {
+    thread_stack_hi = (uintptr_t)base;
+    thread_stack_lo = thread_stack_hi - size;
+    stack_lo = thread_stack_lo;
+    stack_hi = thread_stack_hi;
+  }
+}
+
+// find the stack containing sp, after an error jumped back to another stack
+static
+void stack_locate(uintptr_t sp) {
+  stack_lo = thread_stack_lo;
+  stack_hi = thread_stack_hi;
+  FOLLOW(s, stack_segments, next) {
+    if(sp >= s->lo && sp < s->hi) {
+      stack_lo = s->lo;
+      stack_hi = s->hi;
+      break;
+    }
+  }
+}
+
+// is there enough stack left to go deeper?
+bool stack_available(context_t *ctx) {
+  if(!stack_hi) return ctx->depth < MAX_CALL_DEPTH;
+  uintptr_t sp = (uintptr_t)&ctx;
+  if(sp < stack_lo || sp >= stack_hi) stack_locate(sp);
+  return sp - stack_lo > STACK_RESERVE;
+}
+
+#ifdef STACK_SEGMENTS
+static THREAD_LOCAL stack_segment_t *stack_entering = NULL;
+
+static
+void stack_segment_run() {
+  stack_segment_t *s = stack_entering;
+  error_t error;
+  CATCH(&error, current_error && current_error->quiet) {
+    s->failed = true;
+    s->error = error.type;
+  } else {
+    s->rsp = reduce(s->cp, s->ctx);
+  }
+}
+
+// the segment to use after the current one
+static
+stack_segment_t *stack_segment_next() {
+  uintptr_t sp = (uintptr_t)&sp;
+  stack_segment_t **p = &stack_segments;
+  FOLLOW(s, stack_segments, next) {
+    if(sp >= s->lo && sp < s->hi) {
+      p = &s->next;
+      break;
+    }
+  }
+  if(!*p) {
+    stack_segment_t *s = calloc(1, sizeof(stack_segment_t));
+    void *mem = mmap(NULL, STACK_SEGMENT_SIZE,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                     -1, 0);
+    if(!s || mem == MAP_FAILED) {
+      free(s);
+      return NULL;
+    }
+    mprotect(mem, sysconf(_SC_PAGESIZE), PROT_NONE); // guard page
+    s->lo = (uintptr_t)mem;
+    s->hi = s->lo + STACK_SEGMENT_SIZE;
+    *p = s;
+  }
+  return *p;
+}
+#endif
+
+// continue reduce() on a new stack segment
+static
+response reduce_on_new_stack(cell_t **cp, context_t *ctx) {
+#ifdef STACK_SEGMENTS
+  stack_segment_t *s = stack_segment_next();
+  assert_throw(s, "stack too deep (%d) %C", ctx->depth, *cp);
+  uintptr_t lo = stack_lo, hi = stack_hi;
+  s->cp = cp;
+  s->ctx = ctx;
+  s->failed = false;
+  getcontext(&s->uc);
+  s->uc.uc_stack.ss_sp = (void *)s->lo;
+  s->uc.uc_stack.ss_size = s->hi - s->lo;
+  s->uc.uc_link = &s->ret;
+  makecontext(&s->uc, stack_segment_run, 0);
+  stack_entering = s;
+  stack_lo = s->lo;
+  stack_hi = s->hi;
+  swapcontext(&s->ret, &s->uc);
+  stack_lo = lo;
+  stack_hi = hi;
+  if(s->failed) return_error(s->error);
+  return s->rsp;
+#else
+  throw_error(ERROR_TYPE_UNEXPECTED, "stack too deep (%d) %C", ctx->depth, *cp);
+#endif
+}
+
+// free the stack segments, e.g. when a thread exits
+void stack_free() {
+  FOLLOW(s, stack_segments, next) {
+    munmap((void *)s->lo, s->hi - s->lo);
+  }
+  while(stack_segments) {
+    stack_segment_t *s = stack_segments;
+    stack_segments = s->next;
+    free(s);
+  }
+}
+
 // Initialize run time
 void rt_init() {
   alt_cnt = 0;
+  as_reset();
   memset(rt_roots, 0, static_sizeof(rt_roots));
   clear_ptr_tags();
   reset_counters();
   array_init();
   clear_fail_log();
   done_with_tmp();
+  drop_flush();
+  alt_fork_kill();
 }
 
 void clear_fail_log() {
   fail_location_n = 0;
 }
 
+#define ALT_MAX_JOBS 64
+
+PARAMETER(alt_jobs, int, 1, "worker processes for exploring alternatives (`|`)") {
+  alt_jobs = clamp(1, ALT_MAX_JOBS, arg);
+}
+
+// Workers forked by this process, oldest first. Each reduces the right branch
+// of a root `|`, which is replaced here by a forked placeholder, so the worker's
+// results follow those of this process in the order of a sequential evaluation.
+static pid_t alt_worker_pid[ALT_MAX_JOBS];
+static int alt_worker_fd[ALT_MAX_JOBS];
+static cell_t *alt_worker_cell[ALT_MAX_JOBS]; // the placeholder, not referenced
+static int alt_workers = 0;
+static THREAD_LOCAL int alt_fork_budget = 0; // workers this process and its workers may fork
+THREAD_LOCAL int alt_fork_results = -1; // root results so far, or -1 if not reducing the root
+bool alt_worker = false;
+bool alt_worker_failed = false; // a worker printed an error
+static bool alt_worker_retry = false; // a worker needs the first result
+
+#if INTERFACE
+#define ALT_WORKER_RETRY 2 // exit status
+#endif
+
+// collected output of the workers
+static char *alt_fork_out = NULL;
+static size_t alt_fork_out_n = 0;
+
+static
+void alt_worker_remove(int i) {
+  close(alt_worker_fd[i]);
+  kill(alt_worker_pid[i], SIGKILL);
+  waitpid(alt_worker_pid[i], NULL, 0);
+  alt_workers--;
+  RANGEUP(j, i, alt_workers) {
+    alt_worker_pid[j] = alt_worker_pid[j + 1];
+    alt_worker_fd[j] = alt_worker_fd[j + 1];
+    alt_worker_cell[j] = alt_worker_cell[j + 1];
+  }
+}
+
+// stop workers left over from an evaluation, discarding their output
+void alt_fork_kill() {
+  while(alt_workers) alt_worker_remove(alt_workers - 1);
+  free(alt_fork_out);
+  alt_fork_out = NULL;
+  alt_fork_out_n = 0;
+}
+
+// allow the next evaluation to fork up to alt_jobs - 1 workers
+void alt_fork_start() {
+  alt_fork_kill();
+  alt_fork_budget = alt_jobs - 1;
+  alt_worker_failed = false;
+  alt_worker_retry = false;
+}
+
+// stop forking, e.g. after an error
+void alt_fork_stop() {
+  alt_fork_kill();
+  alt_fork_budget = 0;
+  alt_worker_failed = false;
+  alt_worker_retry = false;
+}
+
+// alternatives tested by unless don't reach the root
+static
+bool alt_reaches_root(context_t *ctx) {
+  while((ctx = ctx->up)) {
+    if(ctx->src && ctx->src->op == OP_unless) return false;
+  }
+  return true;
+}
+
+// Fork a worker at a root `|` c, if there is budget left.
+// This process keeps the left branch and the worker the right one,
+// each replacing the other branch with a placeholder that fails when reduced,
+// so both reduce the same cells as a sequential evaluation would.
+void alt_fork(cell_t *c, context_t *ctx) {
+  if(alt_fork_budget <= 0 ||
+     alt_fork_results < 0 ||
+     alt_workers >= ALT_MAX_JOBS ||
+     trace_current_entry() ||
+     !alt_reaches_root(ctx)) return;
+  int p[2];
+  if(pipe(p)) return;
+  fflush(stdout);
+  pid_t pid = fork();
+  if(pid < 0) {
+    close(p[0]);
+    close(p[1]);
+    return;
+  }
+  int budget = alt_fork_budget - 1;
+  if(!pid) {
+    // worker: send output to the parent
+#ifdef __linux__
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+    COUNTUP(i, alt_workers) close(alt_worker_fd[i]);
+    alt_workers = 0;
+    alt_fork_budget = budget / 2;
+    alt_worker = true;
+    close(p[0]);
+    dup2(p[1], STDOUT_FILENO);
+    close(p[1]);
+    c->expr.arg[0] = build11(OP_forked, c->expr.arg[0]);
+  } else {
+    close(p[1]);
+    alt_fork_budget = budget - budget / 2;
+    c->expr.arg[1] = build11(OP_forked, c->expr.arg[1]);
+    alt_worker_pid[alt_workers] = pid;
+    alt_worker_fd[alt_workers] = p[0];
+    alt_worker_cell[alt_workers] = c->expr.arg[1];
+    alt_workers++;
+  }
+}
+
+// Called when a forked placeholder c is reduced.
+// If there are no results yet, this process must produce the first result,
+// so take the branch back from the worker and return true.
+// Otherwise, the branch belongs to a worker, so return false.
+bool alt_fork_take(cell_t *c) {
+  if(alt_fork_results != 0) return false;
+  COUNTDOWN(i, alt_workers) {
+    if(alt_worker_cell[i] == c) {
+      alt_worker_remove(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+static
+size_t read_all(int fd, char **out, size_t n) {
+  size_t size = n;
+  for(;;) {
+    if(n == size) {
+      size = size ? size * 2 : 4096;
+      char *buf = realloc(*out, size);
+      assert_throw(buf, "could not buffer worker output");
+      *out = buf;
+    }
+    ssize_t r = read(fd, *out + n, size - n);
+    if(r <= 0) break;
+    n += r;
+  }
+  return n;
+}
+
+// Wait for the workers, buffering their output in order, newest first.
+// If a worker failed, keep only its output, which is the error, and abort.
+void alt_fork_collect() {
+  alt_fork_budget = 0;
+  while(alt_workers) {
+    int i = alt_workers - 1;
+    size_t start = alt_fork_out_n;
+    alt_fork_out_n = read_all(alt_worker_fd[i], &alt_fork_out, start);
+    close(alt_worker_fd[i]);
+    int status = 0;
+    waitpid(alt_worker_pid[i], &status, 0);
+    alt_workers--;
+    if(WIFEXITED(status) && WEXITSTATUS(status) == ALT_WORKER_RETRY) {
+      alt_fork_out_n = start;
+      alt_worker_retry = true;
+    } else if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      memmove(alt_fork_out, alt_fork_out + start, alt_fork_out_n - start);
+      alt_fork_out_n -= start;
+      alt_worker_failed = true;
+      return_error(ERROR_TYPE_UNEXPECTED);
+    }
+  }
+}
+
+// true if a worker couldn't produce its results without the first result
+bool alt_fork_retry() {
+  bool r = alt_worker_retry;
+  alt_worker_retry = false;
+  return r;
+}
+
+// print the collected output of the workers, returning true if there was any
+bool alt_fork_print() {
+  bool any = alt_fork_out_n > 0;
+  if(any) fwrite(alt_fork_out, 1, alt_fork_out_n, stdout);
+  free(alt_fork_out);
+  alt_fork_out = NULL;
+  alt_fork_out_n = 0;
+  return any;
+}
+
 cell_t *forward(cell_t *c, cell_t *a, cell_t *alt) {
   closure_shrink(c, 1);
   c->size = 1;
@@ -253,7 +623,7 @@ response reduce_arg(cell_t *c,
   cell_t **ap = &c->expr.arg[n];
   response r = reduce(ap, ctx);
   if(r <= DELAY) {
-    ctx->up->alt_set |= ctx->alt_set;
+    ctx->up->alt_set = as_union(ctx->up->alt_set, ctx->alt_set);
     ctx->up->text = seg_range(ctx->up->text, ctx->text);
     split_arg(c, n, dup_alt);
   } else if(r == FAIL) {
@@ -271,7 +641,7 @@ response reduce_ptr(cell_t *c,
   cell_t **ap = &c->value.ptr[n];
   response r = reduce(ap, ctx);
   if(r <= DELAY) {
-    ctx->up->alt_set |= ctx->alt_set;
+    ctx->up->alt_set = as_union(ctx->up->alt_set, ctx->alt_set);
     ctx->up->text = seg_range(ctx->up->text, ctx->text);
     split_arg(c, n + VALUE_OFFSET(ptr), dup_list_alt);
   } else if(r == FAIL) {
@@ -280,8 +650,22 @@ response reduce_ptr(cell_t *c,
   return r;
 }
 
+#if defined(THREADED_DISPATCH)
+// op functions indexed by op, to replace the switch in op_call
+static response (*const op_funcs[OP_COUNT])(cell_t **, context_t *) = {
+#define OP__ITEM(file, line, name)              \
+  [OP_##name] = func_##name,
+#include "op_list.h"
+#undef OP__ITEM
+};
+#endif
+
 static
 response op_call(op op, cell_t **cp, context_t *ctx) {
+#if defined(THREADED_DISPATCH)
+  assert_error(op < OP_COUNT && op_funcs[op], "unknown op %d", op);
+  return op_funcs[op](cp, ctx);
+#else
   switch(op) {
 #define OP__ITEM(file, line, name)                      \
     case OP_##name: return func_##name(cp, ctx);
@@ -291,7 +675,45 @@ response op_call(op op, cell_t **cp, context_t *ctx) {
       assert_error(false, "unknown op %d", op);
       return FAIL;
   }
+#endif
+}
+
+#if defined(THREADED_DISPATCH)
+// Reduce the simplest cases of OP_value and OP_id in place,
+// returning false if the op function is needed.
+// These must match func_value and func_id.
+static
+bool reduce_fast(cell_t **cp, context_t *ctx, response *r) {
+  cell_t *c = *cp;
+  if(watch_enabled) return false;
+  ctx->src = c;
+  switch(c->op) {
+  case OP_value:
+    // a constant of the requested type
+    if(is_var(c) || c->pos || is_list(c) ||
+       c->value.type == T_FAIL ||
+       (ctx->t != T_ANY && ctx->t != c->value.type) ||
+       (ctx->t == T_SYMBOL && range_singleton(ctx->bound) &&
+        ctx->bound.min != c->value.symbol)) return false;
+    ctx->alt_set = c->value.alt_set;
+    *r = SUCCESS;
+    return true;
+  case OP_id: {
+    // without alts, id just forwards its argument
+    if(c->expr.alt_set || c->alt) return false;
+    int pos = c->pos;
+    stats.reduce_cnt++;
+    ctx->alt_set = 0;
+    *cp = CUT(c, expr.arg[0]);
+    if(!is_persistent(*cp)) mark_pos(*cp, pos);
+    *r = RETRY;
+    return true;
+  }
+  default:
+    return false;
+  }
 }
+#endif
 
 cell_t *fill_incomplete(cell_t *c) {
   if(!closure_is_ready(c)) {
@@ -333,17 +755,33 @@ COMMAND(errors, "list errors") {
 // Reduce *cp with type t
 response reduce(cell_t **cp, context_t *ctx) {
   cell_t *c = *cp;
+#if defined(THREADED_DISPATCH)
+  // constants are already reduced, so skip the loop
+  if(c->op == OP_value) {
+    response r;
+    if(reduce_fast(cp, ctx, &r)) {
+      ctx->text = c->src;
+      return r;
+    }
+  }
+#endif
   const char *module_name, *word_name;
   get_name(c, &module_name, &word_name); // debug
-  assert_error(ctx->depth < MAX_CALL_DEPTH, "stack too deep %C", c);
+  if(!stack_available(ctx)) return reduce_on_new_stack(cp, ctx);
 
   while(c) {
     assert_error(is_closure(c));
-    c = *cp = fill_incomplete(c);
-    stats.reduce_cnt++;
+    if(!closure_is_ready(c)) c = *cp = fill_incomplete(c);
     ctx->text = c->src;
     op op = c->op;
-    response r = op_call(op, cp, ctx);
+    response r;
+#if defined(THREADED_DISPATCH)
+    if(!reduce_fast(cp, ctx, &r))
+#endif
+    {
+      stats.reduce_cnt++;
+      r = op_call(op, cp, ctx);
+    }
 
     // prevent infinite loops when debugging
     assert_counter(cells_size);
@@ -740,8 +1178,11 @@ void replace_cell(cell_t **cp, context_t *ctx, cell_t *r) {
     if(is_cell(r)) {
       TRAVERSE_REF(r, alt, ptrs);
       drop(r);
+    } else {
+      trace_drop(r); // as drop() would for an immediate value
     }
    } else {
+    if(!is_cell(r)) r = copy(r); // immediate value, see imm_val()
     store_lazy(cp, r, 0);
   }
 }
@@ -764,7 +1205,7 @@ cell_t *conc_alt(cell_t *a, cell_t *b) {
   return a;
 }
 
-static location_t tmp_use_location = { .file = FILE_ID_NONE, .line = 0 };
+static THREAD_LOCAL location_t tmp_use_location = { .file = FILE_ID_NONE, .line = 0 };
 
 #if INTERFACE
 #define USE_TMP() use_tmp(LOCATION())
@@ -813,8 +1254,8 @@ void store_lazy_dep(cell_t *d, cell_t *r, alt_set_t alt_set) { // CLEANUP
   } else drop(r);
 }
 
-uint8_t new_alt_id(unsigned int n) {
-  uint8_t r = alt_cnt;
+unsigned int new_alt_id(unsigned int n) {
+  unsigned int r = alt_cnt;
   alt_cnt += n;
   LOG_WHEN(n > 0, "allocated alt ids %d...%d", r, alt_cnt-1);
   return r;
@@ -1145,7 +1586,7 @@ bool convert_to_opaque(cell_t *c) {
 alt_set_t ctx_alt_set(context_t *ctx) {
   alt_set_t as = 0;
   FOLLOW(p, ctx, up) {
-    as |= p->alt_set;
+    as = as_union(as, p->alt_set);
   }
   return as;
 }
@@ -1153,7 +1594,7 @@ alt_set_t ctx_alt_set(context_t *ctx) {
 alt_set_t ctx_alt_set_range(context_t *ctx) {
   alt_set_t as = 0;
   FOLLOW(p, ctx, up) {
-    as |= p->alt_set;
+    as = as_union(as, p->alt_set);
     if(!range_bounded(p->bound)) break;
   }
   return as;
@@ -57,6 +57,7 @@ typedef struct mem mem_t;
 typedef struct context context_t;
 typedef struct tcell tcell_t;
 
+// with ALT_SET_BITS, a handle to an interned wide set (see cells.c)
 typedef uintptr_t alt_set_t;
 typedef int16_t refcount_t;
 typedef intptr_t val_t;
@@ -124,7 +125,7 @@ struct context {
   location_t loc; // reported location (for debug) [up]
   qsize_t s; // required quote size [down]
   type_t t; // required type [down]
-  uint8_t depth; // limits nesting depth [down]
+  unsigned int depth; // nesting depth [down]
   bool retry; // to trampoline out for rewrites [up]
   bool inv; // to detect double inversions (see unless) [down]
 };
@@ -226,6 +227,7 @@ struct __attribute__((packed)) mem {
   csize_t __padding;
   cell_t *prev, *next;
   location_t loc; // for debug
+  uintptr_t block_size; // first and last cells of a free block
 };
 
 #define FLAG_specialize (specialize, ->, SPECIALIZE)
@@ -259,8 +261,9 @@ typedef struct specialize_data {
 /* word entry */
 struct __attribute__((packed)) entry {
   uint16_t flags;
-  uint8_t alts, sub_id;
+  uint8_t alts, sub_id, inlined;
   csize_t in, out, len;
+  uint8_t blocks; // reserved while ENTRY_BLOCK is set
   tcell_t *parent;
   union {
     specialize_data *specialize;
@@ -373,9 +376,9 @@ ASSERT_ALIAS(cell_t, expr.arg[1], expr.alt_set);
 static_assert(offsetof(cell_t, c) == 0, "offset of cell_t.c should be 0");
 
 typedef struct stats_t {
-  int reduce_cnt, fail_cnt, alloc_cnt, max_alloc_cnt, trace_cnt;
+  int reduce_cnt, fail_cnt, alloc_cnt, max_alloc_cnt, trace_cnt, free_blocks, interned_cnt;
   clock_t start, stop;
-  uint8_t alt_cnt;
+  unsigned int alt_cnt;
 } stats_t;
 
 #ifdef EMSCRIPTEN
@@ -383,8 +386,15 @@ typedef struct stats_t {
 #endif
 
 // Maximum number of alts
+#ifdef ALT_SET_BITS
+#if ALT_SET_BITS != 128 && ALT_SET_BITS != 256
+#error "ALT_SET_BITS must be 128 or 256"
+#endif
+#define AS_SIZE (ALT_SET_BITS / 2)
+#else
 #define AS_SIZE (sizeof(alt_set_t) * 4)
 #define AS_MASK ((alt_set_t)0x5555555555555555)
+#endif
 #define ALT_SET_IDS AS_SIZE
 
 #define SYM_False     0
@@ -420,6 +430,7 @@ void breakpoint();
 #define TRACE_DECL       0x0020
 #define TRACE_NO_SKIP    0x0040
 #define TRACE_JUMP       0x0080
+#define TRACE_INVARIANT  0x0100
 
 // extra data about functions stored in the trace
 typedef struct trace {
@@ -49,17 +49,19 @@ bool ctx_split(cell_t *c, context_t *ctx) {
   alt_set_t ctx_as = ctx_alt_set(ctx);
   if(c_as == ctx_as) return true;
 
-  alt_set_t combined_as = c_as | ctx_as;
-  alt_set_t common = c_as & ctx_as;
+  alt_set_t combined_as = as_union(c_as, ctx_as);
+  alt_set_t common = as_intersect(c_as, ctx_as);
   if(as_conflict(combined_as)) return false;
-  alt_set_t differ = (c_as ^ ctx_as) & AS_MASK;
+  alt_set_t differ = as_differ(c_as, ctx_as);
   cell_t *alt = c->alt;
   cell_t **p = &c->alt;
   if(!differ) return true;
+  unsigned int n = as_count(differ);
+  assert_throw(n < sizeof(uintmax_t) * 8, "too many alt ids to split on");
   c->value.alt_set = combined_as;
-  FOR_MASK(i, differ) {
-    alt_set_t as = common | as_from_mask(differ, i);
-    if(!as_conflict(as | combined_as)) continue;
+  COUNTUP(i, (uintmax_t)1 << n) {
+    alt_set_t as = as_union(common, as_select(differ, i));
+    if(!as_conflict(as_union(as, combined_as))) continue;
     cell_t *a = copy(c);
     a->value.alt_set = as;
     LOG("ctx_split %C -> %C %S", c, a, as);
@@ -108,6 +110,7 @@ OP(value) {
   if(ctx->t == T_OPAQUE &&
      NOT_FLAG(*c, value, VAR) &&
      c->value.type == T_SYMBOL) {
+    if(is_persistent(c)) c = unique(cp); // interned
     CHECK_IF(!convert_to_opaque(c), FAIL);
     return RETRY;
   }
@@ -218,8 +221,72 @@ cell_t *val(type_t t, val_t x) {
   return(set_val(make_val(t), t, x));
 }
 
+// build a value in c, which may be outside of cells (e.g. on the stack)
+// store_reduced copies it into the reduced cell, so it is never allocated
+cell_t *imm_val(cell_t *c, type_t t, val_t x) {
+  *c = (cell_t) {
+    .size = 1 + VALUE_OFFSET(integer),
+    .op = OP_value,
+    .value.type = t
+  };
+  return set_val(c, t, x);
+}
+
+// Interned constants
+// Persistent cells shared by all uses of small integers and predefined
+// symbols, so that running compiled code doesn't allocate them.
+// They aren't used while tracing, which marks values with pos.
+#ifndef INTERN_INT_MIN
+#define INTERN_INT_MIN (-16)
+#endif
+#ifndef INTERN_INT_MAX
+#define INTERN_INT_MAX 255
+#endif
+
+static THREAD_LOCAL cell_t interned_ints[INTERN_INT_MAX - INTERN_INT_MIN + 1];
+static THREAD_LOCAL cell_t interned_symbols[SYM_File + 1];
+
+/** Return the interned cell for the constant x of type t, or NULL. */
+cell_t *interned_val(type_t t, val_t x) {
+  cell_t *c;
+  if(t == T_INT && INRANGE(x, INTERN_INT_MIN, INTERN_INT_MAX)) {
+    c = &interned_ints[x - INTERN_INT_MIN];
+  } else if(t == T_SYMBOL && INRANGE(x, 0, LENGTH(interned_symbols) - 1)) {
+    c = &interned_symbols[x];
+  } else {
+    return NULL;
+  }
+  if(trace_current_entry()) return NULL;
+  if(!c->op) {
+    *c = (cell_t) {
+      .size = 1 + VALUE_OFFSET(integer),
+      .op = OP_value,
+      .n = PERSISTENT,
+      .value.type = t
+    };
+    set_val(c, t, x);
+  }
+  stats.interned_cnt++;
+  return c;
+}
+
+/** Return the interned cell equal to c, or NULL if c can't be shared. */
+cell_t *interned(cell_t const *c) {
+  if(!is_value(c) ||
+     c->value.flags ||
+     c->value.var ||
+     c->pos ||
+     c->alt) return NULL;
+  switch(c->value.type) {
+  case T_INT: return interned_val(T_INT, c->value.integer);
+  case T_SYMBOL: return interned_val(T_SYMBOL, c->value.symbol);
+  default: return NULL;
+  }
+}
+
 cell_t *int_val(val_t x) {
-  return val(T_INT, x);
+  cell_t *c = interned_val(T_INT, x);
+  return c ? c : val(T_INT, x);
 }
 
 cell_t *float_val(double x) {
@@ -235,7 +302,8 @@ cell_t *opaque(val_t sym, void *p) {
 }
 
 cell_t *symbol(val_t sym) {
-  return val(T_SYMBOL, sym);
+  cell_t *c = interned_val(T_SYMBOL, sym);
+  return c ? c : val(T_SYMBOL, sym);
 }
 
 bool _is_value(cell_t const *c) {
@@ -466,3 +534,14 @@ OP(fail) {
   stats.reduce_cnt--;
   return abort_op(FAIL, cp, ctx);
 }
+
+// a branch of a root alt explored by another process, see alt_fork()
+OP(forked) {
+  PRE(forked);
+  stats.reduce_cnt--;
+  if(alt_fork_take(c)) {
+    c->op = OP_id;
+    return RETRY;
+  }
+  return abort_op(FAIL, cp, ctx);
+}
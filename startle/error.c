@@ -31,7 +31,7 @@
 #include "startle/log.h"
 #include "startle/static_alloc.h"
 
-static bool breakpoint_disabled = false;
+static THREAD_LOCAL bool breakpoint_disabled = false;
 
 #if INTERFACE
 #include <setjmp.h>
@@ -156,7 +156,7 @@ typedef struct {
 
 #define _assert_counter(n)                                               \
   do {                                                                   \
-    static unsigned int *counter = NULL;                                 \
+    static THREAD_LOCAL unsigned int *counter = NULL;                    \
     if(!counter) counter = alloc_counter();                              \
     if(*counter > (n)) {                                                 \
       throw_error(ERROR_TYPE_UNEXPECTED,                                 \
@@ -210,7 +210,7 @@ typedef struct {
 
 #endif
 
-error_t *current_error = NULL;
+THREAD_LOCAL error_t *current_error = NULL;
 
 /** Return the error type to `catch_error`. */
 void return_error(error_type_t type) {
@@ -256,7 +256,7 @@ void breakpoint() {
 }
 
 STATIC_ALLOC(counters, unsigned int, 8);
-static unsigned int counters_n = 0;
+static THREAD_LOCAL unsigned int counters_n = 0;
 
 unsigned int *alloc_counter() {
   assert_error(counters_n < counters_size);
@@ -47,24 +47,24 @@
 // must be a power of two size
 STATIC_ALLOC(log_data, intptr_t, 1 << 12);
 
-static unsigned int log_start = 0;
-static unsigned int log_end = 0;
-static unsigned int log_watch = ~0;
-static unsigned int log_watch_to = ~0;
-static intptr_t log_watch_fmt = 0;
-static bool set_log_watch_fmt = false;
-static bool watching = false;
-static unsigned int msg_head = 0;
-
-static bool tweak_enabled = false;
-static bool set_tweak_fmt = false;
-static char *tweak_fmt = NULL;
-static unsigned int tweak_trigger = ~0;
-static intptr_t tweak_value = 0;
+static THREAD_LOCAL unsigned int log_start = 0;
+static THREAD_LOCAL unsigned int log_end = 0;
+static THREAD_LOCAL unsigned int log_watch = ~0;
+static THREAD_LOCAL unsigned int log_watch_to = ~0;
+static THREAD_LOCAL intptr_t log_watch_fmt = 0;
+static THREAD_LOCAL bool set_log_watch_fmt = false;
+static THREAD_LOCAL bool watching = false;
+static THREAD_LOCAL unsigned int msg_head = 0;
+
+static THREAD_LOCAL bool tweak_enabled = false;
+static THREAD_LOCAL bool set_tweak_fmt = false;
+static THREAD_LOCAL char *tweak_fmt = NULL;
+static THREAD_LOCAL unsigned int tweak_trigger = ~0;
+static THREAD_LOCAL intptr_t tweak_value = 0;
 
 STATIC_ALLOC(hash_tag_set, uintptr_t, 63);
 
-log_context_t *__log_context = NULL;
+THREAD_LOCAL log_context_t *__log_context = NULL;
 
 /** Call this first to initialize the log. */
 void log_init() {
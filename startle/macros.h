@@ -431,14 +431,22 @@
 
 #define STR_IF(cond, str) ((cond) ? (str) : "")
 
+// runtime state is per thread when built with THREAD_LOCAL_STATE,
+// so that each thread can run its own evaluation
+#if defined(THREAD_LOCAL_STATE)
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL
+#endif
+
 #define STATIC_ALLOC(name, type, ...)               \
-  extern type *name;                                \
-  extern size_t name##_size;                        \
+  extern THREAD_LOCAL type *name;                   \
+  extern THREAD_LOCAL size_t name##_size;           \
   extern size_t name##_size_init
 #define STATIC_ALLOC_ALIGNED(...) STATIC_ALLOC(__VA_ARGS__)
 #define STATIC_ALLOC_DEPENDENT(name, type, ...)     \
-  extern type *name;                                \
-  extern size_t name##_size
+  extern THREAD_LOCAL type *name;                   \
+  extern THREAD_LOCAL size_t name##_size
 #define STATIC_FOREACH(i, a) COUNTUP(i, a##_size)
 
 #define PAIR(x, y) ((pair_t) {(uintptr_t)(x), (uintptr_t)(y)})
@@ -22,6 +22,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <time.h>
 
 #include "startle/types.h"
 #include "startle/stats_types.h"
@@ -1135,6 +1136,183 @@ void _print_string_map(char *name, map_t map) {
   print_string_pairs(map_elems(map), cnt);
 }
 
+// Hash maps
+// A hash map shares the header of a map, but entries are kept in an
+// open addressing table with linear probing instead of sorted runs.
+// Keys must be non-zero, because zero marks an empty slot, so a zeroed
+// table is empty and can be declared statically.
+
+#if INTERFACE
+/** Declare a hash map with `size` slots.
+ * `size` must be a power of two, and can hold 3/4 `size` entries.
+ */
+#define HMAP(name, size) MAP(name, size)
+#endif
+
+// Fibonacci hashing, size must be a power of two
+static
+size_t hmap_index(uintptr_t key, size_t size) {
+  const uintptr_t golden = sizeof(uintptr_t) > 4 ?
+    (uintptr_t)0x9e3779b97f4a7c15ull :
+    (uintptr_t)0x9e3779b9;
+  return size > 1 ?
+    (key * golden) >> (sizeof(uintptr_t) * 8 - __builtin_ctzl(size)) :
+    0;
+}
+
+/** Clear all entries from a hash map.
+ * O(n) time, unless already empty
+ */
+void hmap_clear(map_t map) {
+  uintptr_t *cnt = map_cnt(map);
+  if(*cnt) {
+    memset(map_elems(map), 0, map_size(map) * sizeof(pair_t));
+    *cnt = 0;
+  }
+}
+
+/** Look up an entry in a hash map.
+ * O(1) expected time
+ * @return a pointer to the entry if found, otherwise NULL.
+ */
+pair_t *hmap_find(map_t map, uintptr_t key) {
+  if(!key) return NULL;
+  size_t size = map_size(map), mask = size - 1;
+  pair_t *elems = map_elems(map);
+  for(size_t i = hmap_index(key, size);; i = (i + 1) & mask) {
+    pair_t *p = &elems[i];
+    if(p->first == key) return p;
+    if(!p->first) return NULL;
+  }
+}
+
+/** Insert into a hash map, replacing any entry with the same key.
+ * O(1) expected time
+ * @return true if inserted
+ */
+bool hmap_replace_insert(map_t map, pair_t x) {
+  assert_error(x.first);
+  size_t size = map_size(map), mask = size - 1;
+  pair_t *elems = map_elems(map);
+  for(size_t i = hmap_index(x.first, size);; i = (i + 1) & mask) {
+    pair_t *p = &elems[i];
+    if(p->first == x.first) {
+      p->second = x.second;
+      return true;
+    }
+    if(!p->first) {
+      uintptr_t *cnt = map_cnt(map);
+      if(*cnt >= size - size / 4) return false;
+      *p = x;
+      ++*cnt;
+      return true;
+    }
+  }
+}
+
+/** Insert into a hash map.
+ * A hash map holds one entry per key, so this is the same as hmap_replace_insert.
+ */
+bool hmap_insert(map_t map, pair_t x) {
+  return hmap_replace_insert(map, x);
+}
+
+/** Remove an entry from a hash map.
+ * O(1) expected time
+ * @return true if the key was found
+ */
+bool hmap_remove(map_t map, uintptr_t key) {
+  pair_t *p = hmap_find(map, key);
+  if(!p) return false;
+  size_t size = map_size(map), mask = size - 1;
+  pair_t *elems = map_elems(map);
+  size_t i = p - elems, j = i;
+
+  // shift following entries back to fill the hole
+  for(;;) {
+    j = (j + 1) & mask;
+    pair_t *q = &elems[j];
+    if(!q->first) break;
+    size_t k = hmap_index(q->first, size);
+    if(((j - k) & mask) >= ((j - i) & mask)) {
+      elems[i] = *q;
+      i = j;
+    }
+  }
+  elems[i] = (pair_t) {0, 0};
+  --*map_cnt(map);
+  return true;
+}
+
+TEST(hmap) {
+  HMAP(map, 32);
+  int elems[] = {2, 5, 8, 3, 1, 34, 4, 7, 6, 9, 10, 15, 13, 11, 12};
+  FOREACH(i, elems) {
+    pair_t p = {elems[i], i};
+    if(!hmap_insert(map, p)) return -1;
+  }
+  FOREACH(i, elems) {
+    pair_t *p = hmap_find(map, elems[i]);
+    if(!p || p->second != i) return -2;
+  }
+  if(hmap_find(map, 14)) return -3;
+
+  // remove every other entry
+  FOREACH(i, elems) {
+    if(i & 1 && !hmap_remove(map, elems[i])) return -4;
+  }
+  FOREACH(i, elems) {
+    pair_t *p = hmap_find(map, elems[i]);
+    if(i & 1 ? !!p : !p || p->second != i) return -5;
+  }
+  if(*map_cnt(map) != (LENGTH(elems) + 1) / 2) return -6;
+
+  // fill to the load limit
+  uintptr_t key = 100;
+  while(hmap_insert(map, (pair_t) {key, 0})) key++;
+  if(*map_cnt(map) != 24) return -7;
+  hmap_replace_insert(map, (pair_t) {2, 42});
+  if(hmap_find(map, 2)->second != 42) return -8;
+  hmap_clear(map);
+  if(hmap_find(map, 2)) return -9;
+  return 0;
+}
+
+// compare map and hmap with random integer keys
+TEST(bench_hmap) {
+  const size_t n = 1 << 14, lookups = 1 << 18;
+  map_t map = alloc_map(n);
+  map_t hmap = calloc(2 * n + 1, sizeof(pair_t));
+  hmap[0].first = 2 * n;
+  uintptr_t *keys = malloc(n * sizeof(uintptr_t));
+  uint32_t seed = 1;
+  COUNTUP(i, n) {
+    seed = seed * 1103515245 + 12345;
+    keys[i] = (uintptr_t)seed << 8 | i; // unique and non-zero
+  }
+  int ret = 0;
+
+  clock_t t0 = clock();
+  COUNTUP(i, n) map_replace_insert(map, (pair_t) {keys[i], i});
+  uintptr_t sum = 0;
+  COUNTUP(i, lookups) sum += map_find(map, keys[(i * 7919) % n])->second;
+  clock_t t1 = clock();
+  COUNTUP(i, n) hmap_replace_insert(hmap, (pair_t) {keys[i], i});
+  uintptr_t hsum = 0;
+  COUNTUP(i, lookups) hsum += hmap_find(hmap, keys[(i * 7919) % n])->second;
+  clock_t t2 = clock();
+
+  if(sum != hsum) ret = -1;
+  printf("bench_hmap: %d entries, %d lookups: map %.3f sec, hmap %.3f sec\n",
+          (int)n, (int)lookups,
+          (t1 - t0) / (double)CLOCKS_PER_SEC,
+          (t2 - t1) / (double)CLOCKS_PER_SEC);
+  free(keys);
+  free(hmap);
+  free(map);
+  return ret;
+}
+
 #define find_test(map, key) _find_test((map), #map, (key))
 
 pair_t *_find_test(map_t map, char *name, uintptr_t key) {
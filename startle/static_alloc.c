@@ -33,20 +33,22 @@
 #define STATIC_ALLOC__ITEM(file, line, name, type, default_size) STATIC_ALLOC_ALIGNED__ITEM(file, line, name, type, default_size, __alignof__(type))
 
 // declare pointers to static allocations
+// (per thread with THREAD_LOCAL_STATE, but configured sizes are shared)
 #define STATIC_ALLOC_ALIGNED__ITEM(file, line, name, type, ...)         \
-  type *name = NULL;                                                    \
-  size_t name##_size = 0;                                               \
+  THREAD_LOCAL type *name = NULL;                                       \
+  THREAD_LOCAL size_t name##_size = 0;                                  \
   size_t name##_size_init = 0;
 #define STATIC_ALLOC_DEPENDENT__ITEM(file, line, name, type, ...)       \
-  type *name = NULL;                                                    \
-  size_t name##_size = 0;
+  THREAD_LOCAL type *name = NULL;                                       \
+  THREAD_LOCAL size_t name##_size = 0;
 #include "static_alloc_list.h"
 #undef STATIC_ALLOC_ALIGNED__ITEM
 #undef STATIC_ALLOC_DEPENDENT__ITEM
 
-static char *__alloc = NULL;
-static char *__mem = NULL;
-static size_t __mem_size = 0;
+// other threads call static_alloc_reinit to get their own block
+static THREAD_LOCAL char *__alloc = NULL;
+static THREAD_LOCAL char *__mem = NULL;
+static THREAD_LOCAL size_t __mem_size = 0;
 
 // determine maximum name size
 #define STATIC_ALLOC_ALIGNED__ITEM(file, line, name, type, default_size, alignment) \
@@ -66,7 +68,7 @@ typedef struct {
   size_t offset;
   size_t width;
 } allocation_t;
-static allocation_t allocation_table[] = {
+static THREAD_LOCAL allocation_t allocation_table[] = {
 #define STATIC_ALLOC_ALIGNED__ITEM(file, line, _name, _type, ...) \
   { .name = #_name, .type_name = #_type },
 #define STATIC_ALLOC_DEPENDENT__ITEM(...) STATIC_ALLOC__ITEM(__VA_ARGS__)
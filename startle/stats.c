@@ -48,7 +48,7 @@
 #endif
 
 #if STATS
-stats_counter __stats_counter;
+THREAD_LOCAL stats_counter __stats_counter;
 #endif
 
 void stats_reset_counters() {
@@ -52,12 +52,15 @@ static test_entry_t tests[] = {
 
 #undef TEST__ITEM
 
-/** Run all tests matching the name. */
+/** Run all tests matching the name.
+ *  Benchmarks (bench_*) only run when named explicitly. */
 int run_test(seg_t name) {
   int fail = 0;
+  bool bench = name.n >= 5 && strncmp(name.s, "bench", 5) == 0;
   FOREACH(i, tests) {
     test_entry_t *entry = &tests[i];
-    if(strncmp(entry->name, name.s, name.n) == 0) {
+    if(strncmp(entry->name, name.s, name.n) == 0 &&
+       (bench || strncmp(entry->name, "bench_", 6) != 0)) {
       printf("@ %s\n", entry->name);
       int result = entry->run();
       printf("%s => %d\n", entry->name, result);
@@ -471,6 +471,13 @@ cell_t *exec_expand(cell_t *c, tcell_t *new_entry) {
       continue;
     }
 
+    // share constants instead of copying them
+    cell_t *ic = pos ? NULL : interned(&p->c);
+    if(ic) {
+      p->alt = ic;
+      continue;
+    }
+
     // allocate a cell and copy instruction
     tcell_t *e = is_user_func(p) ? get_entry(p) : NULL;
     cell_t *nc;
@@ -537,8 +544,8 @@ cell_t *exec_expand(cell_t *c, tcell_t *new_entry) {
   // handle returns
   // HACK: only allocate alt ids when compiling
   bool tracing = trace_current_entry() != NULL || NOT_FLAG(*entry, entry, RECURSIVE);
-  uint8_t alt_n = tracing ? int_log2(entry->entry.alts) : 0;
-  uint8_t alt_id = new_alt_id(alt_n);
+  unsigned int alt_n = tracing ? int_log2(entry->entry.alts) : 0;
+  unsigned int alt_id = new_alt_id(alt_n);
   unsigned int branch = 0;
 
   // first one